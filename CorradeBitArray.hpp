@@ -0,0 +1,1141 @@
+/*
+    Corrade::Containers::BitArray, Corrade::Containers::BitArrayView,
+    Corrade::Containers::StridedBitArrayView
+        — packed bit arrays and views on them
+
+    https://doc.magnum.graphics/corrade/classCorrade_1_1Containers_1_1BitArray.html
+    https://doc.magnum.graphics/corrade/classCorrade_1_1Containers_1_1BasicBitArrayView.html
+    https://doc.magnum.graphics/corrade/classCorrade_1_1Containers_1_1BasicStridedBitArrayView.html
+
+    Depends on CorradeStridedArrayView.h, the implementation depends on
+    CorradeCpu.hpp.
+
+    This single-header library isn't generated from the Corrade project, it's
+    a local addition that follows the layout of the generated ones. With the
+    goal being easy integration, it's deliberately free of all comments to
+    keep the file size small. Docs for the upstream APIs it mirrors are here:
+
+    -   Project homepage — https://magnum.graphics/corrade/
+    -   Documentation — https://doc.magnum.graphics/corrade/
+    -   GitHub project page — https://github.com/mosra/corrade
+    -   GitHub Singles repository — https://github.com/mosra/magnum-singles
+
+    The library has a separate non-inline implementation part, enable it *just
+    once* like this:
+
+        #define CORRADE_BITARRAY_IMPLEMENTATION
+        #include <CorradeBitArray.hpp>
+
+    If you need the deinlined symbols to be exported from a shared library,
+    `#define CORRADE_UTILITY_EXPORT` and `CORRADE_UTILITY_LOCAL` as
+    appropriate. Runtime CPU dispatch for the implementation is enabled by
+    default, you can disable it with `#define CORRADE_NO_CPU_RUNTIME_DISPATCH`
+    before including the file in both the headers and the implementation. To
+    enable the IFUNC functionality for CPU runtime dispatch,
+    `#define CORRADE_CPU_USE_IFUNC`.
+
+    Local addition, not generated from upstream Corrade, 1141 / 3371 LoC
+*/
+
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "CorradeStridedArrayView.h"
+
+#ifndef CORRADE_NO_CPU_RUNTIME_DISPATCH
+#define CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#endif
+
+#ifndef CorradeBitArray_hpp
+#define CorradeBitArray_hpp
+#ifndef CORRADE_UTILITY_EXPORT
+#define CORRADE_UTILITY_EXPORT
+#endif
+#ifndef CORRADE_UTILITY_LOCAL
+#define CORRADE_UTILITY_LOCAL
+#endif
+#if defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && !defined(CORRADE_CPU_USE_IFUNC)
+    #define CORRADE_UTILITY_CPU_DISPATCHER_DECLARATION(name)                \
+        CORRADE_UTILITY_EXPORT decltype(name) name ## Implementation(Cpu::Features);
+    #define CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(name) (*name)
+#else
+    #define CORRADE_UTILITY_CPU_DISPATCHER_DECLARATION(name)
+    #define CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(name) (name)
+#endif
+
+namespace Corrade { namespace Containers {
+
+class BitArray;
+template<class> class BasicBitArrayView;
+typedef BasicBitArrayView<const char> BitArrayView;
+typedef BasicBitArrayView<char> MutableBitArrayView;
+template<unsigned dimensions> using StridedBitArrayView = BasicStridedBitArrayView<dimensions, const char>;
+typedef StridedBitArrayView<1> StridedBitArrayView1D;
+typedef StridedBitArrayView<2> StridedBitArrayView2D;
+typedef StridedBitArrayView<3> StridedBitArrayView3D;
+typedef StridedBitArrayView<4> StridedBitArrayView4D;
+template<unsigned dimensions> using MutableStridedBitArrayView = BasicStridedBitArrayView<dimensions, char>;
+typedef MutableStridedBitArrayView<1> MutableStridedBitArrayView1D;
+typedef MutableStridedBitArrayView<2> MutableStridedBitArrayView2D;
+typedef MutableStridedBitArrayView<3> MutableStridedBitArrayView3D;
+typedef MutableStridedBitArrayView<4> MutableStridedBitArrayView4D;
+
+}}
+#endif
+#ifndef Corrade_Corrade_h
+#define Corrade_Corrade_h
+
+namespace Corrade {
+
+namespace Cpu {
+    class Features;
+}
+
+}
+
+#endif
+#ifndef Corrade_Containers_BitArrayView_h
+#define Corrade_Containers_BitArrayView_h
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+CORRADE_UTILITY_EXPORT extern std::size_t CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitCountSet)(const char* data, std::size_t offset, std::size_t size);
+CORRADE_UTILITY_CPU_DISPATCHER_DECLARATION(bitCountSet)
+CORRADE_UTILITY_EXPORT extern std::size_t CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitFindFirstSet)(const char* data, std::size_t offset, std::size_t size);
+CORRADE_UTILITY_CPU_DISPATCHER_DECLARATION(bitFindFirstSet)
+CORRADE_UTILITY_EXPORT void bitSetAll(char* data, std::size_t offset, std::size_t size, bool value);
+
+}
+
+template<class T> class BasicBitArrayView {
+    public:
+        typedef typename std::conditional<std::is_const<T>::value, const void, void>::type ErasedType;
+
+        constexpr /*implicit*/ BasicBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _sizeOffset{} {}
+
+        /*implicit*/ BasicBitArrayView(ErasedType* data, std::size_t offset, std::size_t size) noexcept: _data{static_cast<T*>(data)}, _sizeOffset{size << 3 | offset} {
+            CORRADE_DEBUG_ASSERT(offset < 8,
+                "Containers::BitArrayView: offset expected to be smaller than 8 bits, got" << offset, );
+            CORRADE_DEBUG_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - 3),
+                "Containers::BitArrayView: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - 3) << "bits, got" << size, );
+        }
+
+        template<class U, typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value, int>::type = 0> constexpr /*implicit*/ BasicBitArrayView(const BasicBitArrayView<U>& mutable_) noexcept: _data{mutable_._data}, _sizeOffset{mutable_._sizeOffset} {}
+
+        constexpr ErasedType* data() const { return _data; }
+
+        constexpr std::size_t offset() const { return _sizeOffset & 0x07; }
+
+        constexpr std::size_t size() const { return _sizeOffset >> 3; }
+
+        constexpr bool isEmpty() const { return !(_sizeOffset >> 3); }
+
+        bool operator[](std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < size(),
+                "Containers::BitArrayView::operator[](): index" << i << "out of range for" << size() << "bits", {});
+            const std::size_t j = (_sizeOffset & 0x07) + i;
+            return _data[j >> 3] & (1 << (j & 0x07));
+        }
+
+        template<class U = T, typename std::enable_if<!std::is_const<U>::value, int>::type = 0> void set(std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < size(),
+                "Containers::BitArrayView::set(): index" << i << "out of range for" << size() << "bits", );
+            const std::size_t j = (_sizeOffset & 0x07) + i;
+            _data[j >> 3] |= (1 << (j & 0x07));
+        }
+
+        template<class U = T, typename std::enable_if<!std::is_const<U>::value, int>::type = 0> void reset(std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < size(),
+                "Containers::BitArrayView::reset(): index" << i << "out of range for" << size() << "bits", );
+            const std::size_t j = (_sizeOffset & 0x07) + i;
+            _data[j >> 3] &= ~(1 << (j & 0x07));
+        }
+
+        template<class U = T, typename std::enable_if<!std::is_const<U>::value, int>::type = 0> void set(std::size_t i, bool value) const {
+            CORRADE_DEBUG_ASSERT(i < size(),
+                "Containers::BitArrayView::set(): index" << i << "out of range for" << size() << "bits", );
+            const std::size_t j = (_sizeOffset & 0x07) + i;
+            char& byte = _data[j >> 3];
+            byte ^= (-char(value) ^ byte) & (1 << (j & 0x07));
+        }
+
+        template<class U = T, typename std::enable_if<!std::is_const<U>::value, int>::type = 0> void setAll() const {
+            Implementation::bitSetAll(_data, _sizeOffset & 0x07, _sizeOffset >> 3, true);
+        }
+
+        template<class U = T, typename std::enable_if<!std::is_const<U>::value, int>::type = 0> void resetAll() const {
+            Implementation::bitSetAll(_data, _sizeOffset & 0x07, _sizeOffset >> 3, false);
+        }
+
+        template<class U = T, typename std::enable_if<!std::is_const<U>::value, int>::type = 0> void setAll(bool value) const {
+            Implementation::bitSetAll(_data, _sizeOffset & 0x07, _sizeOffset >> 3, value);
+        }
+
+        std::size_t count() const {
+            return Implementation::bitCountSet(_data, _sizeOffset & 0x07, _sizeOffset >> 3);
+        }
+
+        std::size_t findFirstSet() const {
+            return Implementation::bitFindFirstSet(_data, _sizeOffset & 0x07, _sizeOffset >> 3);
+        }
+
+        BasicBitArrayView<T> slice(std::size_t begin, std::size_t end) const {
+            CORRADE_DEBUG_ASSERT(begin <= end && end <= (_sizeOffset >> 3),
+                "Containers::BitArrayView::slice(): slice [" << Utility::Debug::nospace << begin << Utility::Debug::nospace << ":" << Utility::Debug::nospace << end << Utility::Debug::nospace << "] out of range for" << (_sizeOffset >> 3) << "bits", {});
+            const std::size_t j = (_sizeOffset & 0x07) + begin;
+            return BasicBitArrayView<T>{_data + (j >> 3), j & 0x07, end - begin};
+        }
+
+        BasicBitArrayView<T> sliceSize(std::size_t begin, std::size_t size) const {
+            return slice(begin, begin + size);
+        }
+
+        BasicBitArrayView<T> prefix(std::size_t size) const {
+            return slice(0, size);
+        }
+
+        BasicBitArrayView<T> suffix(std::size_t size) const {
+            return slice((_sizeOffset >> 3) - size, _sizeOffset >> 3);
+        }
+
+        BasicBitArrayView<T> exceptPrefix(std::size_t size) const {
+            return slice(size, _sizeOffset >> 3);
+        }
+
+        BasicBitArrayView<T> exceptSuffix(std::size_t size) const {
+            return slice(0, (_sizeOffset >> 3) - size);
+        }
+
+    private:
+        template<class> friend class BasicBitArrayView;
+
+        T* _data;
+        std::size_t _sizeOffset;
+};
+
+CORRADE_UTILITY_EXPORT void bitAndInto(const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst);
+
+CORRADE_UTILITY_EXPORT void bitOrInto(const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst);
+
+CORRADE_UTILITY_EXPORT void bitXorInto(const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst);
+
+}}
+
+#endif
+#ifndef Corrade_Containers_BitArray_h
+#define Corrade_Containers_BitArray_h
+
+namespace Corrade { namespace Containers {
+
+class CORRADE_UTILITY_EXPORT BitArray {
+    public:
+        typedef void(*Deleter)(char*, std::size_t);
+
+        template<class U, typename std::enable_if<std::is_same<std::nullptr_t, U>::value, int>::type = 0> /*implicit*/ BitArray(U) noexcept: _data{}, _sizeOffset{}, _deleter{} {}
+
+        /*implicit*/ BitArray() noexcept: _data{}, _sizeOffset{}, _deleter{} {}
+
+        explicit BitArray(Corrade::ValueInitT, std::size_t size);
+
+        explicit BitArray(Corrade::NoInitT, std::size_t size);
+
+        explicit BitArray(Corrade::DirectInitT, std::size_t size, bool value);
+
+        explicit BitArray(std::size_t size): BitArray{Corrade::ValueInit, size} {}
+
+        explicit BitArray(void* data, std::size_t offset, std::size_t size, Deleter deleter) noexcept;
+
+        BitArray(const BitArray&) = delete;
+
+        BitArray(BitArray&& other) noexcept;
+
+        ~BitArray();
+
+        BitArray& operator=(const BitArray&) = delete;
+
+        BitArray& operator=(BitArray&& other) noexcept;
+
+        /*implicit*/ operator MutableBitArrayView() {
+            return MutableBitArrayView{_data, _sizeOffset & 0x07, _sizeOffset >> 3};
+        }
+
+        /*implicit*/ operator BitArrayView() const {
+            return BitArrayView{_data, _sizeOffset & 0x07, _sizeOffset >> 3};
+        }
+
+        char* data() { return _data; }
+
+        const char* data() const { return _data; }
+
+        Deleter deleter() const { return _deleter; }
+
+        std::size_t offset() const { return _sizeOffset & 0x07; }
+
+        std::size_t size() const { return _sizeOffset >> 3; }
+
+        bool isEmpty() const { return !(_sizeOffset >> 3); }
+
+        bool operator[](std::size_t i) const {
+            return BitArrayView{*this}[i];
+        }
+
+        void set(std::size_t i) {
+            MutableBitArrayView{*this}.set(i);
+        }
+
+        void reset(std::size_t i) {
+            MutableBitArrayView{*this}.reset(i);
+        }
+
+        void set(std::size_t i, bool value) {
+            MutableBitArrayView{*this}.set(i, value);
+        }
+
+        void setAll() {
+            Implementation::bitSetAll(_data, _sizeOffset & 0x07, _sizeOffset >> 3, true);
+        }
+
+        void resetAll() {
+            Implementation::bitSetAll(_data, _sizeOffset & 0x07, _sizeOffset >> 3, false);
+        }
+
+        void setAll(bool value) {
+            Implementation::bitSetAll(_data, _sizeOffset & 0x07, _sizeOffset >> 3, value);
+        }
+
+        std::size_t count() const {
+            return Implementation::bitCountSet(_data, _sizeOffset & 0x07, _sizeOffset >> 3);
+        }
+
+        std::size_t findFirstSet() const {
+            return Implementation::bitFindFirstSet(_data, _sizeOffset & 0x07, _sizeOffset >> 3);
+        }
+
+        MutableBitArrayView slice(std::size_t begin, std::size_t end) {
+            return MutableBitArrayView{*this}.slice(begin, end);
+        }
+
+        BitArrayView slice(std::size_t begin, std::size_t end) const {
+            return BitArrayView{*this}.slice(begin, end);
+        }
+
+        MutableBitArrayView sliceSize(std::size_t begin, std::size_t size) {
+            return MutableBitArrayView{*this}.sliceSize(begin, size);
+        }
+
+        BitArrayView sliceSize(std::size_t begin, std::size_t size) const {
+            return BitArrayView{*this}.sliceSize(begin, size);
+        }
+
+        MutableBitArrayView prefix(std::size_t size) {
+            return MutableBitArrayView{*this}.prefix(size);
+        }
+
+        BitArrayView prefix(std::size_t size) const {
+            return BitArrayView{*this}.prefix(size);
+        }
+
+        MutableBitArrayView suffix(std::size_t size) {
+            return MutableBitArrayView{*this}.suffix(size);
+        }
+
+        BitArrayView suffix(std::size_t size) const {
+            return BitArrayView{*this}.suffix(size);
+        }
+
+        MutableBitArrayView exceptPrefix(std::size_t size) {
+            return MutableBitArrayView{*this}.exceptPrefix(size);
+        }
+
+        BitArrayView exceptPrefix(std::size_t size) const {
+            return BitArrayView{*this}.exceptPrefix(size);
+        }
+
+        MutableBitArrayView exceptSuffix(std::size_t size) {
+            return MutableBitArrayView{*this}.exceptSuffix(size);
+        }
+
+        BitArrayView exceptSuffix(std::size_t size) const {
+            return BitArrayView{*this}.exceptSuffix(size);
+        }
+
+        char* release();
+
+    private:
+        char* _data;
+        std::size_t _sizeOffset;
+        Deleter _deleter;
+};
+
+}}
+
+#endif
+#ifndef Corrade_Containers_StridedBitArrayView_h
+#define Corrade_Containers_StridedBitArrayView_h
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<unsigned dimensions, class T> struct StridedBitElement {
+        static BasicStridedBitArrayView<dimensions - 1, T> get(T* const data, const Size<dimensions>& sizeOffset, const Stride<dimensions>& stride, const std::size_t i) {
+            const std::ptrdiff_t j = std::ptrdiff_t(sizeOffset._data[0] & 0x07) + std::ptrdiff_t(i)*stride._data[0];
+            Size<dimensions - 1> nextSizeOffset{Corrade::NoInit};
+            Stride<dimensions - 1> nextStride{Corrade::NoInit};
+            for(std::size_t k = 1; k != dimensions; ++k) {
+                nextSizeOffset._data[k - 1] = sizeOffset._data[k] & ~std::size_t{0x07};
+                nextStride._data[k - 1] = stride._data[k];
+            }
+            nextSizeOffset._data[0] |= j & 0x07;
+            return BasicStridedBitArrayView<dimensions - 1, T>{nextSizeOffset, nextStride, data + (j >> 3)};
+        }
+    };
+    template<class T> struct StridedBitElement<1, T> {
+        static bool get(T* const data, const Size<1>& sizeOffset, const Stride<1>& stride, const std::size_t i) {
+            const std::ptrdiff_t j = std::ptrdiff_t(sizeOffset._data[0] & 0x07) + std::ptrdiff_t(i)*stride._data[0];
+            return data[j >> 3] & (1 << (j & 0x07));
+        }
+    };
+}
+
+template<unsigned dimensions, class T> class BasicStridedBitArrayView {
+    static_assert(dimensions, "can't have a zero-dimensional view");
+
+    public:
+        typedef typename std::conditional<std::is_const<T>::value, const void, void>::type ErasedType;
+
+        constexpr /*implicit*/ BasicStridedBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _sizeOffset{}, _stride{} {}
+
+        BasicStridedBitArrayView(BasicBitArrayView<T> data, ErasedType* begin, std::size_t offset, const Size<dimensions>& size, const Stride<dimensions>& stride) noexcept: _data{static_cast<T*>(begin)}, _sizeOffset{Corrade::NoInit}, _stride{stride} {
+            CORRADE_DEBUG_ASSERT(offset < 8,
+                "Containers::StridedBitArrayView: offset expected to be smaller than 8 bits, got" << offset, );
+            for(std::size_t i = 0; i != dimensions; ++i) {
+                CORRADE_DEBUG_ASSERT(size._data[i] < std::size_t{1} << (sizeof(std::size_t)*8 - 3),
+                    "Containers::StridedBitArrayView: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - 3) << "bits, got" << size, );
+                _sizeOffset._data[i] = size._data[i] << 3;
+            }
+            _sizeOffset._data[0] |= offset;
+            static_cast<void>(data);
+        }
+
+        BasicStridedBitArrayView(BasicBitArrayView<T> data, const Size<dimensions>& size, const Stride<dimensions>& stride) noexcept: BasicStridedBitArrayView{data, data.data(), data.offset(), size, stride} {}
+
+        template<unsigned dimensions_ = dimensions, typename std::enable_if<dimensions_ == 1, int>::type = 0> /*implicit*/ BasicStridedBitArrayView(BasicBitArrayView<T> data) noexcept: _data{static_cast<T*>(data.data())}, _sizeOffset{data.size() << 3 | data.offset()}, _stride{1} {}
+
+        template<class U, unsigned dimensions_ = dimensions, typename std::enable_if<dimensions_ == 1 && std::is_same<const U, T>::value && !std::is_same<U, T>::value, int>::type = 0> /*implicit*/ BasicStridedBitArrayView(BasicBitArrayView<U> data) noexcept: BasicStridedBitArrayView{BasicBitArrayView<T>{data}} {}
+
+        template<class U, typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value, int>::type = 0> constexpr /*implicit*/ BasicStridedBitArrayView(const BasicStridedBitArrayView<dimensions, U>& mutable_) noexcept: _data{mutable_._data}, _sizeOffset{mutable_._sizeOffset}, _stride{mutable_._stride} {}
+
+        constexpr ErasedType* data() const { return _data; }
+
+        constexpr std::size_t offset() const { return _sizeOffset._data[0] & 0x07; }
+
+        Size<dimensions> size() const {
+            Size<dimensions> out{Corrade::NoInit};
+            for(std::size_t i = 0; i != dimensions; ++i)
+                out._data[i] = _sizeOffset._data[i] >> 3;
+            return out;
+        }
+
+        constexpr Stride<dimensions> stride() const { return _stride; }
+
+        bool isEmpty() const {
+            for(std::size_t i = 0; i != dimensions; ++i)
+                if(!(_sizeOffset._data[i] >> 3)) return true;
+            return false;
+        }
+
+        template<unsigned dimensions_ = dimensions, typename std::enable_if<dimensions_ == 1, int>::type = 0> bool isContiguous() const {
+            return _stride._data[0] == 1;
+        }
+
+        auto operator[](std::size_t i) const -> decltype(Implementation::StridedBitElement<dimensions, T>::get(std::declval<T*>(), std::declval<const Size<dimensions>&>(), std::declval<const Stride<dimensions>&>(), i)) {
+            CORRADE_DEBUG_ASSERT(i < (_sizeOffset._data[0] >> 3),
+                "Containers::StridedBitArrayView::operator[](): index" << i << "out of range for" << (_sizeOffset._data[0] >> 3) << "elements", (Implementation::StridedBitElement<dimensions, T>::get(_data, _sizeOffset, _stride, 0)));
+            return Implementation::StridedBitElement<dimensions, T>::get(_data, _sizeOffset, _stride, i);
+        }
+
+        template<class U = T, unsigned dimensions_ = dimensions, typename std::enable_if<dimensions_ == 1 && !std::is_const<U>::value, int>::type = 0> void set(std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < (_sizeOffset._data[0] >> 3),
+                "Containers::StridedBitArrayView::set(): index" << i << "out of range for" << (_sizeOffset._data[0] >> 3) << "elements", );
+            const std::ptrdiff_t j = std::ptrdiff_t(_sizeOffset._data[0] & 0x07) + std::ptrdiff_t(i)*_stride._data[0];
+            _data[j >> 3] |= (1 << (j & 0x07));
+        }
+
+        template<class U = T, unsigned dimensions_ = dimensions, typename std::enable_if<dimensions_ == 1 && !std::is_const<U>::value, int>::type = 0> void reset(std::size_t i) const {
+            CORRADE_DEBUG_ASSERT(i < (_sizeOffset._data[0] >> 3),
+                "Containers::StridedBitArrayView::reset(): index" << i << "out of range for" << (_sizeOffset._data[0] >> 3) << "elements", );
+            const std::ptrdiff_t j = std::ptrdiff_t(_sizeOffset._data[0] & 0x07) + std::ptrdiff_t(i)*_stride._data[0];
+            _data[j >> 3] &= ~(1 << (j & 0x07));
+        }
+
+        template<class U = T, unsigned dimensions_ = dimensions, typename std::enable_if<dimensions_ == 1 && !std::is_const<U>::value, int>::type = 0> void set(std::size_t i, bool value) const {
+            CORRADE_DEBUG_ASSERT(i < (_sizeOffset._data[0] >> 3),
+                "Containers::StridedBitArrayView::set(): index" << i << "out of range for" << (_sizeOffset._data[0] >> 3) << "elements", );
+            const std::ptrdiff_t j = std::ptrdiff_t(_sizeOffset._data[0] & 0x07) + std::ptrdiff_t(i)*_stride._data[0];
+            char& byte = _data[j >> 3];
+            byte ^= (-char(value) ^ byte) & (1 << (j & 0x07));
+        }
+
+        BasicStridedBitArrayView<dimensions, T> slice(std::size_t begin, std::size_t end) const {
+            CORRADE_DEBUG_ASSERT(begin <= end && end <= (_sizeOffset._data[0] >> 3),
+                "Containers::StridedBitArrayView::slice(): slice [" << Utility::Debug::nospace << begin << Utility::Debug::nospace << ":" << Utility::Debug::nospace << end << Utility::Debug::nospace << "] out of range for" << (_sizeOffset._data[0] >> 3) << "elements", {});
+            const std::ptrdiff_t j = std::ptrdiff_t(_sizeOffset._data[0] & 0x07) + std::ptrdiff_t(begin)*_stride._data[0];
+            Size<dimensions> sizeOffset = _sizeOffset;
+            sizeOffset._data[0] = (end - begin) << 3 | (j & 0x07);
+            return BasicStridedBitArrayView<dimensions, T>{sizeOffset, _stride, _data + (j >> 3)};
+        }
+
+        BasicStridedBitArrayView<dimensions, T> sliceSize(std::size_t begin, std::size_t size) const {
+            return slice(begin, begin + size);
+        }
+
+        BasicStridedBitArrayView<dimensions, T> prefix(std::size_t size) const {
+            return slice(0, size);
+        }
+
+        BasicStridedBitArrayView<dimensions, T> suffix(std::size_t size) const {
+            return slice((_sizeOffset._data[0] >> 3) - size, _sizeOffset._data[0] >> 3);
+        }
+
+        BasicStridedBitArrayView<dimensions, T> exceptPrefix(std::size_t size) const {
+            return slice(size, _sizeOffset._data[0] >> 3);
+        }
+
+        BasicStridedBitArrayView<dimensions, T> exceptSuffix(std::size_t size) const {
+            return slice(0, (_sizeOffset._data[0] >> 3) - size);
+        }
+
+        BasicStridedBitArrayView<dimensions, T> every(std::size_t skip) const {
+            CORRADE_DEBUG_ASSERT(skip,
+                "Containers::StridedBitArrayView::every(): expected a non-zero value", {});
+            Size<dimensions> sizeOffset = _sizeOffset;
+            Stride<dimensions> stride = _stride;
+            sizeOffset._data[0] = (((sizeOffset._data[0] >> 3) + skip - 1)/skip) << 3 | (sizeOffset._data[0] & 0x07);
+            stride._data[0] *= skip;
+            return BasicStridedBitArrayView<dimensions, T>{sizeOffset, stride, _data};
+        }
+
+    private:
+        template<unsigned, class> friend class BasicStridedBitArrayView;
+        template<unsigned, class> friend class StridedArrayView;
+        template<unsigned, class> friend struct Implementation::StridedBitElement;
+
+        explicit BasicStridedBitArrayView(const Size<dimensions>& sizeOffset, const Stride<dimensions>& stride, ErasedType* data) noexcept: _data{static_cast<T*>(data)}, _sizeOffset{sizeOffset}, _stride{stride} {}
+
+        T* _data;
+        Size<dimensions> _sizeOffset;
+        Stride<dimensions> _stride;
+};
+
+}}
+
+#endif
+#if defined(CORRADE_BITARRAY_IMPLEMENTATION) && !defined(CorradeBitArray_hpp_implementation)
+#define CorradeBitArray_hpp_implementation
+#include <cstdint>
+#include <cstring>
+
+#include "CorradeCpu.hpp"
+
+#if defined(CORRADE_ENABLE_SSE2) || defined(CORRADE_ENABLE_AVX2)
+#include <immintrin.h>
+#endif
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__ >= 10
+#define CORRADE_UNUSED [[maybe_unused]]
+#elif defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG_CL)
+#define CORRADE_UNUSED __attribute__((__unused__))
+#elif defined(CORRADE_TARGET_MSVC)
+#define CORRADE_UNUSED __pragma(warning(suppress:4100))
+#else
+#define CORRADE_UNUSED
+#endif
+
+#define CORRADE_PASSTHROUGH(...) __VA_ARGS__
+
+#define CORRADE_NOOP(...)
+#ifndef Corrade_Utility_Implementation_cpu_h
+#define Corrade_Utility_Implementation_cpu_h
+
+#if (defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && !defined(CORRADE_CPU_USE_IFUNC))
+    #define CORRADE_UTILITY_CPU_DISPATCHER(...) CORRADE_CPU_DISPATCHER(__VA_ARGS__)
+    #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...) CORRADE_CPU_DISPATCHER_BASE(__VA_ARGS__)
+    #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)                 \
+        CORRADE_CPU_DISPATCHED_POINTER(dispatcher, __VA_ARGS__) CORRADE_NOOP
+    #define CORRADE_UTILITY_CPU_MAYBE_UNUSED
+#else
+    #if defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && defined(CORRADE_CPU_USE_IFUNC)
+        #define CORRADE_UTILITY_CPU_DISPATCHER(...)                         \
+            namespace { CORRADE_CPU_DISPATCHER(__VA_ARGS__) }
+        #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...)                    \
+            namespace { CORRADE_CPU_DISPATCHER_BASE(__VA_ARGS__) }
+        #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)             \
+            CORRADE_CPU_DISPATCHED_IFUNC(dispatcher, __VA_ARGS__) CORRADE_NOOP
+        #define CORRADE_UTILITY_CPU_MAYBE_UNUSED
+    #elif !defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH)
+        #define CORRADE_UTILITY_CPU_DISPATCHER(...)
+        #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...)
+        #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)             \
+            __VA_ARGS__ CORRADE_PASSTHROUGH
+        #define CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_UNUSED
+    #else
+    #error mosra messed up!
+    #endif
+#endif
+
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+
+namespace {
+
+inline std::size_t bitPopcount(std::uint64_t value) {
+    value = value - ((value >> 1) & 0x5555555555555555ull);
+    value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+    value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return std::size_t((value*0x0101010101010101ull) >> 56);
+}
+
+inline std::uint64_t bitLoadWord(const char* data) {
+    std::uint64_t value;
+    std::memcpy(&value, data, 8);
+    return value;
+}
+
+inline std::size_t bitCountSetBytesScalar(const char* const data, const std::size_t size) {
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8)
+        count += bitPopcount(bitLoadWord(data + i));
+    for(; i != size; ++i)
+        count += bitPopcount(static_cast<unsigned char>(data[i]));
+    return count;
+}
+
+inline std::size_t bitCountSetOutside(const char* const data, const std::size_t offset, const std::size_t end) {
+    const unsigned char* const bytes = reinterpret_cast<const unsigned char*>(data);
+    std::size_t count = bitPopcount(bytes[0] & ((1u << offset) - 1));
+    if(end & 0x07)
+        count += bitPopcount(bytes[(end - 1) >> 3] >> (end & 0x07));
+    return count;
+}
+
+inline std::size_t bitFindNonZeroByteScalar(const char* const data, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8)
+        if(bitLoadWord(data + i)) break;
+    for(; i != size; ++i)
+        if(data[i]) break;
+    return i;
+}
+
+inline std::size_t bitFindFirstSetIn(const char* const data, const std::size_t offset, const std::size_t size, const std::size_t byte) {
+    if(byte == (offset + size + 7) >> 3) return size;
+    unsigned value = static_cast<unsigned char>(data[byte]);
+    if(!byte) value &= 0xffu << offset;
+    std::size_t bit = byte*8 - offset;
+    while(!(value & 1)) {
+        value >>= 1;
+        ++bit;
+    }
+    return bit < size ? bit : size;
+}
+
+}
+
+namespace {
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_POPCNT) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX2,POPCNT) typename std::decay<decltype(bitCountSet)>::type bitCountSetImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2|Cpu::Popcnt)) {
+  return [](const char* const data, const std::size_t offset, const std::size_t size) CORRADE_ENABLE(AVX2,POPCNT) -> std::size_t {
+    if(!size) return 0;
+    const std::size_t end = offset + size;
+    const std::size_t bytes = (end + 7) >> 3;
+
+    const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i lowNibble = _mm256_set1_epi8(0x0f);
+    __m256i total = _mm256_setzero_si256();
+    std::size_t i = 0;
+    while(i + 4*32 <= bytes) {
+        __m256i localA = _mm256_setzero_si256();
+        __m256i localB = _mm256_setzero_si256();
+        for(std::size_t blockEnd = i + 15*4*32; i + 4*32 <= bytes && i != blockEnd; i += 4*32) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 0);
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 1);
+            const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 2);
+            const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 3);
+            localA = _mm256_add_epi8(localA, _mm256_add_epi8(
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(a, lowNibble)),
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(a, 4), lowNibble))));
+            localB = _mm256_add_epi8(localB, _mm256_add_epi8(
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(b, lowNibble)),
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(b, 4), lowNibble))));
+            localA = _mm256_add_epi8(localA, _mm256_add_epi8(
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(c, lowNibble)),
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(c, 4), lowNibble))));
+            localB = _mm256_add_epi8(localB, _mm256_add_epi8(
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(d, lowNibble)),
+                _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(d, 4), lowNibble))));
+        }
+        total = _mm256_add_epi64(total, _mm256_add_epi64(
+            _mm256_sad_epu8(localA, _mm256_setzero_si256()),
+            _mm256_sad_epu8(localB, _mm256_setzero_si256())));
+    }
+
+    std::uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), total);
+    std::size_t count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for(; i + 8 <= bytes; i += 8)
+        count += _mm_popcnt_u64(bitLoadWord(data + i));
+    for(; i != bytes; ++i)
+        count += _mm_popcnt_u32(static_cast<unsigned char>(data[i]));
+    return count - bitCountSetOutside(data, offset, end);
+  };
+}
+#endif
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_POPCNT) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(SSE2,POPCNT) typename std::decay<decltype(bitCountSet)>::type bitCountSetImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2|Cpu::Popcnt)) {
+  return [](const char* const data, const std::size_t offset, const std::size_t size) CORRADE_ENABLE(SSE2,POPCNT) -> std::size_t {
+    if(!size) return 0;
+    const std::size_t end = offset + size;
+    const std::size_t bytes = (end + 7) >> 3;
+
+    std::uint64_t a = 0, b = 0, c = 0, d = 0;
+    std::size_t i = 0;
+    for(; i + 4*8 <= bytes; i += 4*8) {
+        a += _mm_popcnt_u64(bitLoadWord(data + i + 0*8));
+        b += _mm_popcnt_u64(bitLoadWord(data + i + 1*8));
+        c += _mm_popcnt_u64(bitLoadWord(data + i + 2*8));
+        d += _mm_popcnt_u64(bitLoadWord(data + i + 3*8));
+    }
+    for(; i + 8 <= bytes; i += 8)
+        a += _mm_popcnt_u64(bitLoadWord(data + i));
+    for(; i != bytes; ++i)
+        b += _mm_popcnt_u32(static_cast<unsigned char>(data[i]));
+    return a + b + c + d - bitCountSetOutside(data, offset, end);
+  };
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(bitCountSet)>::type bitCountSetImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+  return [](const char* const data, const std::size_t offset, const std::size_t size) -> std::size_t {
+    if(!size) return 0;
+    const std::size_t end = offset + size;
+    return bitCountSetBytesScalar(data, (end + 7) >> 3) - bitCountSetOutside(data, offset, end);
+  };
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(bitCountSetImplementation, Cpu::Popcnt)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(bitCountSetImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(bitCountSetImplementation, std::size_t CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitCountSet)(const char* data, std::size_t offset, std::size_t size))({
+    return bitCountSetImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, offset, size);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_BMI1)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX2,BMI1) typename std::decay<decltype(bitFindFirstSet)>::type bitFindFirstSetImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2|Cpu::Bmi1)) {
+  return [](const char* const data, const std::size_t offset, const std::size_t size) CORRADE_ENABLE(AVX2,BMI1) -> std::size_t {
+    if(!size) return 0;
+    const std::size_t bytes = (offset + size + 7) >> 3;
+    if(static_cast<unsigned char>(data[0]) >> offset || bytes < 1 + 32)
+        return bitFindFirstSetIn(data, offset, size, static_cast<unsigned char>(data[0]) >> offset ? 0 : 1 + bitFindNonZeroByteScalar(data + 1, bytes - 1));
+
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t i = 1;
+    for(; i + 4*32 <= bytes; i += 4*32) {
+        const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 0);
+        const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 1);
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 2);
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i) + 3);
+        const __m256i any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if(!_mm256_testz_si256(any, any)) break;
+    }
+    for(;; i += 32) {
+        if(i + 32 > bytes) i = bytes - 32;
+        const std::uint32_t mask = ~std::uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), zero)));
+        if(mask) return bitFindFirstSetIn(data, offset, size, i + _tzcnt_u32(mask));
+        if(i + 32 == bytes) return size;
+    }
+  };
+}
+#endif
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI1)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(SSE2,BMI1) typename std::decay<decltype(bitFindFirstSet)>::type bitFindFirstSetImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2|Cpu::Bmi1)) {
+  return [](const char* const data, const std::size_t offset, const std::size_t size) CORRADE_ENABLE(SSE2,BMI1) -> std::size_t {
+    if(!size) return 0;
+    const std::size_t bytes = (offset + size + 7) >> 3;
+    if(static_cast<unsigned char>(data[0]) >> offset || bytes < 1 + 16)
+        return bitFindFirstSetIn(data, offset, size, static_cast<unsigned char>(data[0]) >> offset ? 0 : 1 + bitFindNonZeroByteScalar(data + 1, bytes - 1));
+
+    const __m128i zero = _mm_setzero_si128();
+    std::size_t i = 1;
+    for(; i + 4*16 <= bytes; i += 4*16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i) + 0);
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i) + 1);
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i) + 2);
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i) + 3);
+        const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if(_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xffff) break;
+    }
+    for(;; i += 16) {
+        if(i + 16 > bytes) i = bytes - 16;
+        const std::uint32_t mask = ~std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), zero))) & 0xffff;
+        if(mask) return bitFindFirstSetIn(data, offset, size, i + _tzcnt_u32(mask));
+        if(i + 16 == bytes) return size;
+    }
+  };
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(bitFindFirstSet)>::type bitFindFirstSetImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+  return [](const char* const data, const std::size_t offset, const std::size_t size) -> std::size_t {
+    if(!size) return 0;
+    if(static_cast<unsigned char>(data[0]) >> offset)
+        return bitFindFirstSetIn(data, offset, size, 0);
+    return bitFindFirstSetIn(data, offset, size, 1 + bitFindNonZeroByteScalar(data + 1, ((offset + size + 7) >> 3) - 1));
+  };
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(bitFindFirstSetImplementation, Cpu::Bmi1)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(bitFindFirstSetImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(bitFindFirstSetImplementation, std::size_t CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitFindFirstSet)(const char* data, std::size_t offset, std::size_t size))({
+    return bitFindFirstSetImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, offset, size);
+})
+
+void bitSetAll(char* const data, const std::size_t offset, const std::size_t size, const bool value) {
+    if(!size) return;
+    unsigned char* const bytes = reinterpret_cast<unsigned char*>(data);
+    const std::size_t end = offset + size;
+    if(end <= 8) {
+        const unsigned mask = ((1u << size) - 1) << offset;
+        bytes[0] = value ? bytes[0] | mask : bytes[0] & ~mask;
+        return;
+    }
+
+    std::size_t begin = 0;
+    if(offset) {
+        const unsigned mask = 0xffu << offset;
+        bytes[0] = value ? bytes[0] | mask : bytes[0] & ~mask;
+        begin = 1;
+    }
+    std::memset(bytes + begin, value ? 0xff : 0x00, (end >> 3) - begin);
+    if(end & 0x07) {
+        const unsigned mask = (1u << (end & 0x07)) - 1;
+        bytes[end >> 3] = value ? bytes[end >> 3] | mask : bytes[end >> 3] & ~mask;
+    }
+}
+
+struct BitwiseAnd {
+    static std::uint64_t scalar(std::uint64_t a, std::uint64_t b) { return a & b; }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 static __m128i sse2(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 static __m256i avx2(__m256i a, __m256i b) { return _mm256_and_si256(a, b); }
+    #endif
+};
+
+struct BitwiseOr {
+    static std::uint64_t scalar(std::uint64_t a, std::uint64_t b) { return a | b; }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 static __m128i sse2(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 static __m256i avx2(__m256i a, __m256i b) { return _mm256_or_si256(a, b); }
+    #endif
+};
+
+struct BitwiseXor {
+    static std::uint64_t scalar(std::uint64_t a, std::uint64_t b) { return a ^ b; }
+    #ifdef CORRADE_ENABLE_SSE2
+    CORRADE_ENABLE_SSE2 static __m128i sse2(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+    #endif
+    #ifdef CORRADE_ENABLE_AVX2
+    CORRADE_ENABLE_AVX2 static __m256i avx2(__m256i a, __m256i b) { return _mm256_xor_si256(a, b); }
+    #endif
+};
+
+typedef void(*BitwiseIntoFunction)(const char*, const char*, char*, std::size_t);
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitwiseAndInto)(const char* a, const char* b, char* dst, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitwiseOrInto)(const char* a, const char* b, char* dst, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitwiseXorInto)(const char* a, const char* b, char* dst, std::size_t size);
+
+namespace {
+
+template<class Op> void bitwiseIntoScalar(const char* const a, const char* const b, char* const dst, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 8 <= size; i += 8) {
+        const std::uint64_t value = Op::scalar(bitLoadWord(a + i), bitLoadWord(b + i));
+        std::memcpy(dst + i, &value, 8);
+    }
+    for(; i != size; ++i)
+        dst[i] = char(Op::scalar(static_cast<unsigned char>(a[i]), static_cast<unsigned char>(b[i])));
+}
+
+#ifdef CORRADE_ENABLE_AVX2
+template<class Op> CORRADE_ENABLE_AVX2 void bitwiseIntoAvx2(const char* const a, const char* const b, char* const dst, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 4*32 <= size; i += 4*32) {
+        const __m256i* const ai = reinterpret_cast<const __m256i*>(a + i);
+        const __m256i* const bi = reinterpret_cast<const __m256i*>(b + i);
+        __m256i* const dsti = reinterpret_cast<__m256i*>(dst + i);
+        const __m256i x = Op::avx2(_mm256_loadu_si256(ai + 0), _mm256_loadu_si256(bi + 0));
+        const __m256i y = Op::avx2(_mm256_loadu_si256(ai + 1), _mm256_loadu_si256(bi + 1));
+        const __m256i z = Op::avx2(_mm256_loadu_si256(ai + 2), _mm256_loadu_si256(bi + 2));
+        const __m256i w = Op::avx2(_mm256_loadu_si256(ai + 3), _mm256_loadu_si256(bi + 3));
+        _mm256_storeu_si256(dsti + 0, x);
+        _mm256_storeu_si256(dsti + 1, y);
+        _mm256_storeu_si256(dsti + 2, z);
+        _mm256_storeu_si256(dsti + 3, w);
+    }
+    for(; i + 32 <= size; i += 32)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::avx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i))));
+    bitwiseIntoScalar<Op>(a + i, b + i, dst + i, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class Op> CORRADE_ENABLE_SSE2 void bitwiseIntoSse2(const char* const a, const char* const b, char* const dst, const std::size_t size) {
+    std::size_t i = 0;
+    for(; i + 4*16 <= size; i += 4*16) {
+        const __m128i* const ai = reinterpret_cast<const __m128i*>(a + i);
+        const __m128i* const bi = reinterpret_cast<const __m128i*>(b + i);
+        __m128i* const dsti = reinterpret_cast<__m128i*>(dst + i);
+        const __m128i x = Op::sse2(_mm_loadu_si128(ai + 0), _mm_loadu_si128(bi + 0));
+        const __m128i y = Op::sse2(_mm_loadu_si128(ai + 1), _mm_loadu_si128(bi + 1));
+        const __m128i z = Op::sse2(_mm_loadu_si128(ai + 2), _mm_loadu_si128(bi + 2));
+        const __m128i w = Op::sse2(_mm_loadu_si128(ai + 3), _mm_loadu_si128(bi + 3));
+        _mm_storeu_si128(dsti + 0, x);
+        _mm_storeu_si128(dsti + 1, y);
+        _mm_storeu_si128(dsti + 2, z);
+        _mm_storeu_si128(dsti + 3, w);
+    }
+    for(; i + 16 <= size; i += 16)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::sse2(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i))));
+    bitwiseIntoScalar<Op>(a + i, b + i, dst + i, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(bitwiseAndInto)>::type bitwiseAndIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return bitwiseIntoAvx2<BitwiseAnd>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(bitwiseAndInto)>::type bitwiseAndIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return bitwiseIntoSse2<BitwiseAnd>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(bitwiseAndInto)>::type bitwiseAndIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return bitwiseIntoScalar<BitwiseAnd>;
+}
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(bitwiseOrInto)>::type bitwiseOrIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return bitwiseIntoAvx2<BitwiseOr>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(bitwiseOrInto)>::type bitwiseOrIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return bitwiseIntoSse2<BitwiseOr>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(bitwiseOrInto)>::type bitwiseOrIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return bitwiseIntoScalar<BitwiseOr>;
+}
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(bitwiseXorInto)>::type bitwiseXorIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return bitwiseIntoAvx2<BitwiseXor>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(bitwiseXorInto)>::type bitwiseXorIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return bitwiseIntoSse2<BitwiseXor>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(bitwiseXorInto)>::type bitwiseXorIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return bitwiseIntoScalar<BitwiseXor>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(bitwiseAndIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(bitwiseAndIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitwiseAndInto)(const char* a, const char* b, char* dst, std::size_t size))({
+    bitwiseAndIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, b, dst, size);
+})
+
+CORRADE_UTILITY_CPU_DISPATCHER(bitwiseOrIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(bitwiseOrIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitwiseOrInto)(const char* a, const char* b, char* dst, std::size_t size))({
+    bitwiseOrIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, b, dst, size);
+})
+
+CORRADE_UTILITY_CPU_DISPATCHER(bitwiseXorIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(bitwiseXorIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(bitwiseXorInto)(const char* a, const char* b, char* dst, std::size_t size))({
+    bitwiseXorIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, b, dst, size);
+})
+
+namespace {
+
+inline unsigned bitReadByte(const char* const data, const std::size_t position, const std::size_t count) {
+    const unsigned char* const bytes = reinterpret_cast<const unsigned char*>(data);
+    unsigned value = bytes[position >> 3] >> (position & 0x07);
+    if((position & 0x07) + count > 8)
+        value |= unsigned(bytes[(position >> 3) + 1]) << (8 - (position & 0x07));
+    return value;
+}
+
+template<class Op> void bitwiseIntoUnaligned(const char* const a, const std::size_t aOffset, const char* const b, const std::size_t bOffset, char* const dst, const std::size_t dstOffset, const std::size_t size) {
+    unsigned char* const bytes = reinterpret_cast<unsigned char*>(dst);
+    for(std::size_t i = 0; i < size; ) {
+        const std::size_t position = dstOffset + i;
+        const std::size_t count = Utility::min(8 - (position & 0x07), size - i);
+        const unsigned mask = ((1u << count) - 1) << (position & 0x07);
+        const unsigned value = unsigned(Op::scalar(bitReadByte(a, aOffset + i, count), bitReadByte(b, bOffset + i, count))) << (position & 0x07);
+        unsigned char& out = bytes[position >> 3];
+        out = (out & ~mask) | (value & mask);
+        i += count;
+    }
+}
+
+template<class Op> void bitwiseInto(const BitwiseIntoFunction function, const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst) {
+    const char* const aData = static_cast<const char*>(a.data());
+    const char* const bData = static_cast<const char*>(b.data());
+    char* const dstData = static_cast<char*>(dst.data());
+    const std::size_t offset = dst.offset();
+    const std::size_t size = dst.size();
+    if(a.offset() != offset || b.offset() != offset) {
+        bitwiseIntoUnaligned<Op>(aData, a.offset(), bData, b.offset(), dstData, offset, size);
+        return;
+    }
+
+    const std::size_t head = offset ? Utility::min(8 - offset, size) : 0;
+    bitwiseIntoUnaligned<Op>(aData, offset, bData, offset, dstData, offset, head);
+    const std::size_t begin = (offset + head) >> 3;
+    const std::size_t bytes = (size - head) >> 3;
+    function(aData + begin, bData + begin, dstData + begin, bytes);
+    bitwiseIntoUnaligned<Op>(aData + begin + bytes, 0, bData + begin + bytes, 0, dstData + begin + bytes, 0, (size - head) & 0x07);
+}
+
+}
+
+}
+
+void bitAndInto(const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst) {
+    CORRADE_ASSERT(a.size() == dst.size() && b.size() == dst.size(),
+        "Containers::bitAndInto(): expected sizes to match, got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << dst.size(), );
+    Implementation::bitwiseInto<Implementation::BitwiseAnd>(Implementation::bitwiseAndInto, a, b, dst);
+}
+
+void bitOrInto(const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst) {
+    CORRADE_ASSERT(a.size() == dst.size() && b.size() == dst.size(),
+        "Containers::bitOrInto(): expected sizes to match, got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << dst.size(), );
+    Implementation::bitwiseInto<Implementation::BitwiseOr>(Implementation::bitwiseOrInto, a, b, dst);
+}
+
+void bitXorInto(const BitArrayView& a, const BitArrayView& b, const MutableBitArrayView& dst) {
+    CORRADE_ASSERT(a.size() == dst.size() && b.size() == dst.size(),
+        "Containers::bitXorInto(): expected sizes to match, got" << a.size() << Utility::Debug::nospace << "," << b.size() << "and" << dst.size(), );
+    Implementation::bitwiseInto<Implementation::BitwiseXor>(Implementation::bitwiseXorInto, a, b, dst);
+}
+
+BitArray::BitArray(Corrade::ValueInitT, const std::size_t size): _data{size ? new char[(size + 7) >> 3]() : nullptr}, _sizeOffset{size << 3}, _deleter{} {
+    CORRADE_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - 3),
+        "Containers::BitArray: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - 3) << "bits, got" << size, );
+}
+
+BitArray::BitArray(Corrade::NoInitT, const std::size_t size): _data{size ? new char[(size + 7) >> 3] : nullptr}, _sizeOffset{size << 3}, _deleter{} {
+    CORRADE_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - 3),
+        "Containers::BitArray: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - 3) << "bits, got" << size, );
+}
+
+BitArray::BitArray(Corrade::DirectInitT, const std::size_t size, const bool value): BitArray{Corrade::NoInit, size} {
+    if(size) std::memset(_data, value ? 0xff : 0x00, (size + 7) >> 3);
+}
+
+BitArray::BitArray(void* const data, const std::size_t offset, const std::size_t size, const Deleter deleter) noexcept: _data{static_cast<char*>(data)}, _sizeOffset{size << 3 | offset}, _deleter{deleter} {
+    CORRADE_DEBUG_ASSERT(offset < 8,
+        "Containers::BitArray: offset expected to be smaller than 8 bits, got" << offset, );
+    CORRADE_DEBUG_ASSERT(size < std::size_t{1} << (sizeof(std::size_t)*8 - 3),
+        "Containers::BitArray: size expected to be smaller than 2^" << Utility::Debug::nospace << (sizeof(std::size_t)*8 - 3) << "bits, got" << size, );
+}
+
+BitArray::BitArray(BitArray&& other) noexcept: _data{other._data}, _sizeOffset{other._sizeOffset}, _deleter{other._deleter} {
+    other._data = nullptr;
+    other._sizeOffset = 0;
+    other._deleter = nullptr;
+}
+
+BitArray::~BitArray() {
+    if(_deleter) _deleter(_data, ((_sizeOffset >> 3) + (_sizeOffset & 0x07) + 7) >> 3);
+    else delete[] _data;
+}
+
+BitArray& BitArray::operator=(BitArray&& other) noexcept {
+    Utility::swap(_data, other._data);
+    Utility::swap(_sizeOffset, other._sizeOffset);
+    Utility::swap(_deleter, other._deleter);
+    return *this;
+}
+
+char* BitArray::release() {
+    char* const data = _data;
+    _data = nullptr;
+    _sizeOffset = 0;
+    _deleter = nullptr;
+    return data;
+}
+
+}}
+#endif
@@ -126,9 +126,10 @@
     v2019.01-241-g93686746a (2019-04-03)
     -   Initial release
 
-    Generated from Corrade v2020.06-1890-g77f9f (2025-04-11),
+    Based on a file generated from Corrade v2020.06-1890-g77f9f (2025-04-11),
         Magnum v2020.06-3290-g454e9 (2025-04-11) and
-        Magnum Integration v2020.06-291-g1a42d (2025-03-04), 8496 / 9985 LoC
+        Magnum Integration v2020.06-291-g1a42d (2025-03-04), with local
+        additions that aren't upstream, 8699 / 10020 LoC
 */
 
 /*
@@ -204,6 +205,18 @@
 #ifdef _MSC_VER
 #define CORRADE_TARGET_MSVC
 #endif
+#if defined(__i386) || defined(__x86_64) || defined(_M_IX86) || defined(_M_X64)
+#define CORRADE_TARGET_X86
+#endif
+#if !defined(__x86_64) && !defined(_M_X64) && !defined(__aarch64__) && !defined(_M_ARM64) && !defined(__powerpc64__) && !defined(__wasm64__)
+#define CORRADE_TARGET_32BIT
+#endif
+#if defined(CORRADE_TARGET_X86) && ((defined(CORRADE_TARGET_GCC) && defined(__F16C__)) || (defined(CORRADE_TARGET_MSVC) && defined(__AVX2__) && (!defined(CORRADE_TARGET_CLANG_CL) || defined(__F16C__))))
+#define CORRADE_TARGET_AVX_F16C
+#endif
+#if defined(CORRADE_TARGET_X86) && ((defined(CORRADE_TARGET_GCC) && defined(__BMI2__)) || (defined(CORRADE_TARGET_MSVC) && defined(__AVX2__) && (!defined(CORRADE_TARGET_CLANG_CL) || defined(__BMI2__))))
+#define CORRADE_TARGET_BMI2
+#endif
 #if defined(CORRADE_TARGET_MSVC) || (defined(CORRADE_TARGET_ANDROID) && !__LP64__) || defined(CORRADE_TARGET_EMSCRIPTEN) || (defined(CORRADE_TARGET_APPLE) && !defined(CORRADE_TARGET_IOS) && defined(CORRADE_TARGET_ARM))
 #define CORRADE_LONG_DOUBLE_SAME_AS_DOUBLE
 #endif
@@ -3797,6 +3810,116 @@ MAGNUM_VECTORn_OPERATOR_IMPLEMENTATION(3, Vector3)
 
 }}
 
+#endif
+#ifndef Magnum_Math_Morton_h
+#define Magnum_Math_Morton_h
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+    template<class> struct MortonCode;
+    template<> struct MortonCode<Vector2<UnsignedShort>> { typedef UnsignedInt Type; };
+    template<> struct MortonCode<Vector2<UnsignedInt>> { typedef UnsignedLong Type; };
+    template<> struct MortonCode<Vector3<UnsignedShort>> { typedef UnsignedInt Type; };
+    template<> struct MortonCode<Vector3<UnsignedInt>> { typedef UnsignedLong Type; };
+
+    inline UnsignedInt mortonSpread2(UnsignedInt value) {
+        value &= 0x0000ffffu;
+        value = (value | (value << 8)) & 0x00ff00ffu;
+        value = (value | (value << 4)) & 0x0f0f0f0fu;
+        value = (value | (value << 2)) & 0x33333333u;
+        value = (value | (value << 1)) & 0x55555555u;
+        return value;
+    }
+
+    inline UnsignedLong mortonSpread2(UnsignedLong value) {
+        value &= 0x00000000ffffffffull;
+        value = (value | (value << 16)) & 0x0000ffff0000ffffull;
+        value = (value | (value << 8)) & 0x00ff00ff00ff00ffull;
+        value = (value | (value << 4)) & 0x0f0f0f0f0f0f0f0full;
+        value = (value | (value << 2)) & 0x3333333333333333ull;
+        value = (value | (value << 1)) & 0x5555555555555555ull;
+        return value;
+    }
+
+    inline UnsignedInt mortonCompact2(UnsignedInt value) {
+        value &= 0x55555555u;
+        value = (value | (value >> 1)) & 0x33333333u;
+        value = (value | (value >> 2)) & 0x0f0f0f0fu;
+        value = (value | (value >> 4)) & 0x00ff00ffu;
+        value = (value | (value >> 8)) & 0x0000ffffu;
+        return value;
+    }
+
+    inline UnsignedLong mortonCompact2(UnsignedLong value) {
+        value &= 0x5555555555555555ull;
+        value = (value | (value >> 1)) & 0x3333333333333333ull;
+        value = (value | (value >> 2)) & 0x0f0f0f0f0f0f0f0full;
+        value = (value | (value >> 4)) & 0x00ff00ff00ff00ffull;
+        value = (value | (value >> 8)) & 0x0000ffff0000ffffull;
+        value = (value | (value >> 16)) & 0x00000000ffffffffull;
+        return value;
+    }
+
+    inline UnsignedInt mortonSpread3(UnsignedInt value) {
+        value &= 0x000003ffu;
+        value = (value | (value << 16)) & 0x030000ffu;
+        value = (value | (value << 8)) & 0x0300f00fu;
+        value = (value | (value << 4)) & 0x030c30c3u;
+        value = (value | (value << 2)) & 0x09249249u;
+        return value;
+    }
+
+    inline UnsignedLong mortonSpread3(UnsignedLong value) {
+        value &= 0x00000000001fffffull;
+        value = (value | (value << 32)) & 0x001f00000000ffffull;
+        value = (value | (value << 16)) & 0x001f0000ff0000ffull;
+        value = (value | (value << 8)) & 0x100f00f00f00f00full;
+        value = (value | (value << 4)) & 0x10c30c30c30c30c3ull;
+        value = (value | (value << 2)) & 0x1249249249249249ull;
+        return value;
+    }
+
+    inline UnsignedInt mortonCompact3(UnsignedInt value) {
+        value &= 0x09249249u;
+        value = (value | (value >> 2)) & 0x030c30c3u;
+        value = (value | (value >> 4)) & 0x0300f00fu;
+        value = (value | (value >> 8)) & 0x030000ffu;
+        value = (value | (value >> 16)) & 0x000003ffu;
+        return value;
+    }
+
+    inline UnsignedLong mortonCompact3(UnsignedLong value) {
+        value &= 0x1249249249249249ull;
+        value = (value | (value >> 2)) & 0x10c30c30c30c30c3ull;
+        value = (value | (value >> 4)) & 0x100f00f00f00f00full;
+        value = (value | (value >> 8)) & 0x001f0000ff0000ffull;
+        value = (value | (value >> 16)) & 0x001f00000000ffffull;
+        value = (value | (value >> 32)) & 0x00000000001fffffull;
+        return value;
+    }
+}
+
+MAGNUM_EXPORT UnsignedInt mortonEncode(const Vector2<UnsignedShort>& value);
+
+MAGNUM_EXPORT UnsignedLong mortonEncode(const Vector2<UnsignedInt>& value);
+
+MAGNUM_EXPORT UnsignedInt mortonEncode(const Vector3<UnsignedShort>& value);
+
+MAGNUM_EXPORT UnsignedLong mortonEncode(const Vector3<UnsignedInt>& value);
+
+template<class T> T mortonDecode(typename Implementation::MortonCode<T>::Type code);
+
+template<> MAGNUM_EXPORT Vector2<UnsignedShort> mortonDecode<Vector2<UnsignedShort>>(UnsignedInt code);
+
+template<> MAGNUM_EXPORT Vector2<UnsignedInt> mortonDecode<Vector2<UnsignedInt>>(UnsignedLong code);
+
+template<> MAGNUM_EXPORT Vector3<UnsignedShort> mortonDecode<Vector3<UnsignedShort>>(UnsignedInt code);
+
+template<> MAGNUM_EXPORT Vector3<UnsignedInt> mortonDecode<Vector3<UnsignedInt>>(UnsignedLong code);
+
+}}
+
 #endif
 #ifndef Magnum_Math_Vector4_h
 #define Magnum_Math_Vector4_h
@@ -8370,6 +8493,10 @@ template<class To, class T> inline To cast(const Math::Quaternion<T>& from) {
 #endif
 #if defined(MAGNUM_MATH_IMPLEMENTATION) && !defined(MagnumMath_hpp_implementation)
 #define MagnumMath_hpp_implementation
+#if defined(CORRADE_TARGET_AVX_F16C) || defined(CORRADE_TARGET_BMI2)
+#include <immintrin.h>
+#endif
+
 namespace Magnum { namespace Math {
 
 #if !defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
@@ -8427,6 +8554,70 @@ UnsignedLong binomialCoefficient(const UnsignedInt n, UnsignedInt k) {
     return result;
 }
 
+UnsignedInt mortonEncode(const Vector2<UnsignedShort>& value) {
+    #ifdef CORRADE_TARGET_BMI2
+    return _pdep_u32(value.x(), 0x55555555u)|_pdep_u32(value.y(), 0xaaaaaaaau);
+    #else
+    return Implementation::mortonSpread2(UnsignedInt(value.x()))|(Implementation::mortonSpread2(UnsignedInt(value.y())) << 1);
+    #endif
+}
+
+UnsignedLong mortonEncode(const Vector2<UnsignedInt>& value) {
+    #if defined(CORRADE_TARGET_BMI2) && !defined(CORRADE_TARGET_32BIT)
+    return _pdep_u64(value.x(), 0x5555555555555555ull)|_pdep_u64(value.y(), 0xaaaaaaaaaaaaaaaaull);
+    #else
+    return Implementation::mortonSpread2(UnsignedLong(value.x()))|(Implementation::mortonSpread2(UnsignedLong(value.y())) << 1);
+    #endif
+}
+
+UnsignedInt mortonEncode(const Vector3<UnsignedShort>& value) {
+    #ifdef CORRADE_TARGET_BMI2
+    return _pdep_u32(value.x(), 0x09249249u)|_pdep_u32(value.y(), 0x12492492u)|_pdep_u32(value.z(), 0x24924924u);
+    #else
+    return Implementation::mortonSpread3(UnsignedInt(value.x()))|(Implementation::mortonSpread3(UnsignedInt(value.y())) << 1)|(Implementation::mortonSpread3(UnsignedInt(value.z())) << 2);
+    #endif
+}
+
+UnsignedLong mortonEncode(const Vector3<UnsignedInt>& value) {
+    #if defined(CORRADE_TARGET_BMI2) && !defined(CORRADE_TARGET_32BIT)
+    return _pdep_u64(value.x(), 0x1249249249249249ull)|_pdep_u64(value.y(), 0x2492492492492492ull)|_pdep_u64(value.z(), 0x4924924924924924ull);
+    #else
+    return Implementation::mortonSpread3(UnsignedLong(value.x()))|(Implementation::mortonSpread3(UnsignedLong(value.y())) << 1)|(Implementation::mortonSpread3(UnsignedLong(value.z())) << 2);
+    #endif
+}
+
+template<> Vector2<UnsignedShort> mortonDecode<Vector2<UnsignedShort>>(const UnsignedInt code) {
+    #ifdef CORRADE_TARGET_BMI2
+    return {UnsignedShort(_pext_u32(code, 0x55555555u)), UnsignedShort(_pext_u32(code, 0xaaaaaaaau))};
+    #else
+    return {UnsignedShort(Implementation::mortonCompact2(code)), UnsignedShort(Implementation::mortonCompact2(code >> 1))};
+    #endif
+}
+
+template<> Vector2<UnsignedInt> mortonDecode<Vector2<UnsignedInt>>(const UnsignedLong code) {
+    #if defined(CORRADE_TARGET_BMI2) && !defined(CORRADE_TARGET_32BIT)
+    return {UnsignedInt(_pext_u64(code, 0x5555555555555555ull)), UnsignedInt(_pext_u64(code, 0xaaaaaaaaaaaaaaaaull))};
+    #else
+    return {UnsignedInt(Implementation::mortonCompact2(code)), UnsignedInt(Implementation::mortonCompact2(code >> 1))};
+    #endif
+}
+
+template<> Vector3<UnsignedShort> mortonDecode<Vector3<UnsignedShort>>(const UnsignedInt code) {
+    #ifdef CORRADE_TARGET_BMI2
+    return {UnsignedShort(_pext_u32(code, 0x09249249u)), UnsignedShort(_pext_u32(code, 0x12492492u)), UnsignedShort(_pext_u32(code, 0x24924924u))};
+    #else
+    return {UnsignedShort(Implementation::mortonCompact3(code)), UnsignedShort(Implementation::mortonCompact3(code >> 1)), UnsignedShort(Implementation::mortonCompact3(code >> 2))};
+    #endif
+}
+
+template<> Vector3<UnsignedInt> mortonDecode<Vector3<UnsignedInt>>(const UnsignedLong code) {
+    #if defined(CORRADE_TARGET_BMI2) && !defined(CORRADE_TARGET_32BIT)
+    return {UnsignedInt(_pext_u64(code, 0x1249249249249249ull)), UnsignedInt(_pext_u64(code, 0x2492492492492492ull)), UnsignedInt(_pext_u64(code, 0x4924924924924924ull))};
+    #else
+    return {UnsignedInt(Implementation::mortonCompact3(code)), UnsignedInt(Implementation::mortonCompact3(code >> 1)), UnsignedInt(Implementation::mortonCompact3(code >> 2))};
+    #endif
+}
+
 }}
 namespace Magnum { namespace Math {
 
@@ -8440,6 +8631,11 @@ union FloatBits {
 }
 
 Float unpackHalf(const UnsignedShort value) {
+    #ifdef CORRADE_TARGET_AVX_F16C
+    if((value & 0x7c00) != 0x7c00)
+        return _cvtsh_ss(value);
+    #endif
+
     constexpr const FloatBits Magic{113 << 23};
     constexpr const UnsignedInt ShiftedExp = 0x7c00 << 13;
 
@@ -8470,6 +8666,13 @@ UnsignedShort packHalf(const Float value) {
 
     FloatBits f;
     f.f = value;
+
+    #ifdef CORRADE_TARGET_AVX_F16C
+    const UnsignedInt magnitude = f.u & ~SignMask;
+    if(magnitude - 0x38800000u < 0x47800000u - 0x38800000u)
+        return _cvtss_sh(value, _MM_FROUND_TO_NEAREST_INT) + ((magnitude & 0x3fff) == 0x1000);
+    #endif
+
     UnsignedShort h;
 
     const UnsignedInt sign = f.u & SignMask;
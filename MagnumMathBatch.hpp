@@ -4,7 +4,8 @@
 
     https://doc.magnum.graphics/magnum/namespaceMagnum_1_1Math.html
 
-    Depends on ContainersStridedArrayView.h and MagnumMath.hpp.
+    Depends on CorradeStridedArrayView.h and MagnumMath.hpp, the
+    implementation depends on CorradeBitArray.hpp and CorradeCpu.hpp.
 
     This is a single-header library generated from the Magnum project. With the
     goal being easy integration, it's deliberately free of all comments to keep
@@ -22,7 +23,23 @@
         #include <MagnumMathBatch.hpp>
 
     If you need the deinlined symbols to be exported from a shared library,
-    `#define MAGNUM_EXPORT` as appropriate.
+    `#define MAGNUM_EXPORT` as appropriate. Runtime CPU dispatch for the
+    implementation is enabled by default, you can disable it with
+    `#define CORRADE_NO_CPU_RUNTIME_DISPATCH` before including the file. To
+    enable the IFUNC functionality for CPU runtime dispatch,
+    `#define CORRADE_CPU_USE_IFUNC`.
+
+    The batch functions don't spawn any threads and keep no global state, so
+    calls on disjoint data can run in parallel. To parallelize per-item
+    operations such as skinning, slice all views to the same subrange in each
+    of your threads.
+
+    The float-to-float `fromSrgbInto()` and `toSrgbInto()` use a vectorized
+    approximation, which is within 14 and 9 ULP, respectively, of a
+    double-precision reference for all inputs in [0, 1]. The 8-bit output
+    of `toSrgbInto()` differs from `pack(Color3::toSrgb())` by at most one,
+    for 185 (SSE4.1) or 280 (FMA) of the 1.06 billion inputs. The 8-bit input
+    of `fromSrgbInto()` is bit-exact with `Color3::fromSrgb()`.
 
     v2020.06-3290-g454e9 (2025-04-11)
     -   Include guard for the implementation part to prevent double definitions
@@ -31,8 +48,9 @@
     v2020.06-3128-g47b22 (2025-01-07)
     -   Initial release
 
-    Generated from Corrade v2020.06-1890-g77f9f (2025-04-11) and
-        Magnum v2020.06-3290-g454e9 (2025-04-11), 1323 / 11405 LoC
+    Based on a file generated from Corrade v2020.06-1890-g77f9f (2025-04-11)
+        and Magnum v2020.06-3290-g454e9 (2025-04-11), with local additions
+        that aren't upstream, 13028 / 11808 LoC
 */
 
 /*
@@ -70,6 +88,12 @@
 #ifndef Magnum_Math_FunctionsBatch_h
 #define Magnum_Math_FunctionsBatch_h
 
+namespace Corrade { namespace Containers {
+
+typedef BasicStridedBitArrayView<1, char> MutableStridedBitArrayView1D;
+
+}}
+
 namespace Magnum { namespace Math {
 
 namespace Implementation {
@@ -104,6 +128,29 @@ template<class T, std::size_t size> inline auto isInf(const T(&array)[size]) ->
     return isInf<T>(Containers::StridedArrayView1D<const T>{array});
 }
 
+MAGNUM_EXPORT bool isInfAny(const Containers::StridedArrayView1D<const Float>& range);
+
+MAGNUM_EXPORT bool isInfAny(const Containers::StridedArrayView1D<const Double>& range);
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline bool isInfAny(Iterable&& range) {
+    const Containers::StridedArrayView1D<const T> view{range};
+    return isInfAny(view);
+}
+
+template<class T> inline bool isInfAny(std::initializer_list<T> list) {
+    const Containers::StridedArrayView1D<const T> view = Containers::stridedArrayView(list);
+    return isInfAny(view);
+}
+
+template<class T, std::size_t size> inline bool isInfAny(const T(&array)[size]) {
+    const Containers::StridedArrayView1D<const T> view{array};
+    return isInfAny(view);
+}
+
+MAGNUM_EXPORT void isInfInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT void isInfInto(const Containers::StridedArrayView1D<const Double>& src, const Containers::MutableStridedBitArrayView1D& dst);
+
 template<class T> inline auto isNan(const Containers::StridedArrayView1D<const T>& range) -> decltype(isNan(std::declval<T>())) {
     if(range.isEmpty()) return {};
 
@@ -128,6 +175,29 @@ template<class T, std::size_t size> inline auto isNan(const T(&array)[size]) ->
     return isNan<T>(Containers::StridedArrayView1D<const T>{array});
 }
 
+MAGNUM_EXPORT bool isNanAny(const Containers::StridedArrayView1D<const Float>& range);
+
+MAGNUM_EXPORT bool isNanAny(const Containers::StridedArrayView1D<const Double>& range);
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline bool isNanAny(Iterable&& range) {
+    const Containers::StridedArrayView1D<const T> view{range};
+    return isNanAny(view);
+}
+
+template<class T> inline bool isNanAny(std::initializer_list<T> list) {
+    const Containers::StridedArrayView1D<const T> view = Containers::stridedArrayView(list);
+    return isNanAny(view);
+}
+
+template<class T, std::size_t size> inline bool isNanAny(const T(&array)[size]) {
+    const Containers::StridedArrayView1D<const T> view{array};
+    return isNanAny(view);
+}
+
+MAGNUM_EXPORT void isNanInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT void isNanInto(const Containers::StridedArrayView1D<const Double>& src, const Containers::MutableStridedBitArrayView1D& dst);
+
 namespace Implementation {
     template<class T, bool any> constexpr Containers::Pair<std::size_t, T> firstNonNan(Containers::StridedArrayView1D<const T> range, std::false_type, std::integral_constant<bool, any>) {
         return {0, range.front()};
@@ -148,6 +218,40 @@ namespace Implementation {
         }
         return {firstValid, out};
     }
+
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedByte* min, UnsignedByte* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Byte* min, Byte* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedShort* min, UnsignedShort* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Short* min, Short* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedInt* min, UnsignedInt* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Int* min, Int* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedLong* min, UnsignedLong* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Long* min, Long* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Float* min, Float* max);
+    MAGNUM_EXPORT void minmaxInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Double* min, Double* max);
+
+    template<class T> struct IsMinmaxBatchedType: std::false_type {};
+    template<> struct IsMinmaxBatchedType<UnsignedByte>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<Byte>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<UnsignedShort>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<Short>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<UnsignedInt>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<Int>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<UnsignedLong>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<Long>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<Float>: std::true_type {};
+    template<> struct IsMinmaxBatchedType<Double>: std::true_type {};
+
+    template<class T, bool = IsVector<T>::value> struct MinmaxBatchTraits {
+        typedef T Type;
+        enum: std::size_t { Size = 1 };
+    };
+    template<class T> struct MinmaxBatchTraits<T, true> {
+        typedef typename T::Type Type;
+        enum: std::size_t { Size = T::Size };
+    };
+    template<class T> struct IsMinmaxBatched: std::integral_constant<bool, IsMinmaxBatchedType<typename MinmaxBatchTraits<T>::Type>::value && MinmaxBatchTraits<T>::Size <= 4 && sizeof(T) == MinmaxBatchTraits<T>::Size*sizeof(typename MinmaxBatchTraits<T>::Type)> {};
+
 }
 
 template<class T> inline T min(const Containers::StridedArrayView1D<const T>& range) {
@@ -230,6 +334,168 @@ template<class T, std::size_t size> inline Containers::Pair<T, T> minmax(const T
     return minmax<T>(Containers::StridedArrayView1D<const T>{array});
 }
 
+namespace Implementation {
+    template<class T> inline void minmaxBatchedInto(const Containers::StridedArrayView1D<const T>& range, T* const min, T* const max) {
+        static_assert(IsMinmaxBatched<T>::value, "Math::minBatched(), maxBatched(), minmaxBatched(): expected an integer or floating-point scalar or a tightly packed vector of up to four of them");
+        minmaxInto(static_cast<const char*>(range.data()), range.stride(), range.size(), MinmaxBatchTraits<T>::Size, reinterpret_cast<typename MinmaxBatchTraits<T>::Type*>(min), reinterpret_cast<typename MinmaxBatchTraits<T>::Type*>(max));
+    }
+}
+
+template<class T> inline T minBatched(const Containers::StridedArrayView1D<const T>& range) {
+    if(range.isEmpty()) return {};
+
+    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+    Implementation::minmaxBatchedInto(range.exceptPrefix(iOut.first() + 1), &iOut.second(), static_cast<T*>(nullptr));
+    return iOut.second();
+}
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline T minBatched(Iterable&& range) {
+    return minBatched<T>(Containers::StridedArrayView1D<const T>{range});
+}
+
+template<class T> inline T minBatched(std::initializer_list<T> list) {
+    return minBatched<T>(Containers::stridedArrayView(list));
+}
+
+template<class T, std::size_t size> inline T minBatched(const T(&array)[size]) {
+    return minBatched<T>(Containers::StridedArrayView1D<const T>{array});
+}
+
+template<class T> inline T maxBatched(const Containers::StridedArrayView1D<const T>& range) {
+    if(range.isEmpty()) return {};
+
+    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+    Implementation::minmaxBatchedInto(range.exceptPrefix(iOut.first() + 1), static_cast<T*>(nullptr), &iOut.second());
+    return iOut.second();
+}
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline T maxBatched(Iterable&& range) {
+    return maxBatched<T>(Containers::StridedArrayView1D<const T>{range});
+}
+
+template<class T> inline T maxBatched(std::initializer_list<T> list) {
+    return maxBatched<T>(Containers::stridedArrayView(list));
+}
+
+template<class T, std::size_t size> inline T maxBatched(const T(&array)[size]) {
+    return maxBatched<T>(Containers::StridedArrayView1D<const T>{array});
+}
+
+template<class T> inline Containers::Pair<T, T> minmaxBatched(const Containers::StridedArrayView1D<const T>& range) {
+    if(range.isEmpty()) return {};
+
+    Containers::Pair<std::size_t, T> iOut = Implementation::firstNonNan(range, IsFloatingPoint<T>{}, IsVector<T>{});
+    T min{iOut.second()}, max{iOut.second()};
+    Implementation::minmaxBatchedInto(range.exceptPrefix(iOut.first() + 1), &min, &max);
+    return {min, max};
+}
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline Containers::Pair<T, T> minmaxBatched(Iterable&& range) {
+    return minmaxBatched<T>(Containers::StridedArrayView1D<const T>{range});
+}
+
+template<class T> inline Containers::Pair<T, T> minmaxBatched(std::initializer_list<T> list) {
+    return minmaxBatched<T>(Containers::stridedArrayView(list));
+}
+
+template<class T, std::size_t size> inline Containers::Pair<T, T> minmaxBatched(const T(&array)[size]) {
+    return minmaxBatched<T>(Containers::StridedArrayView1D<const T>{array});
+}
+
+namespace Implementation {
+    MAGNUM_EXPORT void sumInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Float* sum);
+    MAGNUM_EXPORT void sumInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Double* sum);
+    MAGNUM_EXPORT void meanVarianceInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Float* mean, Float* variance);
+    MAGNUM_EXPORT void meanVarianceInto(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Double* mean, Double* variance);
+
+    template<class T> struct IsSumBatchedType: std::false_type {};
+    template<> struct IsSumBatchedType<Float>: std::true_type {};
+    template<> struct IsSumBatchedType<Double>: std::true_type {};
+
+    template<class T> struct IsSumBatched: std::integral_constant<bool, IsSumBatchedType<typename MinmaxBatchTraits<T>::Type>::value && MinmaxBatchTraits<T>::Size <= 4 && sizeof(T) == MinmaxBatchTraits<T>::Size*sizeof(typename MinmaxBatchTraits<T>::Type)> {};
+
+    template<class T> inline T sum(const Containers::StridedArrayView1D<const T>& range, std::true_type) {
+        T out{};
+        sumInto(static_cast<const char*>(range.data()), range.stride(), range.size(), MinmaxBatchTraits<T>::Size, reinterpret_cast<typename MinmaxBatchTraits<T>::Type*>(&out));
+        return out;
+    }
+    template<class T> inline T sum(const Containers::StridedArrayView1D<const T>& range, std::false_type) {
+        T out = range[0];
+        for(std::size_t i = 1; i != range.size(); ++i)
+            out += range[i];
+        return out;
+    }
+
+    template<class T> inline Containers::Pair<T, T> meanVariance(const Containers::StridedArrayView1D<const T>& range, std::true_type) {
+        T mean{}, variance{};
+        meanVarianceInto(static_cast<const char*>(range.data()), range.stride(), range.size(), MinmaxBatchTraits<T>::Size, reinterpret_cast<typename MinmaxBatchTraits<T>::Type*>(&mean), reinterpret_cast<typename MinmaxBatchTraits<T>::Type*>(&variance));
+        return {mean, variance};
+    }
+    template<class T> inline Containers::Pair<T, T> meanVariance(const Containers::StridedArrayView1D<const T>& range, std::false_type) {
+        const T mean = sum(range, std::false_type{})/typename MinmaxBatchTraits<T>::Type(range.size());
+        T variance = (range[0] - mean)*(range[0] - mean);
+        for(std::size_t i = 1; i != range.size(); ++i)
+            variance += (range[i] - mean)*(range[i] - mean);
+        return {mean, variance/typename MinmaxBatchTraits<T>::Type(range.size())};
+    }
+}
+
+template<class T> inline T sum(const Containers::StridedArrayView1D<const T>& range) {
+    if(range.isEmpty()) return {};
+
+    return Implementation::sum(range, Implementation::IsSumBatched<T>{});
+}
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline T sum(Iterable&& range) {
+    return sum<T>(Containers::StridedArrayView1D<const T>{range});
+}
+
+template<class T> inline T sum(std::initializer_list<T> list) {
+    return sum<T>(Containers::stridedArrayView(list));
+}
+
+template<class T, std::size_t size> inline T sum(const T(&array)[size]) {
+    return sum<T>(Containers::StridedArrayView1D<const T>{array});
+}
+
+template<class T> inline T mean(const Containers::StridedArrayView1D<const T>& range) {
+    static_assert(IsFloatingPoint<T>::value, "Math::mean(): expected a floating-point type");
+    if(range.isEmpty()) return {};
+
+    return sum(range)/typename Implementation::MinmaxBatchTraits<T>::Type(range.size());
+}
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline T mean(Iterable&& range) {
+    return mean<T>(Containers::StridedArrayView1D<const T>{range});
+}
+
+template<class T> inline T mean(std::initializer_list<T> list) {
+    return mean<T>(Containers::stridedArrayView(list));
+}
+
+template<class T, std::size_t size> inline T mean(const T(&array)[size]) {
+    return mean<T>(Containers::StridedArrayView1D<const T>{array});
+}
+
+template<class T> inline Containers::Pair<T, T> meanVariance(const Containers::StridedArrayView1D<const T>& range) {
+    static_assert(IsFloatingPoint<T>::value, "Math::meanVariance(): expected a floating-point type");
+    if(range.isEmpty()) return {};
+
+    return Implementation::meanVariance(range, Implementation::IsSumBatched<T>{});
+}
+
+template<class Iterable, class T = decltype(Implementation::stridedArrayViewTypeFor(std::declval<Iterable&&>()))> inline Containers::Pair<T, T> meanVariance(Iterable&& range) {
+    return meanVariance<T>(Containers::StridedArrayView1D<const T>{range});
+}
+
+template<class T> inline Containers::Pair<T, T> meanVariance(std::initializer_list<T> list) {
+    return meanVariance<T>(Containers::stridedArrayView(list));
+}
+
+template<class T, std::size_t size> inline Containers::Pair<T, T> meanVariance(const T(&array)[size]) {
+    return meanVariance<T>(Containers::StridedArrayView1D<const T>{array});
+}
+
 }}
 
 #endif
@@ -378,16 +644,399 @@ MAGNUM_EXPORT void castInto(const Containers::StridedArrayView2D<const Float>& s
 
 MAGNUM_EXPORT void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Double>& dst);
 
+MAGNUM_EXPORT void packOctahedralInto(const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector2<Byte>>& dst);
+
+MAGNUM_EXPORT void packOctahedralInto(const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector2<Short>>& dst);
+
+MAGNUM_EXPORT void unpackOctahedralInto(const Containers::StridedArrayView1D<const Vector2<Byte>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void unpackOctahedralInto(const Containers::StridedArrayView1D<const Vector2<Short>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void pack1010102Into(const Containers::StridedArrayView1D<const Vector4<Float>>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst);
+
+MAGNUM_EXPORT void pack1010102Into(const Containers::StridedArrayView1D<const Vector4<Float>>& src, const Containers::StridedArrayView1D<Int>& dst);
+
+MAGNUM_EXPORT void unpack1010102Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView1D<Vector4<Float>>& dst);
+
+MAGNUM_EXPORT void unpack1010102Into(const Containers::StridedArrayView1D<const Int>& src, const Containers::StridedArrayView1D<Vector4<Float>>& dst);
+
+MAGNUM_EXPORT void packRgb9e5Into(const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst);
+
+MAGNUM_EXPORT void unpackRgb9e5Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+}}
+
+#endif
+#ifndef Magnum_Math_TransformBatch_h
+#define Magnum_Math_TransformBatch_h
+
+namespace Magnum { namespace Math {
+
+MAGNUM_EXPORT void transformPointsInto(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<const Vector2<Float>>& src, const Containers::StridedArrayView1D<Vector2<Float>>& dst);
+
+MAGNUM_EXPORT void transformPointsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void transformPointsInto(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void transformVectorsInto(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<const Vector2<Float>>& src, const Containers::StridedArrayView1D<Vector2<Float>>& dst);
+
+MAGNUM_EXPORT void transformVectorsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void transformVectorsInto(const Quaternion<Float>& quaternion, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void transformVectorsInto(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst);
+
+MAGNUM_EXPORT void transformPointsInPlace(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<Vector2<Float>>& data);
+
+MAGNUM_EXPORT void transformPointsInPlace(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<Vector3<Float>>& data);
+
+MAGNUM_EXPORT void transformPointsInPlace(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<Vector3<Float>>& data);
+
+MAGNUM_EXPORT void transformVectorsInPlace(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<Vector2<Float>>& data);
+
+MAGNUM_EXPORT void transformVectorsInPlace(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<Vector3<Float>>& data);
+
+MAGNUM_EXPORT void transformVectorsInPlace(const Quaternion<Float>& quaternion, const Containers::StridedArrayView1D<Vector3<Float>>& data);
+
+MAGNUM_EXPORT void transformVectorsInPlace(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<Vector3<Float>>& data);
+
+}}
+
+#endif
+#ifndef Magnum_Math_QuaternionBatch_h
+#define Magnum_Math_QuaternionBatch_h
+
+namespace Magnum { namespace Math {
+
+enum class SlerpMode: UnsignedByte {
+    Exact,
+    Approximate
+};
+
+MAGNUM_EXPORT void normalizeInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& src, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+MAGNUM_EXPORT void normalizeInPlace(const Containers::StridedArrayView1D<Quaternion<Float>>& data);
+
+MAGNUM_EXPORT void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+MAGNUM_EXPORT void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+MAGNUM_EXPORT void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+MAGNUM_EXPORT void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst);
+
+MAGNUM_EXPORT void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, SlerpMode mode = SlerpMode::Exact);
+
+MAGNUM_EXPORT void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, SlerpMode mode = SlerpMode::Exact);
+
+MAGNUM_EXPORT void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, SlerpMode mode = SlerpMode::Exact);
+
+MAGNUM_EXPORT void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, SlerpMode mode = SlerpMode::Exact);
+
+}}
+
+#endif
+#ifndef Magnum_Math_TrackBatch_h
+#define Magnum_Math_TrackBatch_h
+
+namespace Magnum { namespace Math {
+
+namespace Implementation {
+
+template<class T> struct TrackResultTraits { typedef T Type; };
+template<class T> struct TrackResultTraits<CubicHermite<T>> { typedef T Type; };
+
+template<class K> inline bool trackSegmentHinted(const char* const keys, const std::ptrdiff_t stride, const std::size_t size, const K time, std::size_t& hint) {
+    const std::size_t last = size - 2;
+    if(hint > last || (hint && time < *reinterpret_cast<const K*>(keys + std::ptrdiff_t(hint)*stride)))
+        return false;
+    if(hint == last || time < *reinterpret_cast<const K*>(keys + std::ptrdiff_t(hint + 1)*stride))
+        return true;
+    if(hint + 1 == last || time < *reinterpret_cast<const K*>(keys + std::ptrdiff_t(hint + 2)*stride)) {
+        ++hint;
+        return true;
+    }
+    return false;
+}
+
+template<class K> inline std::size_t trackSegmentSearch(const char* const keys, const std::ptrdiff_t stride, const std::size_t size, const K time) {
+    std::size_t base = 0;
+    for(std::size_t count = size - 1; count > 1; ) {
+        const std::size_t half = count/2;
+        base = *reinterpret_cast<const K*>(keys + std::ptrdiff_t(base + half)*stride) <= time ? base + half : base;
+        count -= half;
+    }
+    return base;
+}
+
+template<class K> inline Float trackSegmentFactor(const char* const keys, const std::ptrdiff_t stride, const std::size_t segment, const K time) {
+    const K a = *reinterpret_cast<const K*>(keys + std::ptrdiff_t(segment)*stride);
+    const K b = *reinterpret_cast<const K*>(keys + std::ptrdiff_t(segment + 1)*stride);
+    if(time >= b) return 1.0f;
+    if(time <= a) return 0.0f;
+    return Float(time - a)/Float(b - a);
+}
+
+}
+
+template<class V> using TrackResultOf = typename Implementation::TrackResultTraits<V>::Type;
+
+template<class K, class V, class R = TrackResultOf<V>> inline R sampleTrack(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), const K time, std::size_t& hint) {
+    CORRADE_ASSERT(!keys.isEmpty() && keys.size() == values.size(),
+        "Math::sampleTrack(): expected key and value views to have the same non-zero size but got" << keys.size() << "and" << values.size(), {});
+    if(keys.size() == 1) {
+        hint = 0;
+        return interpolator(values[0], values[0], 0.0f);
+    }
+
+    const char* const data = static_cast<const char*>(keys.data());
+    if(!Implementation::trackSegmentHinted(data, keys.stride(), keys.size(), time, hint))
+        hint = Implementation::trackSegmentSearch(data, keys.stride(), keys.size(), time);
+    return interpolator(values[hint], values[hint + 1], Implementation::trackSegmentFactor(data, keys.stride(), hint, time));
+}
+
+template<class K, class V, class R = TrackResultOf<V>> inline R sampleTrack(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView1D<const V>& values, R(*interpolator)(const V&, const V&, Float), const K time) {
+    std::size_t hint{};
+    return sampleTrack(keys, values, interpolator, time, hint);
+}
+
+template<class K, class V, class R = TrackResultOf<V>> inline void sampleTracksInto(const Containers::StridedArrayView1D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*interpolator)(const V&, const V&, Float), const K time, std::size_t& hint, const Containers::StridedArrayView1D<R>& dst) {
+    CORRADE_ASSERT(!keys.isEmpty() && keys.size() == values.size()[1],
+        "Math::sampleTracksInto(): expected" << keys.size() << "values per track but got" << values.size()[1], );
+    CORRADE_ASSERT(dst.size() == values.size()[0],
+        "Math::sampleTracksInto(): wrong destination size, got" << dst.size() << "but expected" << values.size()[0], );
+
+    std::size_t next = 0;
+    Float factor = 0.0f;
+    if(keys.size() == 1) hint = 0;
+    else {
+        const char* const data = static_cast<const char*>(keys.data());
+        if(!Implementation::trackSegmentHinted(data, keys.stride(), keys.size(), time, hint))
+            hint = Implementation::trackSegmentSearch(data, keys.stride(), keys.size(), time);
+        next = hint + 1;
+        factor = Implementation::trackSegmentFactor(data, keys.stride(), hint, time);
+    }
+
+    for(std::size_t i = 0; i != dst.size(); ++i) {
+        const Containers::StridedArrayView1D<const V> track = values[i];
+        dst[i] = interpolator(track[hint], track[next], factor);
+    }
+}
+
+template<class K, class V, class R = TrackResultOf<V>> inline void sampleTracksInto(const Containers::StridedArrayView2D<const K>& keys, const Containers::StridedArrayView2D<const V>& values, R(*interpolator)(const V&, const V&, Float), const K time, const Containers::StridedArrayView1D<std::size_t>& hints, const Containers::StridedArrayView1D<R>& dst) {
+    CORRADE_ASSERT(keys.size()[1] && keys.size() == values.size(),
+        "Math::sampleTracksInto(): expected key and value views to have the same non-zero size but got" << keys.size() << "and" << values.size(), );
+    CORRADE_ASSERT(hints.size() == keys.size()[0] && dst.size() == keys.size()[0],
+        "Math::sampleTracksInto(): expected" << keys.size()[0] << "hints and destination items but got" << hints.size() << "and" << dst.size(), );
+
+    const std::size_t keyCount = keys.size()[1];
+    if(keyCount == 1) {
+        for(std::size_t i = 0; i != dst.size(); ++i) {
+            hints[i] = 0;
+            dst[i] = interpolator(values[i][0], values[i][0], 0.0f);
+        }
+        return;
+    }
+
+    const char* const data = static_cast<const char*>(keys.data());
+    const std::ptrdiff_t trackStride = keys.stride()[0];
+    const std::ptrdiff_t keyStride = keys.stride()[1];
+    for(std::size_t i = 0; i < dst.size(); i += 16) {
+        const std::size_t count = Math::min(dst.size() - i, std::size_t(16));
+        std::size_t missing[16];
+        std::size_t base[16];
+        std::size_t missingCount = 0;
+        for(std::size_t j = 0; j != count; ++j) {
+            if(Implementation::trackSegmentHinted(data + std::ptrdiff_t(i + j)*trackStride, keyStride, keyCount, time, hints[i + j]))
+                continue;
+            missing[missingCount] = i + j;
+            base[missingCount] = 0;
+            ++missingCount;
+        }
+
+        if(missingCount) for(std::size_t size = keyCount - 1; size > 1; ) {
+            const std::size_t half = size/2;
+            for(std::size_t j = 0; j != missingCount; ++j)
+                base[j] = *reinterpret_cast<const K*>(data + std::ptrdiff_t(missing[j])*trackStride + std::ptrdiff_t(base[j] + half)*keyStride) <= time ? base[j] + half : base[j];
+            size -= half;
+        }
+        for(std::size_t j = 0; j != missingCount; ++j)
+            hints[missing[j]] = base[j];
+
+        for(std::size_t j = i; j != i + count; ++j) {
+            const std::size_t hint = hints[j];
+            const Containers::StridedArrayView1D<const V> track = values[j];
+            dst[j] = interpolator(track[hint], track[hint + 1], Implementation::trackSegmentFactor(data + std::ptrdiff_t(j)*trackStride, keyStride, hint, time));
+        }
+    }
+}
+
+}}
+
+#endif
+#ifndef Magnum_Math_ColorBatch_h
+#define Magnum_Math_ColorBatch_h
+
+namespace Magnum { namespace Math {
+
+MAGNUM_EXPORT void fromSrgbInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+MAGNUM_EXPORT void fromSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+MAGNUM_EXPORT void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst);
+
+MAGNUM_EXPORT void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst);
+
+}}
+
+#endif
+#ifndef Magnum_Math_IntersectionBatch_h
+#define Magnum_Math_IntersectionBatch_h
+
+namespace Magnum { namespace Math { namespace Intersection {
+
+MAGNUM_EXPORT void rangeFrustumInto(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT void aabbFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT void rayRangeInto(const Vector3<Float>& rayOrigin, const Vector3<Float>& inverseRayDirection, const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits);
+
+MAGNUM_EXPORT void rayRangeInto(const Vector3<Float>& rayOrigin, const Vector3<Float>& inverseRayDirection, const Containers::StridedArrayView2D<const Float>& rangeMin, const Containers::StridedArrayView2D<const Float>& rangeMax, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits);
+
+MAGNUM_EXPORT void rayRangeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& rayOrigins, const Containers::StridedArrayView1D<const Vector3<Float>>& inverseRayDirections, const Range3D<Float>& range, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits);
+
+MAGNUM_EXPORT void sphereFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT void sphereConeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, Rad<Float> coneAngle, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT void sphereConeViewInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Matrix4<Float>& coneView, Rad<Float> coneAngle, const Containers::MutableStridedBitArrayView1D& dst);
+
+MAGNUM_EXPORT std::size_t sphereFrustumClustersInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Containers::StridedArrayView1D<const Frustum<Float>>& clusters, const Containers::StridedArrayView1D<UnsignedInt>& clusterOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+}}}
+
+#endif
+#ifndef Magnum_Math_MatrixBatch_h
+#define Magnum_Math_MatrixBatch_h
+
+namespace Magnum { namespace Math {
+
+MAGNUM_EXPORT void multiplyInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+MAGNUM_EXPORT void multiplyHierarchyInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& transformations, const Containers::StridedArrayView1D<const Int>& parents, const Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+MAGNUM_EXPORT void invertedRigidInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& src, const Containers::StridedArrayView1D<Matrix4<Float>>& dst);
+
+}}
+
+#endif
+#ifndef Magnum_Math_SkinningBatch_h
+#define Magnum_Math_SkinningBatch_h
+
+namespace Magnum { namespace Math {
+
+MAGNUM_EXPORT void skinLinearInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& jointMatrices, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals);
+
+MAGNUM_EXPORT void skinLinearInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& jointMatrices, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions);
+
+MAGNUM_EXPORT void skinDualQuaternionInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& jointTransformations, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals);
+
+MAGNUM_EXPORT void skinDualQuaternionInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& jointTransformations, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions);
+
+}}
+
+#endif
+#ifndef Magnum_Math_MortonBatch_h
+#define Magnum_Math_MortonBatch_h
+
+namespace Magnum { namespace Math {
+
+MAGNUM_EXPORT void mortonEncodeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& points, const Range3D<Float>& bounds, const Containers::StridedArrayView1D<UnsignedInt>& codes);
+
+MAGNUM_EXPORT void mortonEncodeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& points, const Range3D<Float>& bounds, const Containers::StridedArrayView1D<UnsignedLong>& codes);
+
+MAGNUM_EXPORT void mortonDecodeInto(const Containers::StridedArrayView1D<const UnsignedInt>& codes, const Containers::StridedArrayView1D<Vector3<UnsignedShort>>& dst);
+
+MAGNUM_EXPORT void mortonDecodeInto(const Containers::StridedArrayView1D<const UnsignedLong>& codes, const Containers::StridedArrayView1D<Vector3<UnsignedInt>>& dst);
+
 }}
 
 #endif
 #if defined(MAGNUM_MATH_BATCH_IMPLEMENTATION) && !defined(MagnumMathBatch_hpp_implementation)
 #define MagnumMathBatch_hpp_implementation
-namespace Magnum { namespace Math { namespace {
+#ifndef CORRADE_NO_CPU_RUNTIME_DISPATCH
+#define CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#endif
 
-constexpr UnsignedInt HalfMantissaTable[2048] = {
-    0x00000000, 0x33800000, 0x34000000, 0x34400000, 0x34800000, 0x34a00000,
-    0x34c00000, 0x34e00000, 0x35000000, 0x35100000, 0x35200000, 0x35300000,
+#include <cstring>
+
+#include "CorradeBitArray.hpp"
+#include "CorradeCpu.hpp"
+
+#if defined(CORRADE_ENABLE_SSE2) || defined(CORRADE_ENABLE_SSE41) || defined(CORRADE_ENABLE_AVX512F) || defined(CORRADE_ENABLE_BMI2)
+#include <immintrin.h>
+#endif
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__ >= 10
+#define CORRADE_UNUSED [[maybe_unused]]
+#elif defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG_CL)
+#define CORRADE_UNUSED __attribute__((__unused__))
+#elif defined(CORRADE_TARGET_MSVC)
+#define CORRADE_UNUSED __pragma(warning(suppress:4100))
+#else
+#define CORRADE_UNUSED
+#endif
+
+#define CORRADE_PASSTHROUGH(...) __VA_ARGS__
+
+#define CORRADE_NOOP(...)
+
+#ifdef CORRADE_TARGET_GCC
+#define CORRADE_NEVER_INLINE __attribute__((noinline))
+#elif defined(CORRADE_TARGET_MSVC)
+#define CORRADE_NEVER_INLINE __declspec(noinline)
+#else
+#define CORRADE_NEVER_INLINE
+#endif
+#ifndef Corrade_Utility_Implementation_cpu_h
+#define Corrade_Utility_Implementation_cpu_h
+
+#if (defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && !defined(CORRADE_CPU_USE_IFUNC))
+    #define CORRADE_UTILITY_CPU_DISPATCHER(...) CORRADE_CPU_DISPATCHER(__VA_ARGS__)
+    #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...) CORRADE_CPU_DISPATCHER_BASE(__VA_ARGS__)
+    #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)                 \
+        CORRADE_CPU_DISPATCHED_POINTER(dispatcher, __VA_ARGS__) CORRADE_NOOP
+    #define CORRADE_UTILITY_CPU_MAYBE_UNUSED
+#else
+    #if defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && defined(CORRADE_CPU_USE_IFUNC)
+        #define CORRADE_UTILITY_CPU_DISPATCHER(...)                         \
+            namespace { CORRADE_CPU_DISPATCHER(__VA_ARGS__) }
+        #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...)                    \
+            namespace { CORRADE_CPU_DISPATCHER_BASE(__VA_ARGS__) }
+        #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)             \
+            CORRADE_CPU_DISPATCHED_IFUNC(dispatcher, __VA_ARGS__) CORRADE_NOOP
+        #define CORRADE_UTILITY_CPU_MAYBE_UNUSED
+    #elif !defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH)
+        #define CORRADE_UTILITY_CPU_DISPATCHER(...)
+        #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...)
+        #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)             \
+            __VA_ARGS__ CORRADE_PASSTHROUGH
+        #define CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_UNUSED
+    #else
+    #error mosra messed up!
+    #endif
+#endif
+
+#endif
+#if defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && !defined(CORRADE_CPU_USE_IFUNC)
+    #define CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(name) (*name)
+#else
+    #define CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(name) (name)
+#endif
+namespace Magnum { namespace Math { namespace {
+
+constexpr UnsignedInt HalfMantissaTable[2048] = {
+    0x00000000, 0x33800000, 0x34000000, 0x34400000, 0x34800000, 0x34a00000,
+    0x34c00000, 0x34e00000, 0x35000000, 0x35100000, 0x35200000, 0x35300000,
     0x35400000, 0x35500000, 0x35600000, 0x35700000, 0x35800000, 0x35880000,
     0x35900000, 0x35980000, 0x35a00000, 0x35a80000, 0x35b00000, 0x35b80000,
     0x35c00000, 0x35c80000, 0x35d00000, 0x35d80000, 0x35e00000, 0x35e80000,
@@ -864,460 +1513,11516 @@ constexpr UnsignedByte HalfShiftTable[512] = {
 }}}
 namespace Magnum { namespace Math {
 
-namespace {
-
-template<class T> inline void unpackUnsignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.template isContiguous<1>(),
-        "Math::unpackInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.isContiguous<1>(),
-        "Math::unpackInto(): second destination view dimension is not contiguous", );
+namespace Implementation {
 
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = *srcPtrI++/bitMax;
+typedef void(*BatchFunction)(const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t, std::size_t);
+typedef void(*TestIntoFunction)(const char*, std::ptrdiff_t, std::size_t, char*, std::size_t);
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
-}
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackUnsignedByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackUnsignedShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packUnsignedByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packUnsignedShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
 
-}
+namespace {
 
-void unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackUnsignedIntoImplementation(src, dst);
+template<class T> inline Float unpackScalar(const T value) {
+    const Float out = value/Float(bitMax<T>());
+    return std::is_signed<T>::value && out < -1.0f ? -1.0f : out;
 }
 
-void unpackInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackUnsignedIntoImplementation(src, dst);
+template<class T> inline T packScalar(const Float value) {
+    const Float min = std::is_signed<T>::value ? -1.0f : 0.0f;
+    const Float clamped = value >= min ? (value <= 1.0f ? value : 1.0f) : min;
+    return T(std::round(clamped*Float(bitMax<T>())));
 }
 
-namespace {
+template<class T> void unpackIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        Float* dstI = reinterpret_cast<Float*>(dst);
+        for(std::size_t j = 0; j != rowSize; ++j)
+            dstI[j] = unpackScalar(srcI[j]);
 
-template<class T> inline void unpackSignedIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.template isContiguous<1>(),
-        "Math::unpackInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.isContiguous<1>(),
-        "Math::unpackInto(): second destination view dimension is not contiguous", );
+        src += srcStride;
+        dst += dstStride;
+    }
+}
 
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        Float* dstPtrI = reinterpret_cast<Float*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const Float value = *srcPtrI++/bitMax;
-            *dstPtrI++ = value < -1.0f ? -1.0f : value;
-        }
+template<class T> void packIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        for(std::size_t j = 0; j != rowSize; ++j)
+            dstI[j] = packScalar<T>(srcI[j]);
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
+        src += srcStride;
+        dst += dstStride;
     }
 }
 
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_ENABLE_SSE41 inline __m128i widenSse41(const UnsignedByte* const data) {
+    Int value;
+    std::memcpy(&value, data, 4);
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(value));
 }
 
-void unpackInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackSignedIntoImplementation(src, dst);
+CORRADE_ENABLE_SSE41 inline __m128i widenSse41(const Byte* const data) {
+    Int value;
+    std::memcpy(&value, data, 4);
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(value));
 }
 
-void unpackInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    unpackSignedIntoImplementation(src, dst);
+CORRADE_ENABLE_SSE41 inline __m128i widenSse41(const UnsignedShort* const data) {
+    return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
 }
 
-namespace {
-
-template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::packInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.isContiguous<1>(),
-        "Math::packInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.template isContiguous<1>(),
-        "Math::packInto(): second destination view dimension is not contiguous", );
-
-    constexpr Float bitMax = Implementation::bitMax<T>();
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const Float* srcPtrI = reinterpret_cast<const Float*>(srcPtr);
-        T* dstPtrI = reinterpret_cast<T*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = std::round(*srcPtrI++*bitMax);
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+CORRADE_ENABLE_SSE41 inline __m128i widenSse41(const Short* const data) {
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
 }
 
+CORRADE_ENABLE_SSE41 inline void narrowSse41(UnsignedByte* const data, const __m128i value) {
+    const __m128i packed = _mm_packs_epi32(value, value);
+    const Int out = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+    std::memcpy(data, &out, 4);
 }
 
-void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    packIntoImplementation(src, dst);
+CORRADE_ENABLE_SSE41 inline void narrowSse41(Byte* const data, const __m128i value) {
+    const __m128i packed = _mm_packs_epi32(value, value);
+    const Int out = _mm_cvtsi128_si32(_mm_packs_epi16(packed, packed));
+    std::memcpy(data, &out, 4);
 }
 
-void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    packIntoImplementation(src, dst);
+CORRADE_ENABLE_SSE41 inline void narrowSse41(UnsignedShort* const data, const __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_packus_epi32(value, value));
 }
 
-void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    packIntoImplementation(src, dst);
+CORRADE_ENABLE_SSE41 inline void narrowSse41(Short* const data, const __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_packs_epi32(value, value));
 }
 
-void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    packIntoImplementation(src, dst);
+CORRADE_ENABLE_SSE41 inline __m128i roundSse41(const __m128 value) {
+    const __m128 sign = _mm_and_ps(value, _mm_set1_ps(-0.0f));
+    return _mm_cvttps_epi32(_mm_or_ps(_mm_add_ps(_mm_xor_ps(value, sign), _mm_set1_ps(0.49999997f)), sign));
 }
 
-namespace {
+template<class T> CORRADE_ENABLE_SSE41 void unpackIntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m128 max = _mm_set1_ps(Float(bitMax<T>()));
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        Float* dstI = reinterpret_cast<Float*>(dst);
+        std::size_t j = 0;
+        for(; j + 4 <= rowSize; j += 4)
+            _mm_storeu_ps(dstI + j, _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(widenSse41(srcI + j)), max), minusOne));
+        for(; j != rowSize; ++j)
+            dstI[j] = unpackScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
 
-template<class T, class U> inline void castIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::castInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.template isContiguous<1>(),
-        "Math::castInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.template isContiguous<1>(),
-        "Math::castInto(): second destination view dimension is not contiguous", );
+template<class T> CORRADE_ENABLE_SSE41 void packIntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m128 max = _mm_set1_ps(Float(bitMax<T>()));
+    const __m128 min = _mm_set1_ps(std::is_signed<T>::value ? -1.0f : 0.0f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        std::size_t j = 0;
+        for(; j + 4 <= rowSize; j += 4)
+            narrowSse41(dstI + j, roundSse41(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(srcI + j), min), one), max)));
+        for(; j != rowSize; ++j)
+            dstI[j] = packScalar<T>(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
 
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const T* srcPtrI = reinterpret_cast<const T*>(srcPtr);
-        U* dstPtrI = reinterpret_cast<U*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j)
-            *dstPtrI++ = U(*srcPtrI++);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const UnsignedByte* const data) {
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
+}
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
-    }
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const Byte* const data) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data)));
 }
 
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const UnsignedShort* const data) {
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const Short* const data) {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(UnsignedByte* const data, const __m256i value) {
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_packus_epi16(packed, packed));
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(Byte* const data, const __m256i value) {
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_packs_epi16(packed, packed));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(UnsignedShort* const data, const __m256i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_packus_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX2 inline void narrowAvx2(Short* const data, const __m256i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_packs_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX2 inline __m256i roundAvx2(const __m256 value) {
+    const __m256 sign = _mm256_and_ps(value, _mm256_set1_ps(-0.0f));
+    return _mm256_cvttps_epi32(_mm256_or_ps(_mm256_add_ps(_mm256_xor_ps(value, sign), _mm256_set1_ps(0.49999997f)), sign));
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+template<class T> CORRADE_ENABLE_AVX2 void unpackIntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m256 max = _mm256_set1_ps(Float(bitMax<T>()));
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        Float* dstI = reinterpret_cast<Float*>(dst);
+        std::size_t j = 0;
+        for(; j + 8 <= rowSize; j += 8)
+            _mm256_storeu_ps(dstI + j, _mm256_max_ps(_mm256_div_ps(_mm256_cvtepi32_ps(widenAvx2(srcI + j)), max), minusOne));
+        for(; j != rowSize; ++j)
+            dstI[j] = unpackScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
 }
 
-void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+template<class T> CORRADE_ENABLE_AVX2 void packIntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m256 max = _mm256_set1_ps(Float(bitMax<T>()));
+    const __m256 min = _mm256_set1_ps(std::is_signed<T>::value ? -1.0f : 0.0f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        std::size_t j = 0;
+        for(; j + 8 <= rowSize; j += 8)
+            narrowAvx2(dstI + j, roundAvx2(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(srcI + j), min), one), max)));
+        for(; j != rowSize; ++j)
+            dstI[j] = packScalar<T>(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+CORRADE_ENABLE_AVX512F inline __m512i widenAvx512(const UnsignedByte* const data) {
+    return _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline __m512i widenAvx512(const Byte* const data) {
+    return _mm512_cvtepi8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline __m512i widenAvx512(const UnsignedShort* const data) {
+    return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline __m512i widenAvx512(const Short* const data) {
+    return _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline void narrowAvx512(UnsignedByte* const data, const __m512i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm512_cvtusepi32_epi8(_mm512_max_epi32(value, _mm512_setzero_si512())));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline void narrowAvx512(Byte* const data, const __m512i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm512_cvtsepi32_epi8(value));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline void narrowAvx512(UnsignedShort* const data, const __m512i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), _mm512_cvtusepi32_epi16(_mm512_max_epi32(value, _mm512_setzero_si512())));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline void narrowAvx512(Short* const data, const __m512i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), _mm512_cvtsepi32_epi16(value));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_ENABLE_AVX512F inline __m512i roundAvx512(const __m512 value) {
+    const __m512i bits = _mm512_castps_si512(value);
+    const __m512i sign = _mm512_and_si512(bits, _mm512_castps_si512(_mm512_set1_ps(-0.0f)));
+    const __m512 rounded = _mm512_add_ps(_mm512_castsi512_ps(_mm512_xor_si512(bits, sign)), _mm512_set1_ps(0.49999997f));
+    return _mm512_cvttps_epi32(_mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(rounded), sign)));
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
+template<class T> CORRADE_ENABLE_AVX512F void unpackIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m512 max = _mm512_set1_ps(Float(bitMax<T>()));
+    const __m512 minusOne = _mm512_set1_ps(-1.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        Float* dstI = reinterpret_cast<Float*>(dst);
+        std::size_t j = 0;
+        for(; j + 16 <= rowSize; j += 16)
+            _mm512_storeu_ps(dstI + j, _mm512_max_ps(_mm512_div_ps(_mm512_cvtepi32_ps(widenAvx512(srcI + j)), max), minusOne));
+        for(; j != rowSize; ++j)
+            dstI[j] = unpackScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
 }
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
+template<class T> CORRADE_ENABLE_AVX512F void packIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m512 max = _mm512_set1_ps(Float(bitMax<T>()));
+    const __m512 min = _mm512_set1_ps(std::is_signed<T>::value ? -1.0f : 0.0f);
+    const __m512 one = _mm512_set1_ps(1.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        std::size_t j = 0;
+        for(; j + 16 <= rowSize; j += 16)
+            narrowAvx512(dstI + j, roundAvx512(_mm512_mul_ps(_mm512_min_ps(_mm512_max_ps(_mm512_loadu_ps(srcI + j), min), one), max)));
+        for(; j != rowSize; ++j)
+            dstI[j] = packScalar<T>(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
 }
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackUnsignedByteInto)>::type unpackUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackIntoSse41<UnsignedByte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackUnsignedByteInto)>::type unpackUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackIntoAvx2<UnsignedByte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackUnsignedByteInto)>::type unpackUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackIntoAvx512<UnsignedByte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackUnsignedByteInto)>::type unpackUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackIntoScalar<UnsignedByte>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_DISPATCHER(unpackUnsignedByteIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackUnsignedByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackUnsignedByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    unpackUnsignedByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackUnsignedShortInto)>::type unpackUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackIntoSse41<UnsignedShort>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
-    castIntoImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackUnsignedShortInto)>::type unpackUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackIntoAvx2<UnsignedShort>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackUnsignedShortInto)>::type unpackUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackIntoAvx512<UnsignedShort>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackUnsignedShortInto)>::type unpackUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackIntoScalar<UnsignedShort>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_DISPATCHER(unpackUnsignedShortIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackUnsignedShortIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackUnsignedShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    unpackUnsignedShortIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackByteInto)>::type unpackByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackIntoSse41<Byte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Long>& dst) {
-    castIntoImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackByteInto)>::type unpackByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackIntoAvx2<Byte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackByteInto)>::type unpackByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackIntoAvx512<Byte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Long>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackByteInto)>::type unpackByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackIntoScalar<Byte>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
-    castIntoImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Long>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_DISPATCHER(unpackByteIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    unpackByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackShortInto)>::type unpackShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackIntoSse41<Short>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
-    castIntoImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackShortInto)>::type unpackShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackIntoAvx2<Short>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackShortInto)>::type unpackShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackIntoAvx512<Short>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackShortInto)>::type unpackShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackIntoScalar<Short>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_DISPATCHER(unpackShortIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackShortIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    unpackShortIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packUnsignedByteInto)>::type packUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packIntoSse41<UnsignedByte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packUnsignedByteInto)>::type packUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packIntoAvx2<UnsignedByte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packUnsignedByteInto)>::type packUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packIntoAvx512<UnsignedByte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packUnsignedByteInto)>::type packUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packIntoScalar<UnsignedByte>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_DISPATCHER(packUnsignedByteIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packUnsignedByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packUnsignedByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    packUnsignedByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packUnsignedShortInto)>::type packUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packIntoSse41<UnsignedShort>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    castIntoImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packUnsignedShortInto)>::type packUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packIntoAvx2<UnsignedShort>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packUnsignedShortInto)>::type packUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packIntoAvx512<UnsignedShort>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    castIntoImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packUnsignedShortInto)>::type packUnsignedShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packIntoScalar<UnsignedShort>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    castIntoImplementation(src, dst);
 }
 
+CORRADE_UTILITY_CPU_DISPATCHER(packUnsignedShortIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packUnsignedShortIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packUnsignedShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    packUnsignedShortIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
 namespace {
 
-template<class T> inline void copyImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<T>& dst) {
-    castIntoImplementation(src, dst);
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packByteInto)>::type packByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packIntoSse41<Byte>;
 }
+#endif
 
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packByteInto)>::type packByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packIntoAvx2<Byte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
-    copyImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packByteInto)>::type packByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packIntoAvx512<Byte>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Byte>& dst) {
-    copyImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packByteInto)>::type packByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packIntoScalar<Byte>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    copyImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Short>& dst) {
-    copyImplementation(src, dst);
-}
+CORRADE_UTILITY_CPU_DISPATCHER(packByteIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    packByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
-    copyImplementation(src, dst);
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packShortInto)>::type packShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packIntoSse41<Short>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Int>& dst) {
-    copyImplementation(src, dst);
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packShortInto)>::type packShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packIntoAvx2<Short>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
-    copyImplementation(src, dst);
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packShortInto)>::type packShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packIntoAvx512<Short>;
 }
+#endif
 
-void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Long>& dst) {
-    copyImplementation(src, dst);
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packShortInto)>::type packShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packIntoScalar<Short>;
 }
 
-void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    copyImplementation(src, dst);
 }
 
-void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Double>& dst) {
-    copyImplementation(src, dst);
+CORRADE_UTILITY_CPU_DISPATCHER(packShortIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packShortIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    packShortIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
 }
 
-static_assert(sizeof(HalfMantissaTable) + sizeof(HalfOffsetTable) + sizeof(HalfExponentTable) == 8576,
-    "improper size of half->float conversion tables");
+namespace Implementation {
 
-static_assert(sizeof(HalfBaseTable) + sizeof(HalfShiftTable) == 1536,
-    "improper size of float->half conversion tables");
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfIntoFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfAnyFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfIntoDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfAnyDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanIntoFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanAnyFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanIntoDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanAnyDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size);
 
-void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::unpackHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.isContiguous<1>(),
-        "Math::unpackHalfInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.isContiguous<1>(),
-        "Math::unpackHalfInto(): second destination view dimension is not contiguous", );
+namespace {
 
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
-    char* dstPtr = reinterpret_cast<char*>(dst.data());
-    const std::ptrdiff_t srcStride = src.stride()[0];
-    const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
-    for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedShort* srcPtrI = reinterpret_cast<const UnsignedShort*>(srcPtr);
-        UnsignedInt* dstPtrI = reinterpret_cast<UnsignedInt*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedShort h = *srcPtrI++;
-            *dstPtrI++ = HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+inline void writeBits(char* const data, const std::size_t offset, const UnsignedInt bits, const std::size_t count) {
+    for(std::size_t i = 0; i != count; i += 8) {
+        const std::size_t bit = offset + i;
+        const UnsignedInt shift = bit & 0x07;
+        const UnsignedInt value = (bits >> i) & 0xff;
+        UnsignedByte* const out = reinterpret_cast<UnsignedByte*>(data) + (bit >> 3);
+        if(!shift) {
+            out[0] = UnsignedByte(value);
+            continue;
         }
-
-        srcPtr += srcStride;
-        dstPtr += dstStride;
+        const UnsignedInt low = (1u << shift) - 1;
+        out[0] = UnsignedByte((out[0] & low) | (value << shift));
+        out[1] = UnsignedByte((out[1] & ~low) | (value >> (8 - shift)));
     }
 }
 
-void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
-    CORRADE_ASSERT(src.size() == dst.size(),
-        "Math::packHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
-    CORRADE_ASSERT(src.isContiguous<1>(),
-        "Math::packHalfInto(): second source view dimension is not contiguous", );
-    CORRADE_ASSERT(dst.isContiguous<1>(),
-        "Math::packHalfInto(): second destination view dimension is not contiguous", );
+template<class T, bool inf> inline bool testScalar(const T value) {
+    return inf ? Math::isInf(value) : Math::isNan(value);
+}
 
-    const char* srcPtr = reinterpret_cast<const char*>(src.data());
+template<class T, bool inf> void testIntoScalar(const char* src, const std::ptrdiff_t srcStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const std::size_t bit = dstOffset + i;
+        if(testScalar<T, inf>(*reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride)))
+            dst[bit >> 3] |= char(1 << (bit & 0x07));
+        else
+            dst[bit >> 3] &= char(~(1 << (bit & 0x07)));
+    }
+}
+
+template<class T, bool inf> bool testAnyScalar(const char* src, const std::ptrdiff_t srcStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        if(testScalar<T, inf>(*reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride)))
+            return true;
+    return false;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class T> struct TestSse2;
+
+template<> struct TestSse2<Float> {
+    typedef __m128 Type;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_SSE2 static Type load(const Float* const data) {
+        return _mm_loadu_ps(data);
+    }
+    CORRADE_ENABLE_SSE2 static UnsignedInt nan(const Type value) {
+        return _mm_movemask_ps(_mm_cmpunord_ps(value, value));
+    }
+    CORRADE_ENABLE_SSE2 static UnsignedInt inf(const Type value) {
+        return _mm_movemask_ps(_mm_cmpeq_ps(_mm_and_ps(value, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff))), _mm_castsi128_ps(_mm_set1_epi32(0x7f800000))));
+    }
+};
+
+template<> struct TestSse2<Double> {
+    typedef __m128d Type;
+    enum: std::size_t { Lanes = 2 };
+
+    CORRADE_ENABLE_SSE2 static Type load(const Double* const data) {
+        return _mm_loadu_pd(data);
+    }
+    CORRADE_ENABLE_SSE2 static UnsignedInt nan(const Type value) {
+        return _mm_movemask_pd(_mm_cmpunord_pd(value, value));
+    }
+    CORRADE_ENABLE_SSE2 static UnsignedInt inf(const Type value) {
+        return _mm_movemask_pd(_mm_cmpeq_pd(_mm_and_pd(value, _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffll))), _mm_castsi128_pd(_mm_set1_epi64x(0x7ff0000000000000ll))));
+    }
+};
+
+template<class T, bool inf> CORRADE_ENABLE_SSE2 void testIntoSse2(const char* src, const std::ptrdiff_t srcStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef TestSse2<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const bool contiguous = srcStride == std::ptrdiff_t(sizeof(T));
+    T block[chunk];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        const T* in = reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!contiguous) {
+            for(std::size_t k = 0; k != chunk; ++k)
+                std::memcpy(block + k, src + std::ptrdiff_t(i + k)*srcStride, sizeof(T));
+            in = block;
+        }
+
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes)
+            bits |= (inf ? Vector::inf(Vector::load(in + k)) : Vector::nan(Vector::load(in + k))) << k;
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    testIntoScalar<T, inf>(src + std::ptrdiff_t(i)*srcStride, srcStride, size - i, dst, dstOffset + i);
+}
+
+template<class T, bool inf> CORRADE_ENABLE_SSE2 bool testAnySse2(const char* src, const std::ptrdiff_t srcStride, const std::size_t size) {
+    typedef TestSse2<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = 4*lanes;
+    const bool contiguous = srcStride == std::ptrdiff_t(sizeof(T));
+    T block[chunk];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        const T* in = reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!contiguous) {
+            for(std::size_t k = 0; k != chunk; ++k)
+                std::memcpy(block + k, src + std::ptrdiff_t(i + k)*srcStride, sizeof(T));
+            in = block;
+        }
+
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes)
+            bits |= inf ? Vector::inf(Vector::load(in + k)) : Vector::nan(Vector::load(in + k));
+        if(bits) return true;
+    }
+
+    return testAnyScalar<T, inf>(src + std::ptrdiff_t(i)*srcStride, srcStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+template<class T> struct TestAvx;
+
+template<> struct TestAvx<Float> {
+    typedef __m256 Type;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX static Type load(const Float* const data) {
+        return _mm256_loadu_ps(data);
+    }
+    CORRADE_ENABLE_AVX static UnsignedInt nan(const Type value) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+    }
+    CORRADE_ENABLE_AVX static UnsignedInt inf(const Type value) {
+        return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_and_ps(value, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff))), _mm256_castsi256_ps(_mm256_set1_epi32(0x7f800000)), _CMP_EQ_OQ));
+    }
+};
+
+template<> struct TestAvx<Double> {
+    typedef __m256d Type;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_AVX static Type load(const Double* const data) {
+        return _mm256_loadu_pd(data);
+    }
+    CORRADE_ENABLE_AVX static UnsignedInt nan(const Type value) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(value, value, _CMP_UNORD_Q));
+    }
+    CORRADE_ENABLE_AVX static UnsignedInt inf(const Type value) {
+        return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_and_pd(value, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7fffffffffffffffll))), _mm256_castsi256_pd(_mm256_set1_epi64x(0x7ff0000000000000ll)), _CMP_EQ_OQ));
+    }
+};
+
+template<class T, bool inf> CORRADE_ENABLE_AVX void testIntoAvx(const char* src, const std::ptrdiff_t srcStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef TestAvx<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const bool contiguous = srcStride == std::ptrdiff_t(sizeof(T));
+    T block[chunk];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        const T* in = reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!contiguous) {
+            for(std::size_t k = 0; k != chunk; ++k)
+                std::memcpy(block + k, src + std::ptrdiff_t(i + k)*srcStride, sizeof(T));
+            in = block;
+        }
+
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes)
+            bits |= (inf ? Vector::inf(Vector::load(in + k)) : Vector::nan(Vector::load(in + k))) << k;
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    testIntoScalar<T, inf>(src + std::ptrdiff_t(i)*srcStride, srcStride, size - i, dst, dstOffset + i);
+}
+
+template<class T, bool inf> CORRADE_ENABLE_AVX bool testAnyAvx(const char* src, const std::ptrdiff_t srcStride, const std::size_t size) {
+    typedef TestAvx<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = 4*lanes;
+    const bool contiguous = srcStride == std::ptrdiff_t(sizeof(T));
+    T block[chunk];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        const T* in = reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!contiguous) {
+            for(std::size_t k = 0; k != chunk; ++k)
+                std::memcpy(block + k, src + std::ptrdiff_t(i + k)*srcStride, sizeof(T));
+            in = block;
+        }
+
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes)
+            bits |= inf ? Vector::inf(Vector::load(in + k)) : Vector::nan(Vector::load(in + k));
+        if(bits) return true;
+    }
+
+    return testAnyScalar<T, inf>(src + std::ptrdiff_t(i)*srcStride, srcStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+template<class T> struct TestAvx512;
+
+template<> struct TestAvx512<Float> {
+    typedef __m512 Type;
+    enum: std::size_t { Lanes = 16 };
+
+    CORRADE_ENABLE_AVX512F static Type load(const Float* const data) {
+        return _mm512_loadu_ps(data);
+    }
+    CORRADE_ENABLE_AVX512F static UnsignedInt nan(const Type value) {
+        return _mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q);
+    }
+    CORRADE_ENABLE_AVX512F static UnsignedInt inf(const Type value) {
+        return _mm512_cmpeq_epi32_mask(_mm512_and_epi32(_mm512_castps_si512(value), _mm512_set1_epi32(0x7fffffff)), _mm512_set1_epi32(0x7f800000));
+    }
+};
+
+template<> struct TestAvx512<Double> {
+    typedef __m512d Type;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX512F static Type load(const Double* const data) {
+        return _mm512_loadu_pd(data);
+    }
+    CORRADE_ENABLE_AVX512F static UnsignedInt nan(const Type value) {
+        return _mm512_cmp_pd_mask(value, value, _CMP_UNORD_Q);
+    }
+    CORRADE_ENABLE_AVX512F static UnsignedInt inf(const Type value) {
+        return _mm512_cmpeq_epi64_mask(_mm512_and_epi64(_mm512_castpd_si512(value), _mm512_set1_epi64(0x7fffffffffffffffll)), _mm512_set1_epi64(0x7ff0000000000000ll));
+    }
+};
+
+template<class T, bool inf> CORRADE_ENABLE_AVX512F void testIntoAvx512(const char* src, const std::ptrdiff_t srcStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef TestAvx512<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const bool contiguous = srcStride == std::ptrdiff_t(sizeof(T));
+    T block[chunk];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        const T* in = reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!contiguous) {
+            for(std::size_t k = 0; k != chunk; ++k)
+                std::memcpy(block + k, src + std::ptrdiff_t(i + k)*srcStride, sizeof(T));
+            in = block;
+        }
+
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes)
+            bits |= (inf ? Vector::inf(Vector::load(in + k)) : Vector::nan(Vector::load(in + k))) << k;
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    testIntoScalar<T, inf>(src + std::ptrdiff_t(i)*srcStride, srcStride, size - i, dst, dstOffset + i);
+}
+
+template<class T, bool inf> CORRADE_ENABLE_AVX512F bool testAnyAvx512(const char* src, const std::ptrdiff_t srcStride, const std::size_t size) {
+    typedef TestAvx512<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = 4*lanes;
+    const bool contiguous = srcStride == std::ptrdiff_t(sizeof(T));
+    T block[chunk];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        const T* in = reinterpret_cast<const T*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!contiguous) {
+            for(std::size_t k = 0; k != chunk; ++k)
+                std::memcpy(block + k, src + std::ptrdiff_t(i + k)*srcStride, sizeof(T));
+            in = block;
+        }
+
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes)
+            bits |= inf ? Vector::inf(Vector::load(in + k)) : Vector::nan(Vector::load(in + k));
+        if(bits) return true;
+    }
+
+    return testAnyScalar<T, inf>(src + std::ptrdiff_t(i)*srcStride, srcStride, size - i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isInfIntoFloat)>::type isInfIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testIntoSse2<Float, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isInfIntoFloat)>::type isInfIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testIntoAvx<Float, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isInfIntoFloat)>::type isInfIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testIntoAvx512<Float, true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isInfIntoFloat)>::type isInfIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testIntoScalar<Float, true>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isInfIntoFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isInfIntoFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfIntoFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    isInfIntoFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isInfAnyFloat)>::type isInfAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testAnySse2<Float, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isInfAnyFloat)>::type isInfAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testAnyAvx<Float, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isInfAnyFloat)>::type isInfAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testAnyAvx512<Float, true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isInfAnyFloat)>::type isInfAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testAnyScalar<Float, true>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isInfAnyFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isInfAnyFloatImplementation, bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfAnyFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size))({
+    return isInfAnyFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isInfIntoDouble)>::type isInfIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testIntoSse2<Double, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isInfIntoDouble)>::type isInfIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testIntoAvx<Double, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isInfIntoDouble)>::type isInfIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testIntoAvx512<Double, true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isInfIntoDouble)>::type isInfIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testIntoScalar<Double, true>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isInfIntoDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isInfIntoDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfIntoDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    isInfIntoDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isInfAnyDouble)>::type isInfAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testAnySse2<Double, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isInfAnyDouble)>::type isInfAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testAnyAvx<Double, true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isInfAnyDouble)>::type isInfAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testAnyAvx512<Double, true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isInfAnyDouble)>::type isInfAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testAnyScalar<Double, true>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isInfAnyDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isInfAnyDoubleImplementation, bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isInfAnyDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size))({
+    return isInfAnyDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isNanIntoFloat)>::type isNanIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testIntoSse2<Float, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isNanIntoFloat)>::type isNanIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testIntoAvx<Float, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isNanIntoFloat)>::type isNanIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testIntoAvx512<Float, false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isNanIntoFloat)>::type isNanIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testIntoScalar<Float, false>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isNanIntoFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isNanIntoFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanIntoFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    isNanIntoFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isNanAnyFloat)>::type isNanAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testAnySse2<Float, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isNanAnyFloat)>::type isNanAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testAnyAvx<Float, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isNanAnyFloat)>::type isNanAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testAnyAvx512<Float, false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isNanAnyFloat)>::type isNanAnyFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testAnyScalar<Float, false>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isNanAnyFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isNanAnyFloatImplementation, bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanAnyFloat)(const char* src, std::ptrdiff_t srcStride, std::size_t size))({
+    return isNanAnyFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isNanIntoDouble)>::type isNanIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testIntoSse2<Double, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isNanIntoDouble)>::type isNanIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testIntoAvx<Double, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isNanIntoDouble)>::type isNanIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testIntoAvx512<Double, false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isNanIntoDouble)>::type isNanIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testIntoScalar<Double, false>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isNanIntoDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isNanIntoDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanIntoDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    isNanIntoDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(isNanAnyDouble)>::type isNanAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return testAnySse2<Double, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(isNanAnyDouble)>::type isNanAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return testAnyAvx<Double, false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(isNanAnyDouble)>::type isNanAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return testAnyAvx512<Double, false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(isNanAnyDouble)>::type isNanAnyDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return testAnyScalar<Double, false>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(isNanAnyDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(isNanAnyDoubleImplementation, bool CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(isNanAnyDouble)(const char* src, std::ptrdiff_t srcStride, std::size_t size))({
+    return isNanAnyDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, size);
+})
+
+}
+
+bool isInfAny(const Containers::StridedArrayView1D<const Float>& range) {
+    return Implementation::isInfAnyFloat(static_cast<const char*>(range.data()), range.stride(), range.size());
+}
+
+bool isInfAny(const Containers::StridedArrayView1D<const Double>& range) {
+    return Implementation::isInfAnyDouble(static_cast<const char*>(range.data()), range.stride(), range.size());
+}
+
+bool isNanAny(const Containers::StridedArrayView1D<const Float>& range) {
+    return Implementation::isNanAnyFloat(static_cast<const char*>(range.data()), range.stride(), range.size());
+}
+
+bool isNanAny(const Containers::StridedArrayView1D<const Double>& range) {
+    return Implementation::isNanAnyDouble(static_cast<const char*>(range.data()), range.stride(), range.size());
+}
+
+namespace {
+
+template<class T> void testInto(const Implementation::TestIntoFunction function, const Containers::StridedArrayView1D<const T>& src, const Containers::MutableStridedBitArrayView1D& dst) {
+    const char* srcPtr = static_cast<const char*>(src.data());
+    if(dst.isContiguous()) {
+        function(srcPtr, src.stride(), src.size(), static_cast<char*>(dst.data()), dst.offset());
+        return;
+    }
+
+    char bits[64];
+    for(std::size_t i = 0; i < src.size(); i += sizeof(bits)*8) {
+        const std::size_t size = Math::min(src.size() - i, sizeof(bits)*8);
+        function(srcPtr + std::ptrdiff_t(i)*src.stride(), src.stride(), size, bits, 0);
+        for(std::size_t j = 0; j != size; ++j)
+            dst.set(i + j, bits[j >> 3] & (1 << (j & 0x07)));
+    }
+}
+
+template<class T> void isInfIntoImplementation(const Containers::StridedArrayView1D<const T>& src, const Containers::MutableStridedBitArrayView1D& dst, const Implementation::TestIntoFunction function) {
+    CORRADE_ASSERT(src.size() == dst.size()[0],
+        "Math::isInfInto(): wrong destination size, got" << dst.size()[0] << "but expected" << src.size(), );
+    testInto(function, src, dst);
+}
+
+template<class T> void isNanIntoImplementation(const Containers::StridedArrayView1D<const T>& src, const Containers::MutableStridedBitArrayView1D& dst, const Implementation::TestIntoFunction function) {
+    CORRADE_ASSERT(src.size() == dst.size()[0],
+        "Math::isNanInto(): wrong destination size, got" << dst.size()[0] << "but expected" << src.size(), );
+    testInto(function, src, dst);
+}
+
+}
+
+void isInfInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::MutableStridedBitArrayView1D& dst) {
+    isInfIntoImplementation(src, dst, Implementation::isInfIntoFloat);
+}
+
+void isInfInto(const Containers::StridedArrayView1D<const Double>& src, const Containers::MutableStridedBitArrayView1D& dst) {
+    isInfIntoImplementation(src, dst, Implementation::isInfIntoDouble);
+}
+
+void isNanInto(const Containers::StridedArrayView1D<const Float>& src, const Containers::MutableStridedBitArrayView1D& dst) {
+    isNanIntoImplementation(src, dst, Implementation::isNanIntoFloat);
+}
+
+void isNanInto(const Containers::StridedArrayView1D<const Double>& src, const Containers::MutableStridedBitArrayView1D& dst) {
+    isNanIntoImplementation(src, dst, Implementation::isNanIntoDouble);
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedByte)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedByte* min, UnsignedByte* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoByte)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Byte* min, Byte* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedShort)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedShort* min, UnsignedShort* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoShort)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Short* min, Short* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedInt)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedInt* min, UnsignedInt* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoInt)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Int* min, Int* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedLong)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedLong* min, UnsignedLong* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoLong)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Long* min, Long* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoFloat)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Float* min, Float* max);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoDouble)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Double* min, Double* max);
+
+namespace {
+
+template<class T, std::size_t components> void minmaxComponentsIntoScalar(const char* data, const std::ptrdiff_t stride, const std::size_t size, T* const min, T* const max) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const T* in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+        for(std::size_t j = 0; j != components; ++j) {
+            if(min) min[j] = Math::min(min[j], in[j]);
+            if(max) max[j] = Math::max(max[j], in[j]);
+        }
+    }
+}
+
+template<class T> void minmaxIntoScalar(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, T* const min, T* const max) {
+    switch(components) {
+        case 1: return minmaxComponentsIntoScalar<T, 1>(data, stride, size, min, max);
+        case 2: return minmaxComponentsIntoScalar<T, 2>(data, stride, size, min, max);
+        case 3: return minmaxComponentsIntoScalar<T, 3>(data, stride, size, min, max);
+        case 4: return minmaxComponentsIntoScalar<T, 4>(data, stride, size, min, max);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+
+template<class T, std::size_t components> inline void minmaxFinalize(const T* const block, T* const min, T* const max, const std::size_t lanes) {
+    for(std::size_t j = 0; j != components*lanes; ++j) {
+        if(min) min[j % components] = Math::min(min[j % components], block[j]);
+        if(max) max[j % components] = Math::max(max[j % components], block[j]);
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class T> struct MinmaxSse2;
+
+template<class T> struct MinmaxSse2Integral {
+    typedef __m128i Type;
+    enum: std::size_t { Lanes = 16/sizeof(T) };
+
+    CORRADE_ENABLE_SSE2 static Type load(const T* const data) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+
+    CORRADE_ENABLE_SSE2 static void store(T* const data, const Type value) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+    }
+};
+
+template<> struct MinmaxSse2<UnsignedByte>: MinmaxSse2Integral<UnsignedByte> {
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) { return _mm_min_epu8(a, b); }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) { return _mm_max_epu8(a, b); }
+};
+
+template<> struct MinmaxSse2<Byte>: MinmaxSse2Integral<Byte> {
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) {
+        const __m128i bias = _mm_set1_epi8(-128);
+        return _mm_xor_si128(_mm_min_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+    }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) {
+        const __m128i bias = _mm_set1_epi8(-128);
+        return _mm_xor_si128(_mm_max_epu8(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+    }
+};
+
+template<> struct MinmaxSse2<Short>: MinmaxSse2Integral<Short> {
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) { return _mm_min_epi16(a, b); }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) { return _mm_max_epi16(a, b); }
+};
+
+template<> struct MinmaxSse2<UnsignedShort>: MinmaxSse2Integral<UnsignedShort> {
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) {
+        const __m128i bias = _mm_set1_epi16(-32768);
+        return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+    }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) {
+        const __m128i bias = _mm_set1_epi16(-32768);
+        return _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+    }
+};
+
+template<> struct MinmaxSse2<Int>: MinmaxSse2Integral<Int> {
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) {
+        const __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) {
+        const __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+template<> struct MinmaxSse2<UnsignedInt>: MinmaxSse2Integral<UnsignedInt> {
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) {
+        const __m128i bias = _mm_set1_epi32(Int(0x80000000u));
+        return _mm_xor_si128(MinmaxSse2<Int>::min(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+    }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) {
+        const __m128i bias = _mm_set1_epi32(Int(0x80000000u));
+        return _mm_xor_si128(MinmaxSse2<Int>::max(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias)), bias);
+    }
+};
+
+template<> struct MinmaxSse2<Float> {
+    typedef __m128 Type;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_SSE2 static Type load(const Float* const data) { return _mm_loadu_ps(data); }
+    CORRADE_ENABLE_SSE2 static void store(Float* const data, const Type value) { _mm_storeu_ps(data, value); }
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) { return _mm_min_ps(a, b); }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) { return _mm_max_ps(a, b); }
+};
+
+template<> struct MinmaxSse2<Double> {
+    typedef __m128d Type;
+    enum: std::size_t { Lanes = 2 };
+
+    CORRADE_ENABLE_SSE2 static Type load(const Double* const data) { return _mm_loadu_pd(data); }
+    CORRADE_ENABLE_SSE2 static void store(Double* const data, const Type value) { _mm_storeu_pd(data, value); }
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) { return _mm_min_pd(a, b); }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) { return _mm_max_pd(a, b); }
+};
+
+template<class T, std::size_t components> CORRADE_ENABLE_SSE2 void minmaxComponentsIntoSse2(const char* data, const std::ptrdiff_t stride, const std::size_t size, T* const min, T* const max) {
+    typedef MinmaxSse2<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    T block[components*lanes];
+    typename Vector::Type minV[components], maxV[components];
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = min ? min[j % components] : T{};
+    for(std::size_t j = 0; j != components; ++j)
+        minV[j] = Vector::load(block + j*lanes);
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = max ? max[j % components] : T{};
+    for(std::size_t j = 0; j != components; ++j)
+        maxV[j] = Vector::load(block + j*lanes);
+
+    std::size_t i = 0;
+    if(stride == std::ptrdiff_t(components*sizeof(T))) {
+        for(; i + lanes <= size; i += lanes) {
+            const T* in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::load(in + j*lanes);
+                if(min) minV[j] = Vector::min(value, minV[j]);
+                if(max) maxV[j] = Vector::max(value, maxV[j]);
+            }
+        }
+    } else {
+        for(; i + lanes <= size; i += lanes) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*components, data + std::ptrdiff_t(i + k)*stride, components*sizeof(T));
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::load(block + j*lanes);
+                if(min) minV[j] = Vector::min(value, minV[j]);
+                if(max) maxV[j] = Vector::max(value, maxV[j]);
+            }
+        }
+    }
+
+    if(min) {
+        for(std::size_t j = 0; j != components; ++j)
+            Vector::store(block + j*lanes, minV[j]);
+        minmaxFinalize<T, components>(block, min, nullptr, lanes);
+    }
+    if(max) {
+        for(std::size_t j = 0; j != components; ++j)
+            Vector::store(block + j*lanes, maxV[j]);
+        minmaxFinalize<T, components>(block, nullptr, max, lanes);
+    }
+
+    minmaxComponentsIntoScalar<T, components>(data + std::ptrdiff_t(i)*stride, stride, size - i, min, max);
+}
+
+template<class T> void minmaxIntoSse2(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, T* const min, T* const max) {
+    switch(components) {
+        case 1: return minmaxComponentsIntoSse2<T, 1>(data, stride, size, min, max);
+        case 2: return minmaxComponentsIntoSse2<T, 2>(data, stride, size, min, max);
+        case 3: return minmaxComponentsIntoSse2<T, 3>(data, stride, size, min, max);
+        case 4: return minmaxComponentsIntoSse2<T, 4>(data, stride, size, min, max);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+template<class T> struct MinmaxAvx2;
+
+template<class T> struct MinmaxAvx2Integral {
+    typedef __m256i Type;
+    enum: std::size_t { Lanes = 32/sizeof(T) };
+
+    CORRADE_ENABLE_AVX2 static Type load(const T* const data) {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    }
+
+    CORRADE_ENABLE_AVX2 static void store(T* const data, const Type value) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+    }
+};
+
+template<> struct MinmaxAvx2<UnsignedByte>: MinmaxAvx2Integral<UnsignedByte> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_epu8(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_epu8(a, b); }
+};
+
+template<> struct MinmaxAvx2<Byte>: MinmaxAvx2Integral<Byte> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_epi8(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_epi8(a, b); }
+};
+
+template<> struct MinmaxAvx2<UnsignedShort>: MinmaxAvx2Integral<UnsignedShort> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_epu16(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_epu16(a, b); }
+};
+
+template<> struct MinmaxAvx2<Short>: MinmaxAvx2Integral<Short> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_epi16(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_epi16(a, b); }
+};
+
+template<> struct MinmaxAvx2<UnsignedInt>: MinmaxAvx2Integral<UnsignedInt> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_epu32(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_epu32(a, b); }
+};
+
+template<> struct MinmaxAvx2<Int>: MinmaxAvx2Integral<Int> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_epi32(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_epi32(a, b); }
+};
+
+template<> struct MinmaxAvx2<Long>: MinmaxAvx2Integral<Long> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+};
+
+template<> struct MinmaxAvx2<UnsignedLong>: MinmaxAvx2Integral<UnsignedLong> {
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) {
+        const __m256i bias = _mm256_set1_epi64x(Long(0x8000000000000000ull));
+        return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias)));
+    }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) {
+        const __m256i bias = _mm256_set1_epi64x(Long(0x8000000000000000ull));
+        return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias)));
+    }
+};
+
+template<> struct MinmaxAvx2<Float> {
+    typedef __m256 Type;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX2 static Type load(const Float* const data) { return _mm256_loadu_ps(data); }
+    CORRADE_ENABLE_AVX2 static void store(Float* const data, const Type value) { _mm256_storeu_ps(data, value); }
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_ps(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_ps(a, b); }
+};
+
+template<> struct MinmaxAvx2<Double> {
+    typedef __m256d Type;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_AVX2 static Type load(const Double* const data) { return _mm256_loadu_pd(data); }
+    CORRADE_ENABLE_AVX2 static void store(Double* const data, const Type value) { _mm256_storeu_pd(data, value); }
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) { return _mm256_min_pd(a, b); }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) { return _mm256_max_pd(a, b); }
+};
+
+template<class T, std::size_t components> CORRADE_ENABLE_AVX2 void minmaxComponentsIntoAvx2(const char* data, const std::ptrdiff_t stride, const std::size_t size, T* const min, T* const max) {
+    typedef MinmaxAvx2<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    T block[components*lanes];
+    typename Vector::Type minV[components], maxV[components];
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = min ? min[j % components] : T{};
+    for(std::size_t j = 0; j != components; ++j)
+        minV[j] = Vector::load(block + j*lanes);
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = max ? max[j % components] : T{};
+    for(std::size_t j = 0; j != components; ++j)
+        maxV[j] = Vector::load(block + j*lanes);
+
+    std::size_t i = 0;
+    if(stride == std::ptrdiff_t(components*sizeof(T))) {
+        for(; i + lanes <= size; i += lanes) {
+            const T* in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::load(in + j*lanes);
+                if(min) minV[j] = Vector::min(value, minV[j]);
+                if(max) maxV[j] = Vector::max(value, maxV[j]);
+            }
+        }
+    } else {
+        for(; i + lanes <= size; i += lanes) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*components, data + std::ptrdiff_t(i + k)*stride, components*sizeof(T));
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::load(block + j*lanes);
+                if(min) minV[j] = Vector::min(value, minV[j]);
+                if(max) maxV[j] = Vector::max(value, maxV[j]);
+            }
+        }
+    }
+
+    if(min) {
+        for(std::size_t j = 0; j != components; ++j)
+            Vector::store(block + j*lanes, minV[j]);
+        minmaxFinalize<T, components>(block, min, nullptr, lanes);
+    }
+    if(max) {
+        for(std::size_t j = 0; j != components; ++j)
+            Vector::store(block + j*lanes, maxV[j]);
+        minmaxFinalize<T, components>(block, nullptr, max, lanes);
+    }
+
+    minmaxComponentsIntoScalar<T, components>(data + std::ptrdiff_t(i)*stride, stride, size - i, min, max);
+}
+
+template<class T> void minmaxIntoAvx2(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, T* const min, T* const max) {
+    switch(components) {
+        case 1: return minmaxComponentsIntoAvx2<T, 1>(data, stride, size, min, max);
+        case 2: return minmaxComponentsIntoAvx2<T, 2>(data, stride, size, min, max);
+        case 3: return minmaxComponentsIntoAvx2<T, 3>(data, stride, size, min, max);
+        case 4: return minmaxComponentsIntoAvx2<T, 4>(data, stride, size, min, max);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+template<class T> struct MinmaxAvx512;
+
+template<class T> struct MinmaxAvx512Integral {
+    typedef __m512i Type;
+    enum: std::size_t { Lanes = 64/sizeof(T) };
+
+    CORRADE_ENABLE_AVX512F static Type load(const T* const data) {
+        return _mm512_loadu_si512(data);
+    }
+
+    CORRADE_ENABLE_AVX512F static void store(T* const data, const Type value) {
+        _mm512_storeu_si512(data, value);
+    }
+};
+
+template<> struct MinmaxAvx512<UnsignedInt>: MinmaxAvx512Integral<UnsignedInt> {
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) { return _mm512_min_epu32(a, b); }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) { return _mm512_max_epu32(a, b); }
+};
+
+template<> struct MinmaxAvx512<Int>: MinmaxAvx512Integral<Int> {
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) { return _mm512_min_epi32(a, b); }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) { return _mm512_max_epi32(a, b); }
+};
+
+template<> struct MinmaxAvx512<UnsignedLong>: MinmaxAvx512Integral<UnsignedLong> {
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) { return _mm512_min_epu64(a, b); }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) { return _mm512_max_epu64(a, b); }
+};
+
+template<> struct MinmaxAvx512<Long>: MinmaxAvx512Integral<Long> {
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) { return _mm512_min_epi64(a, b); }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) { return _mm512_max_epi64(a, b); }
+};
+
+template<> struct MinmaxAvx512<Float> {
+    typedef __m512 Type;
+    enum: std::size_t { Lanes = 16 };
+
+    CORRADE_ENABLE_AVX512F static Type load(const Float* const data) { return _mm512_loadu_ps(data); }
+    CORRADE_ENABLE_AVX512F static void store(Float* const data, const Type value) { _mm512_storeu_ps(data, value); }
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) { return _mm512_min_ps(a, b); }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) { return _mm512_max_ps(a, b); }
+};
+
+template<> struct MinmaxAvx512<Double> {
+    typedef __m512d Type;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX512F static Type load(const Double* const data) { return _mm512_loadu_pd(data); }
+    CORRADE_ENABLE_AVX512F static void store(Double* const data, const Type value) { _mm512_storeu_pd(data, value); }
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) { return _mm512_min_pd(a, b); }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) { return _mm512_max_pd(a, b); }
+};
+
+template<class T, std::size_t components> CORRADE_ENABLE_AVX512F void minmaxComponentsIntoAvx512(const char* data, const std::ptrdiff_t stride, const std::size_t size, T* const min, T* const max) {
+    typedef MinmaxAvx512<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    T block[components*lanes];
+    typename Vector::Type minV[components], maxV[components];
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = min ? min[j % components] : T{};
+    for(std::size_t j = 0; j != components; ++j)
+        minV[j] = Vector::load(block + j*lanes);
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = max ? max[j % components] : T{};
+    for(std::size_t j = 0; j != components; ++j)
+        maxV[j] = Vector::load(block + j*lanes);
+
+    std::size_t i = 0;
+    if(stride == std::ptrdiff_t(components*sizeof(T))) {
+        for(; i + lanes <= size; i += lanes) {
+            const T* in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::load(in + j*lanes);
+                if(min) minV[j] = Vector::min(value, minV[j]);
+                if(max) maxV[j] = Vector::max(value, maxV[j]);
+            }
+        }
+    } else {
+        for(; i + lanes <= size; i += lanes) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*components, data + std::ptrdiff_t(i + k)*stride, components*sizeof(T));
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::load(block + j*lanes);
+                if(min) minV[j] = Vector::min(value, minV[j]);
+                if(max) maxV[j] = Vector::max(value, maxV[j]);
+            }
+        }
+    }
+
+    if(min) {
+        for(std::size_t j = 0; j != components; ++j)
+            Vector::store(block + j*lanes, minV[j]);
+        minmaxFinalize<T, components>(block, min, nullptr, lanes);
+    }
+    if(max) {
+        for(std::size_t j = 0; j != components; ++j)
+            Vector::store(block + j*lanes, maxV[j]);
+        minmaxFinalize<T, components>(block, nullptr, max, lanes);
+    }
+
+    minmaxComponentsIntoScalar<T, components>(data + std::ptrdiff_t(i)*stride, stride, size - i, min, max);
+}
+
+template<class T> void minmaxIntoAvx512(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, T* const min, T* const max) {
+    switch(components) {
+        case 1: return minmaxComponentsIntoAvx512<T, 1>(data, stride, size, min, max);
+        case 2: return minmaxComponentsIntoAvx512<T, 2>(data, stride, size, min, max);
+        case 3: return minmaxComponentsIntoAvx512<T, 3>(data, stride, size, min, max);
+        case 4: return minmaxComponentsIntoAvx512<T, 4>(data, stride, size, min, max);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoUnsignedByte)>::type minmaxIntoUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<UnsignedByte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoUnsignedByte)>::type minmaxIntoUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<UnsignedByte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoUnsignedByte)>::type minmaxIntoUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<UnsignedByte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoUnsignedByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoUnsignedByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedByte)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedByte* min, UnsignedByte* max))({
+    minmaxIntoUnsignedByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoByte)>::type minmaxIntoByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoByte)>::type minmaxIntoByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoByte)>::type minmaxIntoByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoByte)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Byte* min, Byte* max))({
+    minmaxIntoByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoUnsignedShort)>::type minmaxIntoUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<UnsignedShort>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoUnsignedShort)>::type minmaxIntoUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<UnsignedShort>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoUnsignedShort)>::type minmaxIntoUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<UnsignedShort>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoUnsignedShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoUnsignedShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedShort)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedShort* min, UnsignedShort* max))({
+    minmaxIntoUnsignedShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoShort)>::type minmaxIntoShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoShort)>::type minmaxIntoShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoShort)>::type minmaxIntoShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoShort)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Short* min, Short* max))({
+    minmaxIntoShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoUnsignedInt)>::type minmaxIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoUnsignedInt)>::type minmaxIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<UnsignedInt>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(minmaxIntoUnsignedInt)>::type minmaxIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return minmaxIntoAvx512<UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoUnsignedInt)>::type minmaxIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoUnsignedIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedInt)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedInt* min, UnsignedInt* max))({
+    minmaxIntoUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoInt)>::type minmaxIntoIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoInt)>::type minmaxIntoIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<Int>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(minmaxIntoInt)>::type minmaxIntoIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return minmaxIntoAvx512<Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoInt)>::type minmaxIntoIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoInt)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Int* min, Int* max))({
+    minmaxIntoIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoUnsignedLong)>::type minmaxIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<UnsignedLong>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(minmaxIntoUnsignedLong)>::type minmaxIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return minmaxIntoAvx512<UnsignedLong>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoUnsignedLong)>::type minmaxIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<UnsignedLong>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoUnsignedLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoUnsignedLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoUnsignedLong)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, UnsignedLong* min, UnsignedLong* max))({
+    minmaxIntoUnsignedLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoLong)>::type minmaxIntoLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<Long>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(minmaxIntoLong)>::type minmaxIntoLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return minmaxIntoAvx512<Long>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoLong)>::type minmaxIntoLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<Long>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoLong)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Long* min, Long* max))({
+    minmaxIntoLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoFloat)>::type minmaxIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoFloat)>::type minmaxIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<Float>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(minmaxIntoFloat)>::type minmaxIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return minmaxIntoAvx512<Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoFloat)>::type minmaxIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoFloat)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Float* min, Float* max))({
+    minmaxIntoFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(minmaxIntoDouble)>::type minmaxIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return minmaxIntoSse2<Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(minmaxIntoDouble)>::type minmaxIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return minmaxIntoAvx2<Double>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(minmaxIntoDouble)>::type minmaxIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return minmaxIntoAvx512<Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(minmaxIntoDouble)>::type minmaxIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return minmaxIntoScalar<Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(minmaxIntoDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(minmaxIntoDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(minmaxIntoDouble)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, Double* min, Double* max))({
+    minmaxIntoDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, min, max);
+})
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedByte* const min, UnsignedByte* const max) {
+    minmaxIntoUnsignedByte(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Byte* const min, Byte* const max) {
+    minmaxIntoByte(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedShort* const min, UnsignedShort* const max) {
+    minmaxIntoUnsignedShort(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Short* const min, Short* const max) {
+    minmaxIntoShort(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedInt* const min, UnsignedInt* const max) {
+    minmaxIntoUnsignedInt(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Int* const min, Int* const max) {
+    minmaxIntoInt(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, UnsignedLong* const min, UnsignedLong* const max) {
+    minmaxIntoUnsignedLong(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Long* const min, Long* const max) {
+    minmaxIntoLong(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Float* const min, Float* const max) {
+    minmaxIntoFloat(data, stride, size, components, min, max);
+}
+
+void minmaxInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Double* const min, Double* const max) {
+    minmaxIntoDouble(data, stride, size, components, min, max);
+}
+
+}
+
+namespace {
+
+template<class T, class U> inline void batchInto(const Implementation::BatchFunction function, const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst) {
+    if(src.isContiguous() && dst.isContiguous())
+        function(reinterpret_cast<const char*>(src.data()), 0, reinterpret_cast<char*>(dst.data()), 0, 1, src.size()[0]*src.size()[1]);
+    else
+        function(reinterpret_cast<const char*>(src.data()), src.stride()[0], reinterpret_cast<char*>(dst.data()), dst.stride()[0], src.size()[0], src.size()[1]);
+}
+
+template<class T> inline void unpackIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<Float>& dst, const Implementation::BatchFunction function) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.template isContiguous<1>(),
+        "Math::unpackInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::unpackInto(): second destination view dimension is not contiguous", );
+
+    batchInto(function, src, dst);
+}
+
+template<class T> inline void packIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst, const Implementation::BatchFunction function) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::packInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.template isContiguous<1>(),
+        "Math::packInto(): second destination view dimension is not contiguous", );
+
+    batchInto(function, src, dst);
+}
+
+}
+
+void unpackInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackIntoImplementation(src, dst, Implementation::unpackUnsignedByteInto);
+}
+
+void unpackInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackIntoImplementation(src, dst, Implementation::unpackUnsignedShortInto);
+}
+
+void unpackInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackIntoImplementation(src, dst, Implementation::unpackByteInto);
+}
+
+void unpackInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    unpackIntoImplementation(src, dst, Implementation::unpackShortInto);
+}
+
+void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    packIntoImplementation(src, dst, Implementation::packUnsignedByteInto);
+}
+
+void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    packIntoImplementation(src, dst, Implementation::packUnsignedShortInto);
+}
+
+void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    packIntoImplementation(src, dst, Implementation::packByteInto);
+}
+
+void packInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    packIntoImplementation(src, dst, Implementation::packShortInto);
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteUnsignedLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortUnsignedLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntUnsignedLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedLongUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoLongInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedLongUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoLongShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedLongUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoLongByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+
+namespace {
+
+template<class T> struct IsInt32Like: std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) <= 4> {};
+template<class T> struct IsInt64: std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) == 8> {};
+
+template<class T, class U> void castIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        U* dstI = reinterpret_cast<U*>(dst);
+        for(std::size_t j = 0; j != rowSize; ++j)
+            dstI[j] = U(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_ENABLE_SSE41 inline __m128i widenSse41(const UnsignedInt* const data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+CORRADE_ENABLE_SSE41 inline __m128i widenSse41(const Int* const data) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+}
+
+CORRADE_ENABLE_SSE41 inline void truncateSse41(UnsignedByte* const data, const __m128i value) {
+    const __m128i packed = _mm_packus_epi32(_mm_and_si128(value, _mm_set1_epi32(0xff)), _mm_setzero_si128());
+    const Int out = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+    std::memcpy(data, &out, 4);
+}
+
+CORRADE_ENABLE_SSE41 inline void truncateSse41(Byte* const data, const __m128i value) {
+    truncateSse41(reinterpret_cast<UnsignedByte*>(data), value);
+}
+
+CORRADE_ENABLE_SSE41 inline void truncateSse41(UnsignedShort* const data, const __m128i value) {
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_packus_epi32(_mm_and_si128(value, _mm_set1_epi32(0xffff)), _mm_setzero_si128()));
+}
+
+CORRADE_ENABLE_SSE41 inline void truncateSse41(Short* const data, const __m128i value) {
+    truncateSse41(reinterpret_cast<UnsignedShort*>(data), value);
+}
+
+CORRADE_ENABLE_SSE41 inline void truncateSse41(UnsignedInt* const data, const __m128i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+CORRADE_ENABLE_SSE41 inline void truncateSse41(Int* const data, const __m128i value) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), value);
+}
+
+template<class T> CORRADE_ENABLE_SSE41 inline __m128 toFloatSse41(const __m128i value) {
+    if(std::is_same<T, UnsignedInt>::value)
+        return _mm_add_ps(
+            _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(value, 16)), _mm_set1_ps(65536.0f)),
+            _mm_cvtepi32_ps(_mm_and_si128(value, _mm_set1_epi32(0xffff))));
+    return _mm_cvtepi32_ps(value);
+}
+
+template<class U> CORRADE_ENABLE_SSE41 inline __m128i fromFloatSse41(const __m128 value) {
+    if(std::is_same<U, UnsignedInt>::value) {
+        const __m128 big = _mm_cmpge_ps(value, _mm_set1_ps(2147483648.0f));
+        const __m128 shifted = _mm_blendv_ps(value, _mm_sub_ps(value, _mm_set1_ps(2147483648.0f)), big);
+        return _mm_xor_si128(_mm_cvttps_epi32(shifted), _mm_and_si128(_mm_castps_si128(big), _mm_set1_epi32(Int(0x80000000u))));
+    }
+    return _mm_cvttps_epi32(value);
+}
+
+template<class T> CORRADE_ENABLE_SSE41 inline __m128d toDoubleSse41(const __m128i value) {
+    if(std::is_same<T, UnsignedInt>::value)
+        return _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(value, _mm_set1_epi32(Int(0x80000000u)))), _mm_set1_pd(2147483648.0));
+    return _mm_cvtepi32_pd(value);
+}
+
+template<class U> CORRADE_ENABLE_SSE41 inline __m128i fromDoubleSse41(const __m128d value) {
+    if(std::is_same<U, UnsignedInt>::value)
+        return _mm_xor_si128(_mm_cvttpd_epi32(_mm_sub_pd(_mm_round_pd(value, _MM_FROUND_TO_ZERO|_MM_FROUND_NO_EXC), _mm_set1_pd(2147483648.0))), _mm_set1_epi32(Int(0x80000000u)));
+    return _mm_cvttpd_epi32(value);
+}
+
+template<class T, class U, typename std::enable_if<IsInt32Like<T>::value && IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const T* const src, U* const dst) {
+    truncateSse41(dst, widenSse41(src));
+}
+
+template<class T, typename std::enable_if<IsInt32Like<T>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const T* const src, Float* const dst) {
+    _mm_storeu_ps(dst, toFloatSse41<T>(widenSse41(src)));
+}
+
+template<class U, typename std::enable_if<IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const Float* const src, U* const dst) {
+    truncateSse41(dst, fromFloatSse41<U>(_mm_loadu_ps(src)));
+}
+
+template<class T, typename std::enable_if<IsInt32Like<T>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const T* const src, Double* const dst) {
+    const __m128i value = widenSse41(src);
+    _mm_storeu_pd(dst, toDoubleSse41<T>(value));
+    _mm_storeu_pd(dst + 2, toDoubleSse41<T>(_mm_srli_si128(value, 8)));
+}
+
+template<class U, typename std::enable_if<IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const Double* const src, U* const dst) {
+    truncateSse41(dst, _mm_unpacklo_epi64(fromDoubleSse41<U>(_mm_loadu_pd(src)), fromDoubleSse41<U>(_mm_loadu_pd(src + 2))));
+}
+
+CORRADE_ENABLE_SSE41 inline void castSse41(const Float* const src, Double* const dst) {
+    const __m128 value = _mm_loadu_ps(src);
+    _mm_storeu_pd(dst, _mm_cvtps_pd(value));
+    _mm_storeu_pd(dst + 2, _mm_cvtps_pd(_mm_movehl_ps(value, value)));
+}
+
+CORRADE_ENABLE_SSE41 inline void castSse41(const Double* const src, Float* const dst) {
+    _mm_storeu_ps(dst, _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(src)), _mm_cvtpd_ps(_mm_loadu_pd(src + 2))));
+}
+
+template<class T, class U, typename std::enable_if<IsInt32Like<T>::value && IsInt64<U>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const T* const src, U* const dst) {
+    const __m128i value = widenSse41(src);
+    if(std::is_signed<T>::value) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_cvtepi32_epi64(value));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2), _mm_cvtepi32_epi64(_mm_srli_si128(value, 8)));
+    } else {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_cvtepu32_epi64(value));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2), _mm_cvtepu32_epi64(_mm_srli_si128(value, 8)));
+    }
+}
+
+template<class T, class U, typename std::enable_if<IsInt64<T>::value && IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_SSE41 inline void castSse41(const T* const src, U* const dst) {
+    const __m128 a = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    const __m128 b = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2)));
+    truncateSse41(dst, _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))));
+}
+
+template<class T, class U> CORRADE_ENABLE_SSE41 void castIntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        U* dstI = reinterpret_cast<U*>(dst);
+        std::size_t j = 0;
+        for(; j + 4 <= rowSize; j += 4)
+            castSse41(srcI + j, dstI + j);
+        for(; j != rowSize; ++j)
+            dstI[j] = U(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const UnsignedInt* const data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+
+CORRADE_ENABLE_AVX2 inline __m256i widenAvx2(const Int* const data) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+}
+
+CORRADE_ENABLE_AVX2 inline void truncateAvx2(UnsignedByte* const data, const __m256i value) {
+    const __m256i masked = _mm256_and_si256(value, _mm256_set1_epi32(0xff));
+    const __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(masked), _mm256_extracti128_si256(masked, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(data), _mm_packus_epi16(packed, packed));
+}
+
+CORRADE_ENABLE_AVX2 inline void truncateAvx2(Byte* const data, const __m256i value) {
+    truncateAvx2(reinterpret_cast<UnsignedByte*>(data), value);
+}
+
+CORRADE_ENABLE_AVX2 inline void truncateAvx2(UnsignedShort* const data, const __m256i value) {
+    const __m256i masked = _mm256_and_si256(value, _mm256_set1_epi32(0xffff));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), _mm_packus_epi32(_mm256_castsi256_si128(masked), _mm256_extracti128_si256(masked, 1)));
+}
+
+CORRADE_ENABLE_AVX2 inline void truncateAvx2(Short* const data, const __m256i value) {
+    truncateAvx2(reinterpret_cast<UnsignedShort*>(data), value);
+}
+
+CORRADE_ENABLE_AVX2 inline void truncateAvx2(UnsignedInt* const data, const __m256i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+}
+
+CORRADE_ENABLE_AVX2 inline void truncateAvx2(Int* const data, const __m256i value) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 inline __m256 toFloatAvx2(const __m256i value) {
+    if(std::is_same<T, UnsignedInt>::value)
+        return _mm256_add_ps(
+            _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(value, 16)), _mm256_set1_ps(65536.0f)),
+            _mm256_cvtepi32_ps(_mm256_and_si256(value, _mm256_set1_epi32(0xffff))));
+    return _mm256_cvtepi32_ps(value);
+}
+
+template<class U> CORRADE_ENABLE_AVX2 inline __m256i fromFloatAvx2(const __m256 value) {
+    if(std::is_same<U, UnsignedInt>::value) {
+        const __m256 big = _mm256_cmp_ps(value, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+        const __m256 shifted = _mm256_blendv_ps(value, _mm256_sub_ps(value, _mm256_set1_ps(2147483648.0f)), big);
+        return _mm256_xor_si256(_mm256_cvttps_epi32(shifted), _mm256_and_si256(_mm256_castps_si256(big), _mm256_set1_epi32(Int(0x80000000u))));
+    }
+    return _mm256_cvttps_epi32(value);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 inline __m256d toDoubleAvx2(const __m128i value) {
+    if(std::is_same<T, UnsignedInt>::value)
+        return _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(value, _mm_set1_epi32(Int(0x80000000u)))), _mm256_set1_pd(2147483648.0));
+    return _mm256_cvtepi32_pd(value);
+}
+
+template<class U> CORRADE_ENABLE_AVX2 inline __m128i fromDoubleAvx2(const __m256d value) {
+    if(std::is_same<U, UnsignedInt>::value)
+        return _mm_xor_si128(_mm256_cvttpd_epi32(_mm256_sub_pd(_mm256_round_pd(value, _MM_FROUND_TO_ZERO|_MM_FROUND_NO_EXC), _mm256_set1_pd(2147483648.0))), _mm_set1_epi32(Int(0x80000000u)));
+    return _mm256_cvttpd_epi32(value);
+}
+
+template<class T, class U, typename std::enable_if<IsInt32Like<T>::value && IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const T* const src, U* const dst) {
+    truncateAvx2(dst, widenAvx2(src));
+}
+
+template<class T, typename std::enable_if<IsInt32Like<T>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const T* const src, Float* const dst) {
+    _mm256_storeu_ps(dst, toFloatAvx2<T>(widenAvx2(src)));
+}
+
+template<class U, typename std::enable_if<IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const Float* const src, U* const dst) {
+    truncateAvx2(dst, fromFloatAvx2<U>(_mm256_loadu_ps(src)));
+}
+
+template<class T, typename std::enable_if<IsInt32Like<T>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const T* const src, Double* const dst) {
+    const __m256i value = widenAvx2(src);
+    _mm256_storeu_pd(dst, toDoubleAvx2<T>(_mm256_castsi256_si128(value)));
+    _mm256_storeu_pd(dst + 4, toDoubleAvx2<T>(_mm256_extracti128_si256(value, 1)));
+}
+
+template<class U, typename std::enable_if<IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const Double* const src, U* const dst) {
+    truncateAvx2(dst, _mm256_inserti128_si256(_mm256_castsi128_si256(fromDoubleAvx2<U>(_mm256_loadu_pd(src))), fromDoubleAvx2<U>(_mm256_loadu_pd(src + 4)), 1));
+}
+
+CORRADE_ENABLE_AVX2 inline void castAvx2(const Float* const src, Double* const dst) {
+    _mm256_storeu_pd(dst, _mm256_cvtps_pd(_mm_loadu_ps(src)));
+    _mm256_storeu_pd(dst + 4, _mm256_cvtps_pd(_mm_loadu_ps(src + 4)));
+}
+
+CORRADE_ENABLE_AVX2 inline void castAvx2(const Double* const src, Float* const dst) {
+    _mm_storeu_ps(dst, _mm256_cvtpd_ps(_mm256_loadu_pd(src)));
+    _mm_storeu_ps(dst + 4, _mm256_cvtpd_ps(_mm256_loadu_pd(src + 4)));
+}
+
+template<class T, class U, typename std::enable_if<IsInt32Like<T>::value && IsInt64<U>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const T* const src, U* const dst) {
+    const __m256i value = widenAvx2(src);
+    if(std::is_signed<T>::value) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_cvtepi32_epi64(_mm256_castsi256_si128(value)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(value, 1)));
+    } else {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_cvtepu32_epi64(_mm256_castsi256_si128(value)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 4), _mm256_cvtepu32_epi64(_mm256_extracti128_si256(value, 1)));
+    }
+}
+
+template<class T, class U, typename std::enable_if<IsInt64<T>::value && IsInt32Like<U>::value, int>::type = 0> CORRADE_ENABLE_AVX2 inline void castAvx2(const T* const src, U* const dst) {
+    const __m256i even = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    const __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), even);
+    const __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4)), even);
+    truncateAvx2(dst, _mm256_permute2x128_si256(a, b, 0x20));
+}
+
+template<class T, class U> CORRADE_ENABLE_AVX2 void castIntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const T* srcI = reinterpret_cast<const T*>(src);
+        U* dstI = reinterpret_cast<U*>(dst);
+        std::size_t j = 0;
+        for(; j + 8 <= rowSize; j += 8)
+            castAvx2(srcI + j, dstI + j);
+        for(; j != rowSize; ++j)
+            dstI[j] = U(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedByteFloat)>::type castIntoUnsignedByteFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedByte, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedByteFloat)>::type castIntoUnsignedByteFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedByte, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedByteFloat)>::type castIntoUnsignedByteFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedByte, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedByteFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedByteFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedByteFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoByteFloat)>::type castIntoByteFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Byte, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoByteFloat)>::type castIntoByteFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Byte, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoByteFloat)>::type castIntoByteFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Byte, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoByteFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoByteFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoByteFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedShortFloat)>::type castIntoUnsignedShortFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedShort, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedShortFloat)>::type castIntoUnsignedShortFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedShort, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedShortFloat)>::type castIntoUnsignedShortFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedShort, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedShortFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedShortFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedShortFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoShortFloat)>::type castIntoShortFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Short, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoShortFloat)>::type castIntoShortFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Short, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoShortFloat)>::type castIntoShortFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Short, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoShortFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoShortFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoShortFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedIntFloat)>::type castIntoUnsignedIntFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedInt, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedIntFloat)>::type castIntoUnsignedIntFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedInt, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedIntFloat)>::type castIntoUnsignedIntFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedInt, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedIntFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedIntFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedIntFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoIntFloat)>::type castIntoIntFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Int, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoIntFloat)>::type castIntoIntFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Int, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoIntFloat)>::type castIntoIntFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Int, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoIntFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoIntFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoIntFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedByteDouble)>::type castIntoUnsignedByteDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedByte, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedByteDouble)>::type castIntoUnsignedByteDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedByte, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedByteDouble)>::type castIntoUnsignedByteDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedByte, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedByteDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedByteDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedByteDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoByteDouble)>::type castIntoByteDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Byte, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoByteDouble)>::type castIntoByteDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Byte, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoByteDouble)>::type castIntoByteDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Byte, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoByteDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoByteDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoByteDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedShortDouble)>::type castIntoUnsignedShortDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedShort, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedShortDouble)>::type castIntoUnsignedShortDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedShort, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedShortDouble)>::type castIntoUnsignedShortDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedShort, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedShortDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedShortDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedShortDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoShortDouble)>::type castIntoShortDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Short, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoShortDouble)>::type castIntoShortDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Short, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoShortDouble)>::type castIntoShortDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Short, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoShortDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoShortDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoShortDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedIntDouble)>::type castIntoUnsignedIntDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedInt, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedIntDouble)>::type castIntoUnsignedIntDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedInt, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedIntDouble)>::type castIntoUnsignedIntDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedInt, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedIntDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedIntDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedIntDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoIntDouble)>::type castIntoIntDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Int, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoIntDouble)>::type castIntoIntDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Int, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoIntDouble)>::type castIntoIntDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Int, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoIntDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoIntDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoIntDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatUnsignedByte)>::type castIntoFloatUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, UnsignedByte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatUnsignedByte)>::type castIntoFloatUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, UnsignedByte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatUnsignedByte)>::type castIntoFloatUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, UnsignedByte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatUnsignedByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatUnsignedByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatUnsignedByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatByte)>::type castIntoFloatByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatByte)>::type castIntoFloatByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatByte)>::type castIntoFloatByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatUnsignedShort)>::type castIntoFloatUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, UnsignedShort>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatUnsignedShort)>::type castIntoFloatUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, UnsignedShort>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatUnsignedShort)>::type castIntoFloatUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, UnsignedShort>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatUnsignedShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatUnsignedShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatUnsignedShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatShort)>::type castIntoFloatShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatShort)>::type castIntoFloatShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatShort)>::type castIntoFloatShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatUnsignedInt)>::type castIntoFloatUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatUnsignedInt)>::type castIntoFloatUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatUnsignedInt)>::type castIntoFloatUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatUnsignedIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatInt)>::type castIntoFloatIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatInt)>::type castIntoFloatIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatInt)>::type castIntoFloatIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleUnsignedByte)>::type castIntoDoubleUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, UnsignedByte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleUnsignedByte)>::type castIntoDoubleUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, UnsignedByte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleUnsignedByte)>::type castIntoDoubleUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, UnsignedByte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleUnsignedByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleUnsignedByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleUnsignedByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleByte)>::type castIntoDoubleByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleByte)>::type castIntoDoubleByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleByte)>::type castIntoDoubleByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleUnsignedShort)>::type castIntoDoubleUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, UnsignedShort>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleUnsignedShort)>::type castIntoDoubleUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, UnsignedShort>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleUnsignedShort)>::type castIntoDoubleUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, UnsignedShort>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleUnsignedShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleUnsignedShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleUnsignedShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleShort)>::type castIntoDoubleShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleShort)>::type castIntoDoubleShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleShort)>::type castIntoDoubleShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleUnsignedInt)>::type castIntoDoubleUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleUnsignedInt)>::type castIntoDoubleUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleUnsignedInt)>::type castIntoDoubleUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleUnsignedIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleInt)>::type castIntoDoubleIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleInt)>::type castIntoDoubleIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleInt)>::type castIntoDoubleIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedByteUnsignedShort)>::type castIntoUnsignedByteUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedByte, UnsignedShort>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedByteUnsignedShort)>::type castIntoUnsignedByteUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedByte, UnsignedShort>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedByteUnsignedShort)>::type castIntoUnsignedByteUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedByte, UnsignedShort>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedByteUnsignedShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedByteUnsignedShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedByteUnsignedShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoByteShort)>::type castIntoByteShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Byte, Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoByteShort)>::type castIntoByteShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Byte, Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoByteShort)>::type castIntoByteShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Byte, Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoByteShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoByteShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoByteShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedByteUnsignedInt)>::type castIntoUnsignedByteUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedByte, UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedByteUnsignedInt)>::type castIntoUnsignedByteUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedByte, UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedByteUnsignedInt)>::type castIntoUnsignedByteUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedByte, UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedByteUnsignedIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedByteUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedByteUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoByteInt)>::type castIntoByteIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Byte, Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoByteInt)>::type castIntoByteIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Byte, Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoByteInt)>::type castIntoByteIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Byte, Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoByteIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoByteIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoByteIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedShortUnsignedInt)>::type castIntoUnsignedShortUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedShort, UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedShortUnsignedInt)>::type castIntoUnsignedShortUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedShort, UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedShortUnsignedInt)>::type castIntoUnsignedShortUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedShort, UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedShortUnsignedIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedShortUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedShortUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoShortInt)>::type castIntoShortIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Short, Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoShortInt)>::type castIntoShortIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Short, Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoShortInt)>::type castIntoShortIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Short, Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoShortIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoShortIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoShortIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedByteUnsignedLong)>::type castIntoUnsignedByteUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedByte, UnsignedLong>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedByteUnsignedLong)>::type castIntoUnsignedByteUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedByte, UnsignedLong>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedByteUnsignedLong)>::type castIntoUnsignedByteUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedByte, UnsignedLong>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedByteUnsignedLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedByteUnsignedLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedByteUnsignedLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedByteUnsignedLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoByteLong)>::type castIntoByteLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Byte, Long>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoByteLong)>::type castIntoByteLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Byte, Long>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoByteLong)>::type castIntoByteLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Byte, Long>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoByteLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoByteLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoByteLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoByteLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedShortUnsignedLong)>::type castIntoUnsignedShortUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedShort, UnsignedLong>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedShortUnsignedLong)>::type castIntoUnsignedShortUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedShort, UnsignedLong>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedShortUnsignedLong)>::type castIntoUnsignedShortUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedShort, UnsignedLong>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedShortUnsignedLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedShortUnsignedLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortUnsignedLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedShortUnsignedLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoShortLong)>::type castIntoShortLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Short, Long>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoShortLong)>::type castIntoShortLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Short, Long>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoShortLong)>::type castIntoShortLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Short, Long>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoShortLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoShortLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoShortLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedIntUnsignedLong)>::type castIntoUnsignedIntUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedInt, UnsignedLong>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedIntUnsignedLong)>::type castIntoUnsignedIntUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedInt, UnsignedLong>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedIntUnsignedLong)>::type castIntoUnsignedIntUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedInt, UnsignedLong>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedIntUnsignedLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedIntUnsignedLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntUnsignedLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedIntUnsignedLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoIntLong)>::type castIntoIntLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Int, Long>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoIntLong)>::type castIntoIntLongImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Int, Long>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoIntLong)>::type castIntoIntLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Int, Long>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoIntLongImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoIntLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntLong)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoIntLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedLongUnsignedInt)>::type castIntoUnsignedLongUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedLong, UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedLongUnsignedInt)>::type castIntoUnsignedLongUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedLong, UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedLongUnsignedInt)>::type castIntoUnsignedLongUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedLong, UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedLongUnsignedIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedLongUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedLongUnsignedInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedLongUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoLongInt)>::type castIntoLongIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Long, Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoLongInt)>::type castIntoLongIntImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Long, Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoLongInt)>::type castIntoLongIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Long, Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoLongIntImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoLongIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoLongInt)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoLongIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedLongUnsignedShort)>::type castIntoUnsignedLongUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedLong, UnsignedShort>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedLongUnsignedShort)>::type castIntoUnsignedLongUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedLong, UnsignedShort>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedLongUnsignedShort)>::type castIntoUnsignedLongUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedLong, UnsignedShort>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedLongUnsignedShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedLongUnsignedShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedLongUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedLongUnsignedShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoLongShort)>::type castIntoLongShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Long, Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoLongShort)>::type castIntoLongShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Long, Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoLongShort)>::type castIntoLongShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Long, Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoLongShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoLongShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoLongShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoLongShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedLongUnsignedByte)>::type castIntoUnsignedLongUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedLong, UnsignedByte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedLongUnsignedByte)>::type castIntoUnsignedLongUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedLong, UnsignedByte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedLongUnsignedByte)>::type castIntoUnsignedLongUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedLong, UnsignedByte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedLongUnsignedByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedLongUnsignedByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedLongUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedLongUnsignedByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoLongByte)>::type castIntoLongByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Long, Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoLongByte)>::type castIntoLongByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Long, Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoLongByte)>::type castIntoLongByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Long, Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoLongByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoLongByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoLongByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoLongByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedIntUnsignedShort)>::type castIntoUnsignedIntUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedInt, UnsignedShort>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedIntUnsignedShort)>::type castIntoUnsignedIntUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedInt, UnsignedShort>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedIntUnsignedShort)>::type castIntoUnsignedIntUnsignedShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedInt, UnsignedShort>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedIntUnsignedShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedIntUnsignedShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntUnsignedShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedIntUnsignedShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoIntShort)>::type castIntoIntShortImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Int, Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoIntShort)>::type castIntoIntShortImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Int, Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoIntShort)>::type castIntoIntShortImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Int, Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoIntShortImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoIntShortImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntShort)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoIntShortImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedIntUnsignedByte)>::type castIntoUnsignedIntUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedInt, UnsignedByte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedIntUnsignedByte)>::type castIntoUnsignedIntUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedInt, UnsignedByte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedIntUnsignedByte)>::type castIntoUnsignedIntUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedInt, UnsignedByte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedIntUnsignedByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedIntUnsignedByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedIntUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedIntUnsignedByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoIntByte)>::type castIntoIntByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Int, Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoIntByte)>::type castIntoIntByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Int, Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoIntByte)>::type castIntoIntByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Int, Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoIntByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoIntByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoIntByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoIntByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoUnsignedShortUnsignedByte)>::type castIntoUnsignedShortUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<UnsignedShort, UnsignedByte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoUnsignedShortUnsignedByte)>::type castIntoUnsignedShortUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<UnsignedShort, UnsignedByte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoUnsignedShortUnsignedByte)>::type castIntoUnsignedShortUnsignedByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<UnsignedShort, UnsignedByte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoUnsignedShortUnsignedByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoUnsignedShortUnsignedByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoUnsignedShortUnsignedByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoUnsignedShortUnsignedByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoShortByte)>::type castIntoShortByteImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Short, Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoShortByte)>::type castIntoShortByteImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Short, Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoShortByte)>::type castIntoShortByteImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Short, Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoShortByteImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoShortByteImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoShortByte)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoShortByteImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoFloatDouble)>::type castIntoFloatDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Float, Double>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoFloatDouble)>::type castIntoFloatDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Float, Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoFloatDouble)>::type castIntoFloatDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Float, Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoFloatDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoFloatDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoFloatDouble)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoFloatDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(castIntoDoubleFloat)>::type castIntoDoubleFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return castIntoSse41<Double, Float>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(castIntoDoubleFloat)>::type castIntoDoubleFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return castIntoAvx2<Double, Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(castIntoDoubleFloat)>::type castIntoDoubleFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return castIntoScalar<Double, Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(castIntoDoubleFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(castIntoDoubleFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(castIntoDoubleFloat)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    castIntoDoubleFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+}
+namespace {
+
+template<class T, class U> inline void castIntoImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<U>& dst, const Implementation::BatchFunction function) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::castInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.template isContiguous<1>(),
+        "Math::castInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.template isContiguous<1>(),
+        "Math::castInto(): second destination view dimension is not contiguous", );
+
+    batchInto(function, src, dst);
+}
+
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedByteFloat);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoByteFloat);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedShortFloat);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoShortFloat);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedIntFloat);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoIntFloat);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedByteDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoByteDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedShortDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoShortDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedIntDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoIntDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatUnsignedByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatUnsignedShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatUnsignedInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Int>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleUnsignedByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleUnsignedShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleUnsignedInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Int>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedByteUnsignedShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoByteShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedByteUnsignedInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Int>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoByteInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedShortUnsignedInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Int>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoShortInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedByteUnsignedLong);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Long>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoByteLong);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedShortUnsignedLong);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Long>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoShortLong);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedIntUnsignedLong);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Long>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoIntLong);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedLongUnsignedInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Int>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoLongInt);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedLongUnsignedShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoLongShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedLongUnsignedByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoLongByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedIntUnsignedShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoIntShort);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedIntUnsignedByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoIntByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoUnsignedShortUnsignedByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoShortByte);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoFloatDouble);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    castIntoImplementation(src, dst, Implementation::castIntoDoubleFloat);
+}
+
+namespace {
+
+template<class T> inline void copyImplementation(const Containers::StridedArrayView2D<const T>& src, const Containers::StridedArrayView2D<T>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::castInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.template isContiguous<1>(),
+        "Math::castInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.template isContiguous<1>(),
+        "Math::castInto(): second destination view dimension is not contiguous", );
+
+    if(src.isContiguous() && dst.isContiguous()) {
+        std::memcpy(dst.data(), src.data(), src.size()[0]*src.size()[1]*sizeof(T));
+        return;
+    }
+
+    const char* srcPtr = reinterpret_cast<const char*>(src.data());
     char* dstPtr = reinterpret_cast<char*>(dst.data());
     const std::ptrdiff_t srcStride = src.stride()[0];
     const std::ptrdiff_t dstStride = dst.stride()[0];
-    const std::size_t maxJ = src.size()[1];
+    const std::size_t rowSize = src.size()[1]*sizeof(T);
     for(std::size_t i = 0, maxI = src.size()[0]; i != maxI; ++i) {
-        const UnsignedInt* srcPtrI = reinterpret_cast<const UnsignedInt*>(srcPtr);
-        UnsignedShort* dstPtrI = reinterpret_cast<UnsignedShort*>(dstPtr);
-        for(std::size_t j = 0; j != maxJ; ++j) {
-            const UnsignedInt f = *srcPtrI++;
-            *dstPtrI++ = HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+        std::memcpy(dstPtr, srcPtr, rowSize);
+        srcPtr += srcStride;
+        dstPtr += dstStride;
+    }
+}
+
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Byte>& src, const Containers::StridedArrayView2D<Byte>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Short>& src, const Containers::StridedArrayView2D<Short>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedInt>& src, const Containers::StridedArrayView2D<UnsignedInt>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Int>& src, const Containers::StridedArrayView2D<Int>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const UnsignedLong>& src, const Containers::StridedArrayView2D<UnsignedLong>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Long>& src, const Containers::StridedArrayView2D<Long>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    copyImplementation(src, dst);
+}
+
+void castInto(const Containers::StridedArrayView2D<const Double>& src, const Containers::StridedArrayView2D<Double>& dst) {
+    copyImplementation(src, dst);
+}
+
+static_assert(sizeof(HalfMantissaTable) + sizeof(HalfOffsetTable) + sizeof(HalfExponentTable) == 8576,
+    "improper size of half->float conversion tables");
+
+static_assert(sizeof(HalfBaseTable) + sizeof(HalfShiftTable) == 1536,
+    "improper size of float->half conversion tables");
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackHalfInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packHalfInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize);
+
+namespace {
+
+inline UnsignedInt unpackHalfScalar(const UnsignedShort h) {
+    return HalfMantissaTable[HalfOffsetTable[h >> 10] + (h & 0x3ff)] + HalfExponentTable[h >> 10];
+}
+
+inline UnsignedShort packHalfScalar(const UnsignedInt f) {
+    return HalfBaseTable[(f >> 23) & 0x1ff] + ((f & 0x007fffff) >> HalfShiftTable[(f >> 23) & 0x1ff]);
+}
+
+void unpackHalfIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const UnsignedShort* srcI = reinterpret_cast<const UnsignedShort*>(src);
+        UnsignedInt* dstI = reinterpret_cast<UnsignedInt*>(dst);
+        for(std::size_t j = 0; j != rowSize; ++j)
+            dstI[j] = unpackHalfScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+void packHalfIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const UnsignedInt* srcI = reinterpret_cast<const UnsignedInt*>(src);
+        UnsignedShort* dstI = reinterpret_cast<UnsignedShort*>(dst);
+        for(std::size_t j = 0; j != rowSize; ++j)
+            dstI[j] = packHalfScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_F16C)
+CORRADE_ENABLE(AVX,AVX_F16C) void unpackHalfIntoF16c(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m128i absMask = _mm_set1_epi16(0x7fff);
+    const __m128i infinity = _mm_set1_epi16(0x7c00);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const UnsignedShort* srcI = reinterpret_cast<const UnsignedShort*>(src);
+        UnsignedInt* dstI = reinterpret_cast<UnsignedInt*>(dst);
+        std::size_t j = 0;
+        for(; j + 8 <= rowSize; j += 8) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(srcI + j));
+            _mm256_storeu_ps(reinterpret_cast<Float*>(dstI + j), _mm256_cvtph_ps(in));
+            if(const Int nans = _mm_movemask_epi8(_mm_cmpgt_epi16(_mm_and_si128(in, absMask), infinity))) {
+                for(std::size_t k = 0; k != 8; ++k)
+                    if(nans & (1 << 2*k)) dstI[j + k] = unpackHalfScalar(srcI[j + k]);
+            }
+        }
+        for(; j != rowSize; ++j)
+            dstI[j] = unpackHalfScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE(AVX,AVX_F16C) void packHalfIntoF16c(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 overflow = _mm256_set1_ps(65536.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const UnsignedInt* srcI = reinterpret_cast<const UnsignedInt*>(src);
+        UnsignedShort* dstI = reinterpret_cast<UnsignedShort*>(dst);
+        std::size_t j = 0;
+        for(; j + 8 <= rowSize; j += 8) {
+            const __m256 in = _mm256_loadu_ps(reinterpret_cast<const Float*>(srcI + j));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dstI + j), _mm256_cvtps_ph(in, _MM_FROUND_TO_ZERO));
+            if(const Int overflows = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signMask, in), overflow, _CMP_NLT_UQ))) {
+                for(std::size_t k = 0; k != 8; ++k)
+                    if(overflows & (1 << k)) dstI[j + k] = packHalfScalar(srcI[j + k]);
+            }
+        }
+        for(; j != rowSize; ++j)
+            dstI[j] = packHalfScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+CORRADE_ENABLE_AVX512F void unpackHalfIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m256i absMask = _mm256_set1_epi16(0x7fff);
+    const __m256i infinity = _mm256_set1_epi16(0x7c00);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const UnsignedShort* srcI = reinterpret_cast<const UnsignedShort*>(src);
+        UnsignedInt* dstI = reinterpret_cast<UnsignedInt*>(dst);
+        std::size_t j = 0;
+        for(; j + 16 <= rowSize; j += 16) {
+            const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(srcI + j));
+            _mm512_storeu_ps(dstI + j, _mm512_cvtph_ps(in));
+            if(const Int nans = _mm256_movemask_epi8(_mm256_cmpgt_epi16(_mm256_and_si256(in, absMask), infinity))) {
+                for(std::size_t k = 0; k != 16; ++k)
+                    if(nans & (1 << 2*k)) dstI[j + k] = unpackHalfScalar(srcI[j + k]);
+            }
+        }
+        for(; j != rowSize; ++j)
+            dstI[j] = unpackHalfScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+CORRADE_ENABLE_AVX512F void packHalfIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize) {
+    const __m512i absMask = _mm512_set1_epi32(0x7fffffff);
+    const __m512 overflow = _mm512_set1_ps(65536.0f);
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const UnsignedInt* srcI = reinterpret_cast<const UnsignedInt*>(src);
+        UnsignedShort* dstI = reinterpret_cast<UnsignedShort*>(dst);
+        std::size_t j = 0;
+        for(; j + 16 <= rowSize; j += 16) {
+            const __m512i in = _mm512_loadu_si512(srcI + j);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dstI + j), _mm512_cvtps_ph(_mm512_castsi512_ps(in), _MM_FROUND_TO_ZERO));
+            if(const UnsignedInt overflows = _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_and_si512(in, absMask)), overflow, _CMP_NLT_UQ)) {
+                for(std::size_t k = 0; k != 16; ++k)
+                    if(overflows & (1 << k)) dstI[j + k] = packHalfScalar(srcI[j + k]);
+            }
+        }
+        for(; j != rowSize; ++j)
+            dstI[j] = packHalfScalar(srcI[j]);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_F16C)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_F16C) typename std::decay<decltype(unpackHalfInto)>::type unpackHalfIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxF16c)) {
+    return unpackHalfIntoF16c;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackHalfInto)>::type unpackHalfIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackHalfIntoAvx512;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackHalfInto)>::type unpackHalfIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackHalfIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(unpackHalfIntoImplementation, Cpu::AvxF16c)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(unpackHalfIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(unpackHalfIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackHalfInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    unpackHalfIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_F16C)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_F16C) typename std::decay<decltype(packHalfInto)>::type packHalfIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxF16c)) {
+    return packHalfIntoF16c;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packHalfInto)>::type packHalfIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packHalfIntoAvx512;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packHalfInto)>::type packHalfIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packHalfIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(packHalfIntoImplementation, Cpu::AvxF16c)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(packHalfIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(packHalfIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packHalfInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize))({
+    packHalfIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize);
+})
+
+}
+
+void unpackHalfInto(const Containers::StridedArrayView2D<const UnsignedShort>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::unpackHalfInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::unpackHalfInto(): second destination view dimension is not contiguous", );
+
+    batchInto(Implementation::unpackHalfInto, src, dst);
+}
+
+void packHalfInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedShort>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packHalfInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::packHalfInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::packHalfInto(): second destination view dimension is not contiguous", );
+
+    batchInto(Implementation::packHalfInto, src, dst);
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformPoints2Into)(const Matrix3<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformVectors2Into)(const Matrix3<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformPoints3Into)(const Matrix4<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformVectors3Into)(const Matrix4<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+
+namespace {
+
+template<bool points> void transform2IntoScalar(const Matrix3<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector2<Float>& in = *reinterpret_cast<const Vector2<Float>*>(src + std::ptrdiff_t(i)*srcStride);
+        *reinterpret_cast<Vector2<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = points ? matrix.transformPoint(in) : matrix.transformVector(in);
+    }
+}
+
+template<bool points> void transform3IntoScalar(const Matrix4<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& in = *reinterpret_cast<const Vector3<Float>*>(src + std::ptrdiff_t(i)*srcStride);
+        *reinterpret_cast<Vector3<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = points ? matrix.transformPoint(in) : matrix.transformVector(in);
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+struct SoaSse2 {
+    typedef __m128 Type;
+    typedef __m128 Mask;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_SSE2 static Type splat(const Float value) {
+        return _mm_set1_ps(value);
+    }
+    CORRADE_ENABLE_SSE2 static Type load(const Float* const data, CORRADE_UNUSED const std::size_t step) {
+        return _mm_loadu_ps(data);
+    }
+    CORRADE_ENABLE_SSE2 static Type gather(const Float* const* const data, const std::size_t offset) {
+        return _mm_loadu_ps(data[0] + offset);
+    }
+    CORRADE_ENABLE_SSE2 static void store(Float* const data, CORRADE_UNUSED const std::size_t step, const Type value) {
+        _mm_storeu_ps(data, value);
+    }
+    CORRADE_ENABLE_SSE2 static Type add(const Type a, const Type b) {
+        return _mm_add_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type mul(const Type a, const Type b) {
+        return _mm_mul_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type div(const Type a, const Type b) {
+        return _mm_div_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type madd(const Type a, const Type b, const Type c) {
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    }
+    template<int mask> CORRADE_ENABLE_SSE2 static Type shuffle(const Type a, const Type b) {
+        return _mm_shuffle_ps(a, b, mask);
+    }
+    CORRADE_ENABLE_SSE2 static Type unpackLo(const Type a, const Type b) {
+        return _mm_unpacklo_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type unpackHi(const Type a, const Type b) {
+        return _mm_unpackhi_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type sub(const Type a, const Type b) {
+        return _mm_sub_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type min(const Type a, const Type b) {
+        return _mm_min_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type max(const Type a, const Type b) {
+        return _mm_max_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type sqrt(const Type a) {
+        return _mm_sqrt_ps(a);
+    }
+    CORRADE_ENABLE_SSE2 static Type abs(const Type a) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+    CORRADE_ENABLE_SSE2 static Mask lessThan(const Type a, const Type b) {
+        return _mm_cmplt_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Mask greaterThan(const Type a, const Type b) {
+        return _mm_cmpgt_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Mask greaterEqual(const Type a, const Type b) {
+        return _mm_cmpge_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Mask notEqual(const Type a, const Type b) {
+        return _mm_cmpneq_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE2 static Type select(const Mask mask, const Type a, const Type b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+    CORRADE_ENABLE_SSE2 static Type negateIf(const Mask mask, const Type a) {
+        return _mm_xor_ps(a, _mm_and_ps(mask, _mm_set1_ps(-0.0f)));
+    }
+    CORRADE_ENABLE_SSE2 static bool any(const Mask mask) {
+        return _mm_movemask_ps(mask) != 0;
+    }
+    CORRADE_ENABLE_SSE2 static UnsignedInt bitMask(const Mask mask) {
+        return _mm_movemask_ps(mask);
+    }
+};
+
+template<bool points> CORRADE_ENABLE_SSE2 void transform2IntoSse2(const Matrix3<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const bool srcContiguous = srcStride == std::ptrdiff_t(sizeof(Vector2<Float>));
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector2<Float>));
+    const typename Vector::Type m00 = Vector::splat(matrix[0][0]);
+    const typename Vector::Type m01 = Vector::splat(matrix[0][1]);
+    const typename Vector::Type m10 = Vector::splat(matrix[1][0]);
+    const typename Vector::Type m11 = Vector::splat(matrix[1][1]);
+    const typename Vector::Type m20 = Vector::splat(matrix[2][0]);
+    const typename Vector::Type m21 = Vector::splat(matrix[2][1]);
+    Float block[lanes*2];
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* in = reinterpret_cast<const Float*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!srcContiguous) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*2, src + std::ptrdiff_t(i + k)*srcStride, sizeof(Vector2<Float>));
+            in = block;
+        }
+
+        const typename Vector::Type a = Vector::load(in, 8);
+        const typename Vector::Type b = Vector::load(in + 4, 8);
+        const typename Vector::Type x = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(a, b);
+        const typename Vector::Type y = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(a, b);
+
+        typename Vector::Type outX = Vector::madd(m10, y, Vector::mul(m00, x));
+        typename Vector::Type outY = Vector::madd(m11, y, Vector::mul(m01, x));
+        if(points) {
+            outX = Vector::add(outX, m20);
+            outY = Vector::add(outY, m21);
+        }
+
+        Float* out = dstContiguous ? reinterpret_cast<Float*>(dst + std::ptrdiff_t(i)*dstStride) : block;
+        Vector::store(out, 8, Vector::unpackLo(outX, outY));
+        Vector::store(out + 4, 8, Vector::unpackHi(outX, outY));
+        if(!dstContiguous) for(std::size_t k = 0; k != lanes; ++k)
+            std::memcpy(dst + std::ptrdiff_t(i + k)*dstStride, block + k*2, sizeof(Vector2<Float>));
+    }
+
+    transform2IntoScalar<points>(matrix, src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<bool points> CORRADE_ENABLE_SSE2 void transform3IntoSse2(const Matrix4<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const bool srcContiguous = srcStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    const bool projective = points && (matrix[0][3] != 0.0f || matrix[1][3] != 0.0f || matrix[2][3] != 0.0f || matrix[3][3] != 1.0f);
+    const typename Vector::Type m00 = Vector::splat(matrix[0][0]);
+    const typename Vector::Type m01 = Vector::splat(matrix[0][1]);
+    const typename Vector::Type m02 = Vector::splat(matrix[0][2]);
+    const typename Vector::Type m03 = Vector::splat(matrix[0][3]);
+    const typename Vector::Type m10 = Vector::splat(matrix[1][0]);
+    const typename Vector::Type m11 = Vector::splat(matrix[1][1]);
+    const typename Vector::Type m12 = Vector::splat(matrix[1][2]);
+    const typename Vector::Type m13 = Vector::splat(matrix[1][3]);
+    const typename Vector::Type m20 = Vector::splat(matrix[2][0]);
+    const typename Vector::Type m21 = Vector::splat(matrix[2][1]);
+    const typename Vector::Type m22 = Vector::splat(matrix[2][2]);
+    const typename Vector::Type m23 = Vector::splat(matrix[2][3]);
+    const typename Vector::Type m30 = Vector::splat(matrix[3][0]);
+    const typename Vector::Type m31 = Vector::splat(matrix[3][1]);
+    const typename Vector::Type m32 = Vector::splat(matrix[3][2]);
+    const typename Vector::Type m33 = Vector::splat(matrix[3][3]);
+    Float block[lanes*3];
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* in = reinterpret_cast<const Float*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!srcContiguous) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*3, src + std::ptrdiff_t(i + k)*srcStride, sizeof(Vector3<Float>));
+            in = block;
+        }
+
+        const typename Vector::Type a = Vector::load(in, 12);
+        const typename Vector::Type b = Vector::load(in + 4, 12);
+        const typename Vector::Type c = Vector::load(in + 8, 12);
+        const typename Vector::Type x = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b, c));
+        const typename Vector::Type y = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a, b), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b, c));
+        const typename Vector::Type z = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a, b), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(c, c));
+
+        typename Vector::Type outX = Vector::madd(m20, z, Vector::madd(m10, y, Vector::mul(m00, x)));
+        typename Vector::Type outY = Vector::madd(m21, z, Vector::madd(m11, y, Vector::mul(m01, x)));
+        typename Vector::Type outZ = Vector::madd(m22, z, Vector::madd(m12, y, Vector::mul(m02, x)));
+        if(points) {
+            outX = Vector::add(outX, m30);
+            outY = Vector::add(outY, m31);
+            outZ = Vector::add(outZ, m32);
+        }
+        if(projective) {
+            const typename Vector::Type w = Vector::add(Vector::madd(m23, z, Vector::madd(m13, y, Vector::mul(m03, x))), m33);
+            outX = Vector::div(outX, w);
+            outY = Vector::div(outY, w);
+            outZ = Vector::div(outZ, w);
+        }
+
+        const typename Vector::Type xy01 = Vector::unpackLo(outX, outY);
+        const typename Vector::Type xy23 = Vector::unpackHi(outX, outY);
+        Float* out = dstContiguous ? reinterpret_cast<Float*>(dst + std::ptrdiff_t(i)*dstStride) : block;
+        Vector::store(out, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(xy01, Vector::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(outZ, outX)));
+        Vector::store(out + 4, 12, Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(outY, outZ), xy23));
+        Vector::store(out + 8, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(outZ, outX), Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(outY, outZ)));
+        if(!dstContiguous) for(std::size_t k = 0; k != lanes; ++k)
+            std::memcpy(dst + std::ptrdiff_t(i + k)*dstStride, block + k*3, sizeof(Vector3<Float>));
+    }
+
+    transform3IntoScalar<points>(matrix, src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+struct SoaAvxFma {
+    typedef __m256 Type;
+    typedef __m256 Mask;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type splat(const Float value) {
+        return _mm256_set1_ps(value);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type load(const Float* const data, const std::size_t step) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data)), _mm_loadu_ps(data + step), 1);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type gather(const Float* const* const data, const std::size_t offset) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data[0] + offset)), _mm_loadu_ps(data[1] + offset), 1);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static void store(Float* const data, const std::size_t step, const Type value) {
+        _mm_storeu_ps(data, _mm256_castps256_ps128(value));
+        _mm_storeu_ps(data + step, _mm256_extractf128_ps(value, 1));
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type add(const Type a, const Type b) {
+        return _mm256_add_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type mul(const Type a, const Type b) {
+        return _mm256_mul_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type div(const Type a, const Type b) {
+        return _mm256_div_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type madd(const Type a, const Type b, const Type c) {
+        return _mm256_fmadd_ps(a, b, c);
+    }
+    template<int mask> CORRADE_ENABLE(AVX,AVX_FMA) static Type shuffle(const Type a, const Type b) {
+        return _mm256_shuffle_ps(a, b, mask);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type unpackLo(const Type a, const Type b) {
+        return _mm256_unpacklo_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type unpackHi(const Type a, const Type b) {
+        return _mm256_unpackhi_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type sub(const Type a, const Type b) {
+        return _mm256_sub_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type min(const Type a, const Type b) {
+        return _mm256_min_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type max(const Type a, const Type b) {
+        return _mm256_max_ps(a, b);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type sqrt(const Type a) {
+        return _mm256_sqrt_ps(a);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type abs(const Type a) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Mask lessThan(const Type a, const Type b) {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Mask greaterThan(const Type a, const Type b) {
+        return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Mask greaterEqual(const Type a, const Type b) {
+        return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Mask notEqual(const Type a, const Type b) {
+        return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type select(const Mask mask, const Type a, const Type b) {
+        return _mm256_blendv_ps(b, a, mask);
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static Type negateIf(const Mask mask, const Type a) {
+        return _mm256_xor_ps(a, _mm256_and_ps(mask, _mm256_set1_ps(-0.0f)));
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static bool any(const Mask mask) {
+        return _mm256_movemask_ps(mask) != 0;
+    }
+    CORRADE_ENABLE(AVX,AVX_FMA) static UnsignedInt bitMask(const Mask mask) {
+        return _mm256_movemask_ps(mask);
+    }
+};
+
+template<bool points> CORRADE_ENABLE(AVX,AVX_FMA) void transform2IntoAvxFma(const Matrix3<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const bool srcContiguous = srcStride == std::ptrdiff_t(sizeof(Vector2<Float>));
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector2<Float>));
+    const typename Vector::Type m00 = Vector::splat(matrix[0][0]);
+    const typename Vector::Type m01 = Vector::splat(matrix[0][1]);
+    const typename Vector::Type m10 = Vector::splat(matrix[1][0]);
+    const typename Vector::Type m11 = Vector::splat(matrix[1][1]);
+    const typename Vector::Type m20 = Vector::splat(matrix[2][0]);
+    const typename Vector::Type m21 = Vector::splat(matrix[2][1]);
+    Float block[lanes*2];
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* in = reinterpret_cast<const Float*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!srcContiguous) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*2, src + std::ptrdiff_t(i + k)*srcStride, sizeof(Vector2<Float>));
+            in = block;
+        }
+
+        const typename Vector::Type a = Vector::load(in, 8);
+        const typename Vector::Type b = Vector::load(in + 4, 8);
+        const typename Vector::Type x = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(a, b);
+        const typename Vector::Type y = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(a, b);
+
+        typename Vector::Type outX = Vector::madd(m10, y, Vector::mul(m00, x));
+        typename Vector::Type outY = Vector::madd(m11, y, Vector::mul(m01, x));
+        if(points) {
+            outX = Vector::add(outX, m20);
+            outY = Vector::add(outY, m21);
+        }
+
+        Float* out = dstContiguous ? reinterpret_cast<Float*>(dst + std::ptrdiff_t(i)*dstStride) : block;
+        Vector::store(out, 8, Vector::unpackLo(outX, outY));
+        Vector::store(out + 4, 8, Vector::unpackHi(outX, outY));
+        if(!dstContiguous) for(std::size_t k = 0; k != lanes; ++k)
+            std::memcpy(dst + std::ptrdiff_t(i + k)*dstStride, block + k*2, sizeof(Vector2<Float>));
+    }
+
+    transform2IntoScalar<points>(matrix, src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<bool points> CORRADE_ENABLE(AVX,AVX_FMA) void transform3IntoAvxFma(const Matrix4<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const bool srcContiguous = srcStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    const bool projective = points && (matrix[0][3] != 0.0f || matrix[1][3] != 0.0f || matrix[2][3] != 0.0f || matrix[3][3] != 1.0f);
+    const typename Vector::Type m00 = Vector::splat(matrix[0][0]);
+    const typename Vector::Type m01 = Vector::splat(matrix[0][1]);
+    const typename Vector::Type m02 = Vector::splat(matrix[0][2]);
+    const typename Vector::Type m03 = Vector::splat(matrix[0][3]);
+    const typename Vector::Type m10 = Vector::splat(matrix[1][0]);
+    const typename Vector::Type m11 = Vector::splat(matrix[1][1]);
+    const typename Vector::Type m12 = Vector::splat(matrix[1][2]);
+    const typename Vector::Type m13 = Vector::splat(matrix[1][3]);
+    const typename Vector::Type m20 = Vector::splat(matrix[2][0]);
+    const typename Vector::Type m21 = Vector::splat(matrix[2][1]);
+    const typename Vector::Type m22 = Vector::splat(matrix[2][2]);
+    const typename Vector::Type m23 = Vector::splat(matrix[2][3]);
+    const typename Vector::Type m30 = Vector::splat(matrix[3][0]);
+    const typename Vector::Type m31 = Vector::splat(matrix[3][1]);
+    const typename Vector::Type m32 = Vector::splat(matrix[3][2]);
+    const typename Vector::Type m33 = Vector::splat(matrix[3][3]);
+    Float block[lanes*3];
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* in = reinterpret_cast<const Float*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!srcContiguous) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*3, src + std::ptrdiff_t(i + k)*srcStride, sizeof(Vector3<Float>));
+            in = block;
+        }
+
+        const typename Vector::Type a = Vector::load(in, 12);
+        const typename Vector::Type b = Vector::load(in + 4, 12);
+        const typename Vector::Type c = Vector::load(in + 8, 12);
+        const typename Vector::Type x = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b, c));
+        const typename Vector::Type y = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a, b), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b, c));
+        const typename Vector::Type z = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a, b), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(c, c));
+
+        typename Vector::Type outX = Vector::madd(m20, z, Vector::madd(m10, y, Vector::mul(m00, x)));
+        typename Vector::Type outY = Vector::madd(m21, z, Vector::madd(m11, y, Vector::mul(m01, x)));
+        typename Vector::Type outZ = Vector::madd(m22, z, Vector::madd(m12, y, Vector::mul(m02, x)));
+        if(points) {
+            outX = Vector::add(outX, m30);
+            outY = Vector::add(outY, m31);
+            outZ = Vector::add(outZ, m32);
+        }
+        if(projective) {
+            const typename Vector::Type w = Vector::add(Vector::madd(m23, z, Vector::madd(m13, y, Vector::mul(m03, x))), m33);
+            outX = Vector::div(outX, w);
+            outY = Vector::div(outY, w);
+            outZ = Vector::div(outZ, w);
+        }
+
+        const typename Vector::Type xy01 = Vector::unpackLo(outX, outY);
+        const typename Vector::Type xy23 = Vector::unpackHi(outX, outY);
+        Float* out = dstContiguous ? reinterpret_cast<Float*>(dst + std::ptrdiff_t(i)*dstStride) : block;
+        Vector::store(out, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(xy01, Vector::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(outZ, outX)));
+        Vector::store(out + 4, 12, Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(outY, outZ), xy23));
+        Vector::store(out + 8, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(outZ, outX), Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(outY, outZ)));
+        if(!dstContiguous) for(std::size_t k = 0; k != lanes; ++k)
+            std::memcpy(dst + std::ptrdiff_t(i + k)*dstStride, block + k*3, sizeof(Vector3<Float>));
+    }
+
+    transform3IntoScalar<points>(matrix, src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+struct SoaAvx512 {
+    typedef __m512 Type;
+    typedef __mmask16 Mask;
+    enum: std::size_t { Lanes = 16 };
+
+    CORRADE_ENABLE_AVX512F static Type splat(const Float value) {
+        return _mm512_set1_ps(value);
+    }
+    CORRADE_ENABLE_AVX512F static Type load(const Float* const data, const std::size_t step) {
+        return _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4(_mm512_castps128_ps512(_mm_loadu_ps(data)), _mm_loadu_ps(data + step), 1), _mm_loadu_ps(data + 2*step), 2), _mm_loadu_ps(data + 3*step), 3);
+    }
+    CORRADE_ENABLE_AVX512F static Type gather(const Float* const* const data, const std::size_t offset) {
+        return _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4(_mm512_castps128_ps512(_mm_loadu_ps(data[0] + offset)), _mm_loadu_ps(data[1] + offset), 1), _mm_loadu_ps(data[2] + offset), 2), _mm_loadu_ps(data[3] + offset), 3);
+    }
+    CORRADE_ENABLE_AVX512F static void store(Float* const data, const std::size_t step, const Type value) {
+        _mm_storeu_ps(data, _mm512_castps512_ps128(value));
+        _mm_storeu_ps(data + step, _mm512_extractf32x4_ps(value, 1));
+        _mm_storeu_ps(data + 2*step, _mm512_extractf32x4_ps(value, 2));
+        _mm_storeu_ps(data + 3*step, _mm512_extractf32x4_ps(value, 3));
+    }
+    CORRADE_ENABLE_AVX512F static Type add(const Type a, const Type b) {
+        return _mm512_add_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type mul(const Type a, const Type b) {
+        return _mm512_mul_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type div(const Type a, const Type b) {
+        return _mm512_div_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type madd(const Type a, const Type b, const Type c) {
+        return _mm512_fmadd_ps(a, b, c);
+    }
+    template<int mask> CORRADE_ENABLE_AVX512F static Type shuffle(const Type a, const Type b) {
+        return _mm512_shuffle_ps(a, b, mask);
+    }
+    CORRADE_ENABLE_AVX512F static Type unpackLo(const Type a, const Type b) {
+        return _mm512_unpacklo_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type unpackHi(const Type a, const Type b) {
+        return _mm512_unpackhi_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type sub(const Type a, const Type b) {
+        return _mm512_sub_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) {
+        return _mm512_min_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) {
+        return _mm512_max_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type sqrt(const Type a) {
+        return _mm512_sqrt_ps(a);
+    }
+    CORRADE_ENABLE_AVX512F static Type abs(const Type a) {
+        return _mm512_castsi512_ps(_mm512_andnot_epi32(_mm512_castps_si512(_mm512_set1_ps(-0.0f)), _mm512_castps_si512(a)));
+    }
+    CORRADE_ENABLE_AVX512F static Mask lessThan(const Type a, const Type b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+    }
+    CORRADE_ENABLE_AVX512F static Mask greaterThan(const Type a, const Type b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+    }
+    CORRADE_ENABLE_AVX512F static Mask greaterEqual(const Type a, const Type b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ);
+    }
+    CORRADE_ENABLE_AVX512F static Mask notEqual(const Type a, const Type b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ);
+    }
+    CORRADE_ENABLE_AVX512F static Type select(const Mask mask, const Type a, const Type b) {
+        return _mm512_mask_blend_ps(mask, b, a);
+    }
+    CORRADE_ENABLE_AVX512F static Type negateIf(const Mask mask, const Type a) {
+        return _mm512_castsi512_ps(_mm512_mask_xor_epi32(_mm512_castps_si512(a), mask, _mm512_castps_si512(a), _mm512_castps_si512(_mm512_set1_ps(-0.0f))));
+    }
+    CORRADE_ENABLE_AVX512F static bool any(const Mask mask) {
+        return mask != 0;
+    }
+    CORRADE_ENABLE_AVX512F static UnsignedInt bitMask(const Mask mask) {
+        return mask;
+    }
+};
+
+template<bool points> CORRADE_ENABLE_AVX512F void transform2IntoAvx512(const Matrix3<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const bool srcContiguous = srcStride == std::ptrdiff_t(sizeof(Vector2<Float>));
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector2<Float>));
+    const typename Vector::Type m00 = Vector::splat(matrix[0][0]);
+    const typename Vector::Type m01 = Vector::splat(matrix[0][1]);
+    const typename Vector::Type m10 = Vector::splat(matrix[1][0]);
+    const typename Vector::Type m11 = Vector::splat(matrix[1][1]);
+    const typename Vector::Type m20 = Vector::splat(matrix[2][0]);
+    const typename Vector::Type m21 = Vector::splat(matrix[2][1]);
+    Float block[lanes*2];
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* in = reinterpret_cast<const Float*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!srcContiguous) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*2, src + std::ptrdiff_t(i + k)*srcStride, sizeof(Vector2<Float>));
+            in = block;
+        }
+
+        const typename Vector::Type a = Vector::load(in, 8);
+        const typename Vector::Type b = Vector::load(in + 4, 8);
+        const typename Vector::Type x = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(a, b);
+        const typename Vector::Type y = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(a, b);
+
+        typename Vector::Type outX = Vector::madd(m10, y, Vector::mul(m00, x));
+        typename Vector::Type outY = Vector::madd(m11, y, Vector::mul(m01, x));
+        if(points) {
+            outX = Vector::add(outX, m20);
+            outY = Vector::add(outY, m21);
+        }
+
+        Float* out = dstContiguous ? reinterpret_cast<Float*>(dst + std::ptrdiff_t(i)*dstStride) : block;
+        Vector::store(out, 8, Vector::unpackLo(outX, outY));
+        Vector::store(out + 4, 8, Vector::unpackHi(outX, outY));
+        if(!dstContiguous) for(std::size_t k = 0; k != lanes; ++k)
+            std::memcpy(dst + std::ptrdiff_t(i + k)*dstStride, block + k*2, sizeof(Vector2<Float>));
+    }
+
+    transform2IntoScalar<points>(matrix, src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<bool points> CORRADE_ENABLE_AVX512F void transform3IntoAvx512(const Matrix4<Float>& matrix, const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const bool srcContiguous = srcStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    const bool projective = points && (matrix[0][3] != 0.0f || matrix[1][3] != 0.0f || matrix[2][3] != 0.0f || matrix[3][3] != 1.0f);
+    const typename Vector::Type m00 = Vector::splat(matrix[0][0]);
+    const typename Vector::Type m01 = Vector::splat(matrix[0][1]);
+    const typename Vector::Type m02 = Vector::splat(matrix[0][2]);
+    const typename Vector::Type m03 = Vector::splat(matrix[0][3]);
+    const typename Vector::Type m10 = Vector::splat(matrix[1][0]);
+    const typename Vector::Type m11 = Vector::splat(matrix[1][1]);
+    const typename Vector::Type m12 = Vector::splat(matrix[1][2]);
+    const typename Vector::Type m13 = Vector::splat(matrix[1][3]);
+    const typename Vector::Type m20 = Vector::splat(matrix[2][0]);
+    const typename Vector::Type m21 = Vector::splat(matrix[2][1]);
+    const typename Vector::Type m22 = Vector::splat(matrix[2][2]);
+    const typename Vector::Type m23 = Vector::splat(matrix[2][3]);
+    const typename Vector::Type m30 = Vector::splat(matrix[3][0]);
+    const typename Vector::Type m31 = Vector::splat(matrix[3][1]);
+    const typename Vector::Type m32 = Vector::splat(matrix[3][2]);
+    const typename Vector::Type m33 = Vector::splat(matrix[3][3]);
+    Float block[lanes*3];
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* in = reinterpret_cast<const Float*>(src + std::ptrdiff_t(i)*srcStride);
+        if(!srcContiguous) {
+            for(std::size_t k = 0; k != lanes; ++k)
+                std::memcpy(block + k*3, src + std::ptrdiff_t(i + k)*srcStride, sizeof(Vector3<Float>));
+            in = block;
+        }
+
+        const typename Vector::Type a = Vector::load(in, 12);
+        const typename Vector::Type b = Vector::load(in + 4, 12);
+        const typename Vector::Type c = Vector::load(in + 8, 12);
+        const typename Vector::Type x = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b, c));
+        const typename Vector::Type y = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a, b), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b, c));
+        const typename Vector::Type z = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a, b), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(c, c));
+
+        typename Vector::Type outX = Vector::madd(m20, z, Vector::madd(m10, y, Vector::mul(m00, x)));
+        typename Vector::Type outY = Vector::madd(m21, z, Vector::madd(m11, y, Vector::mul(m01, x)));
+        typename Vector::Type outZ = Vector::madd(m22, z, Vector::madd(m12, y, Vector::mul(m02, x)));
+        if(points) {
+            outX = Vector::add(outX, m30);
+            outY = Vector::add(outY, m31);
+            outZ = Vector::add(outZ, m32);
+        }
+        if(projective) {
+            const typename Vector::Type w = Vector::add(Vector::madd(m23, z, Vector::madd(m13, y, Vector::mul(m03, x))), m33);
+            outX = Vector::div(outX, w);
+            outY = Vector::div(outY, w);
+            outZ = Vector::div(outZ, w);
+        }
+
+        const typename Vector::Type xy01 = Vector::unpackLo(outX, outY);
+        const typename Vector::Type xy23 = Vector::unpackHi(outX, outY);
+        Float* out = dstContiguous ? reinterpret_cast<Float*>(dst + std::ptrdiff_t(i)*dstStride) : block;
+        Vector::store(out, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(xy01, Vector::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(outZ, outX)));
+        Vector::store(out + 4, 12, Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(outY, outZ), xy23));
+        Vector::store(out + 8, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(outZ, outX), Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(outY, outZ)));
+        if(!dstContiguous) for(std::size_t k = 0; k != lanes; ++k)
+            std::memcpy(dst + std::ptrdiff_t(i + k)*dstStride, block + k*3, sizeof(Vector3<Float>));
+    }
+
+    transform3IntoScalar<points>(matrix, src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(transformPoints2Into)>::type transformPoints2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return transform2IntoSse2<true>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(transformPoints2Into)>::type transformPoints2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return transform2IntoAvxFma<true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(transformPoints2Into)>::type transformPoints2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return transform2IntoAvx512<true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(transformPoints2Into)>::type transformPoints2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return transform2IntoScalar<true>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(transformPoints2IntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(transformPoints2IntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(transformPoints2IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformPoints2Into)(const Matrix3<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    transformPoints2IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(matrix, src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(transformVectors2Into)>::type transformVectors2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return transform2IntoSse2<false>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(transformVectors2Into)>::type transformVectors2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return transform2IntoAvxFma<false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(transformVectors2Into)>::type transformVectors2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return transform2IntoAvx512<false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(transformVectors2Into)>::type transformVectors2IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return transform2IntoScalar<false>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(transformVectors2IntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(transformVectors2IntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(transformVectors2IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformVectors2Into)(const Matrix3<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    transformVectors2IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(matrix, src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(transformPoints3Into)>::type transformPoints3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return transform3IntoSse2<true>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(transformPoints3Into)>::type transformPoints3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return transform3IntoAvxFma<true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(transformPoints3Into)>::type transformPoints3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return transform3IntoAvx512<true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(transformPoints3Into)>::type transformPoints3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return transform3IntoScalar<true>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(transformPoints3IntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(transformPoints3IntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(transformPoints3IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformPoints3Into)(const Matrix4<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    transformPoints3IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(matrix, src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(transformVectors3Into)>::type transformVectors3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return transform3IntoSse2<false>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(transformVectors3Into)>::type transformVectors3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return transform3IntoAvxFma<false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(transformVectors3Into)>::type transformVectors3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return transform3IntoAvx512<false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(transformVectors3Into)>::type transformVectors3IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return transform3IntoScalar<false>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(transformVectors3IntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(transformVectors3IntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(transformVectors3IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(transformVectors3Into)(const Matrix4<Float>& matrix, const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    transformVectors3IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(matrix, src, srcStride, dst, dstStride, size);
+})
+
+}
+
+namespace {
+
+template<class T, class U> void transformInto(void(*const function)(const T&, const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t), const T& matrix, const Containers::StridedArrayView1D<const U>& src, const Containers::StridedArrayView1D<U>& dst) {
+    function(matrix, static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+}
+
+void transformPointsInto(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<const Vector2<Float>>& src, const Containers::StridedArrayView1D<Vector2<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformPoints2Into, matrix, src, dst);
+}
+
+void transformPointsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformPoints3Into, matrix, src, dst);
+}
+
+void transformPointsInto(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_DEBUG_ASSERT(dualQuaternion.isNormalized(),
+        "Math::transformPointsInto():" << dualQuaternion << "is not normalized", );
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformPointsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformPoints3Into, dualQuaternion.toMatrix(), src, dst);
+}
+
+void transformVectorsInto(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<const Vector2<Float>>& src, const Containers::StridedArrayView1D<Vector2<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformVectors2Into, matrix, src, dst);
+}
+
+void transformVectorsInto(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformVectors3Into, matrix, src, dst);
+}
+
+void transformVectorsInto(const Quaternion<Float>& quaternion, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_DEBUG_ASSERT(quaternion.isNormalized(),
+        "Math::transformVectorsInto():" << quaternion << "is not normalized", );
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformVectors3Into, Matrix4<Float>::from(quaternion.toMatrix(), {}), src, dst);
+}
+
+void transformVectorsInto(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_DEBUG_ASSERT(dualQuaternion.isNormalized(),
+        "Math::transformVectorsInto():" << dualQuaternion << "is not normalized", );
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::transformVectorsInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    transformInto(Implementation::transformVectors3Into, Matrix4<Float>::from(dualQuaternion.real().toMatrix(), {}), src, dst);
+}
+
+void transformPointsInPlace(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<Vector2<Float>>& data) {
+    transformInto(Implementation::transformPoints2Into, matrix, Containers::StridedArrayView1D<const Vector2<Float>>{data}, data);
+}
+
+void transformPointsInPlace(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<Vector3<Float>>& data) {
+    transformInto(Implementation::transformPoints3Into, matrix, Containers::StridedArrayView1D<const Vector3<Float>>{data}, data);
+}
+
+void transformPointsInPlace(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<Vector3<Float>>& data) {
+    CORRADE_DEBUG_ASSERT(dualQuaternion.isNormalized(),
+        "Math::transformPointsInPlace():" << dualQuaternion << "is not normalized", );
+    transformInto(Implementation::transformPoints3Into, dualQuaternion.toMatrix(), Containers::StridedArrayView1D<const Vector3<Float>>{data}, data);
+}
+
+void transformVectorsInPlace(const Matrix3<Float>& matrix, const Containers::StridedArrayView1D<Vector2<Float>>& data) {
+    transformInto(Implementation::transformVectors2Into, matrix, Containers::StridedArrayView1D<const Vector2<Float>>{data}, data);
+}
+
+void transformVectorsInPlace(const Matrix4<Float>& matrix, const Containers::StridedArrayView1D<Vector3<Float>>& data) {
+    transformInto(Implementation::transformVectors3Into, matrix, Containers::StridedArrayView1D<const Vector3<Float>>{data}, data);
+}
+
+void transformVectorsInPlace(const Quaternion<Float>& quaternion, const Containers::StridedArrayView1D<Vector3<Float>>& data) {
+    CORRADE_DEBUG_ASSERT(quaternion.isNormalized(),
+        "Math::transformVectorsInPlace():" << quaternion << "is not normalized", );
+    transformInto(Implementation::transformVectors3Into, Matrix4<Float>::from(quaternion.toMatrix(), {}), Containers::StridedArrayView1D<const Vector3<Float>>{data}, data);
+}
+
+void transformVectorsInPlace(const DualQuaternion<Float>& dualQuaternion, const Containers::StridedArrayView1D<Vector3<Float>>& data) {
+    CORRADE_DEBUG_ASSERT(dualQuaternion.isNormalized(),
+        "Math::transformVectorsInPlace():" << dualQuaternion << "is not normalized", );
+    transformInto(Implementation::transformVectors3Into, Matrix4<Float>::from(dualQuaternion.real().toMatrix(), {}), Containers::StridedArrayView1D<const Vector3<Float>>{data}, data);
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(normalizeQuaternionInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(lerpQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(lerpShortestPathQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpShortestPathQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpApproximateQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpShortestPathApproximateQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+
+namespace {
+
+enum class QuaternionInterpolation {
+    Lerp,
+    LerpShortestPath,
+    Slerp,
+    SlerpShortestPath,
+    SlerpApproximate,
+    SlerpShortestPathApproximate
+};
+
+template<bool shortestPath> Quaternion<Float> slerpApproximate(const Quaternion<Float>& normalizedA, const Quaternion<Float>& normalizedB, const Float t) {
+    const Float cosHalfAngle = Math::dot(normalizedA, normalizedB);
+    if(!shortestPath && cosHalfAngle < 0.0f)
+        return Math::slerp(normalizedA, normalizedB, t);
+
+    const Float d = std::abs(cosHalfAngle);
+    const Float k = (1.0904f + d*(-3.2452f + d*(3.55645f - d*1.43519f)))*(t - 0.5f)*(t - 0.5f) + 0.848013f + d*(-1.06021f + d*0.215638f);
+    const Float tAdjusted = t + t*(t - 0.5f)*(t - 1.0f)*k;
+    return ((1.0f - tAdjusted)*(cosHalfAngle < 0.0f ? -normalizedA : normalizedA) + tAdjusted*normalizedB).normalized();
+}
+
+template<QuaternionInterpolation interpolation> Quaternion<Float> interpolateQuaternion(const Quaternion<Float>& a, const Quaternion<Float>& b, const Float t) {
+    switch(interpolation) {
+        case QuaternionInterpolation::Lerp: return Math::lerp(a, b, t);
+        case QuaternionInterpolation::LerpShortestPath: return Math::lerpShortestPath(a, b, t);
+        case QuaternionInterpolation::Slerp: return Math::slerp(a, b, t);
+        case QuaternionInterpolation::SlerpShortestPath: return Math::slerpShortestPath(a, b, t);
+        case QuaternionInterpolation::SlerpApproximate: return slerpApproximate<false>(a, b, t);
+        case QuaternionInterpolation::SlerpShortestPathApproximate: return slerpApproximate<true>(a, b, t);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+
+void normalizeQuaternionIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        *reinterpret_cast<Quaternion<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = reinterpret_cast<const Quaternion<Float>*>(src + std::ptrdiff_t(i)*srcStride)->normalized();
+}
+
+template<QuaternionInterpolation interpolation> void interpolateQuaternionIntoScalar(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        *reinterpret_cast<Quaternion<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = interpolateQuaternion<interpolation>(
+            *reinterpret_cast<const Quaternion<Float>*>(a + std::ptrdiff_t(i)*aStride),
+            *reinterpret_cast<const Quaternion<Float>*>(b + std::ptrdiff_t(i)*bStride),
+            *reinterpret_cast<const Float*>(t + std::ptrdiff_t(i)*tStride));
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 inline void loadQuaternionsSse2(const char* const data, const std::ptrdiff_t stride, Float* const block, typename SoaSse2::Type& x, typename SoaSse2::Type& y, typename SoaSse2::Type& z, typename SoaSse2::Type& w) {
+    typedef SoaSse2 Vector;
+    const Float* in = reinterpret_cast<const Float*>(data);
+    if(stride != std::ptrdiff_t(sizeof(Quaternion<Float>))) {
+        for(std::size_t k = 0; k != Vector::Lanes; ++k)
+            std::memcpy(block + k*4, data + std::ptrdiff_t(k)*stride, sizeof(Quaternion<Float>));
+        in = block;
+    }
+
+    const typename Vector::Type xy01 = Vector::unpackLo(Vector::load(in, 16), Vector::load(in + 4, 16));
+    const typename Vector::Type xy23 = Vector::unpackLo(Vector::load(in + 8, 16), Vector::load(in + 12, 16));
+    const typename Vector::Type zw01 = Vector::unpackHi(Vector::load(in, 16), Vector::load(in + 4, 16));
+    const typename Vector::Type zw23 = Vector::unpackHi(Vector::load(in + 8, 16), Vector::load(in + 12, 16));
+    x = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy01, xy23);
+    y = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy01, xy23);
+    z = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(zw01, zw23);
+    w = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(zw01, zw23);
+}
+
+CORRADE_ENABLE_SSE2 inline void storeQuaternionsSse2(char* const data, const std::ptrdiff_t stride, Float* const block, const typename SoaSse2::Type x, const typename SoaSse2::Type y, const typename SoaSse2::Type z, const typename SoaSse2::Type w) {
+    typedef SoaSse2 Vector;
+    const bool contiguous = stride == std::ptrdiff_t(sizeof(Quaternion<Float>));
+    Float* out = contiguous ? reinterpret_cast<Float*>(data) : block;
+
+    const typename Vector::Type xy01 = Vector::unpackLo(x, y);
+    const typename Vector::Type xy23 = Vector::unpackHi(x, y);
+    const typename Vector::Type zw01 = Vector::unpackLo(z, w);
+    const typename Vector::Type zw23 = Vector::unpackHi(z, w);
+    Vector::store(out, 16, Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy01, zw01));
+    Vector::store(out + 4, 16, Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy01, zw01));
+    Vector::store(out + 8, 16, Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy23, zw23));
+    Vector::store(out + 12, 16, Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy23, zw23));
+
+    if(!contiguous) for(std::size_t k = 0; k != Vector::Lanes; ++k)
+        std::memcpy(data + std::ptrdiff_t(k)*stride, block + k*4, sizeof(Quaternion<Float>));
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type normalizeQuaternionsSse2(typename SoaSse2::Type& x, typename SoaSse2::Type& y, typename SoaSse2::Type& z, typename SoaSse2::Type& w) {
+    typedef SoaSse2 Vector;
+    const typename Vector::Type length = Vector::sqrt(Vector::madd(w, w, Vector::madd(z, z, Vector::madd(y, y, Vector::mul(x, x)))));
+    x = Vector::div(x, length);
+    y = Vector::div(y, length);
+    z = Vector::div(z, length);
+    w = Vector::div(w, length);
+    return length;
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type acosSse2(const typename SoaSse2::Type value) {
+    typedef SoaSse2 Vector;
+    const typename Vector::Type a = Vector::abs(value);
+    const typename Vector::Mask large = Vector::greaterThan(a, Vector::splat(0.5f));
+    const typename Vector::Type z2 = Vector::select(large, Vector::mul(Vector::splat(0.5f), Vector::sub(Vector::splat(1.0f), a)), Vector::mul(a, a));
+    const typename Vector::Type z = Vector::select(large, Vector::sqrt(z2), a);
+    typename Vector::Type p = Vector::madd(Vector::splat(4.2163199048e-2f), z2, Vector::splat(2.4181311049e-2f));
+    p = Vector::madd(p, z2, Vector::splat(4.5470025998e-2f));
+    p = Vector::madd(p, z2, Vector::splat(7.4953002686e-2f));
+    p = Vector::madd(p, z2, Vector::splat(1.6666752422e-1f));
+    p = Vector::madd(Vector::mul(p, z2), z, z);
+    const typename Vector::Type out = Vector::select(large, Vector::add(p, p), Vector::sub(Vector::splat(Constants<Float>::piHalf()), p));
+    return Vector::select(Vector::lessThan(value, Vector::splat(0.0f)), Vector::sub(Vector::splat(Constants<Float>::pi()), out), out);
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type sinSse2(const typename SoaSse2::Type value) {
+    typedef SoaSse2 Vector;
+    const typename Vector::Type magic = Vector::splat(12582912.0f);
+    const typename Vector::Type j = Vector::sub(Vector::add(Vector::mul(value, Vector::splat(0.318309886f)), magic), magic);
+    const typename Vector::Type halfJ = Vector::mul(j, Vector::splat(0.5f));
+    const typename Vector::Mask odd = Vector::notEqual(halfJ, Vector::sub(Vector::add(halfJ, magic), magic));
+    const typename Vector::Type x = Vector::sub(Vector::sub(value, Vector::mul(j, Vector::splat(3.14159274101257f))), Vector::mul(j, Vector::splat(-8.7422776573e-8f)));
+    const typename Vector::Type x2 = Vector::mul(x, x);
+    typename Vector::Type p = Vector::madd(Vector::splat(-2.5052108385e-8f), x2, Vector::splat(2.7557319224e-6f));
+    p = Vector::madd(p, x2, Vector::splat(-1.9841269841e-4f));
+    p = Vector::madd(p, x2, Vector::splat(8.3333333333e-3f));
+    p = Vector::madd(p, x2, Vector::splat(-1.6666666667e-1f));
+    return Vector::negateIf(odd, Vector::madd(Vector::mul(p, x2), x, x));
+}
+
+template<bool shortestPath> CORRADE_ENABLE_SSE2 inline void slerpQuaternionsSse2(const typename SoaSse2::Type ax, const typename SoaSse2::Type ay, const typename SoaSse2::Type az, const typename SoaSse2::Type aw, const typename SoaSse2::Type bx, const typename SoaSse2::Type by, const typename SoaSse2::Type bz, const typename SoaSse2::Type bw, const typename SoaSse2::Type cosHalfAngle, const typename SoaSse2::Type t, typename SoaSse2::Type& x, typename SoaSse2::Type& y, typename SoaSse2::Type& z, typename SoaSse2::Type& w) {
+    typedef SoaSse2 Vector;
+    const typename Vector::Mask flip = Vector::lessThan(cosHalfAngle, Vector::splat(0.0f));
+    const typename Vector::Type shortestAx = Vector::negateIf(flip, ax);
+    const typename Vector::Type shortestAy = Vector::negateIf(flip, ay);
+    const typename Vector::Type shortestAz = Vector::negateIf(flip, az);
+    const typename Vector::Type shortestAw = Vector::negateIf(flip, aw);
+    const typename Vector::Type absCosHalfAngle = Vector::abs(cosHalfAngle);
+    const typename Vector::Mask linear = shortestPath ?
+        Vector::greaterEqual(absCosHalfAngle, Vector::splat(1.0f - TypeTraits<Float>::epsilon())) :
+        Vector::greaterThan(absCosHalfAngle, Vector::splat(1.0f - 0.5f*TypeTraits<Float>::epsilon()));
+
+    const typename Vector::Type oneMinusT = Vector::sub(Vector::splat(1.0f), t);
+    const typename Vector::Type angle = acosSse2(shortestPath ? absCosHalfAngle : cosHalfAngle);
+    const typename Vector::Type sinAngle = sinSse2(angle);
+    const typename Vector::Type weightA = sinSse2(Vector::mul(oneMinusT, angle));
+    const typename Vector::Type weightB = sinSse2(Vector::mul(t, angle));
+    x = Vector::select(linear, Vector::madd(t, bx, Vector::mul(oneMinusT, shortestAx)), Vector::div(Vector::madd(weightB, bx, Vector::mul(weightA, shortestPath ? shortestAx : ax)), sinAngle));
+    y = Vector::select(linear, Vector::madd(t, by, Vector::mul(oneMinusT, shortestAy)), Vector::div(Vector::madd(weightB, by, Vector::mul(weightA, shortestPath ? shortestAy : ay)), sinAngle));
+    z = Vector::select(linear, Vector::madd(t, bz, Vector::mul(oneMinusT, shortestAz)), Vector::div(Vector::madd(weightB, bz, Vector::mul(weightA, shortestPath ? shortestAz : az)), sinAngle));
+    w = Vector::select(linear, Vector::madd(t, bw, Vector::mul(oneMinusT, shortestAw)), Vector::div(Vector::madd(weightB, bw, Vector::mul(weightA, shortestPath ? shortestAw : aw)), sinAngle));
+}
+
+CORRADE_ENABLE_SSE2 void normalizeQuaternionIntoSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + Vector::Lanes <= size; i += Vector::Lanes) {
+        typename Vector::Type x, y, z, w;
+        loadQuaternionsSse2(src + std::ptrdiff_t(i)*srcStride, srcStride, block, x, y, z, w);
+        normalizeQuaternionsSse2(x, y, z, w);
+        storeQuaternionsSse2(dst + std::ptrdiff_t(i)*dstStride, dstStride, block, x, y, z, w);
+    }
+
+    normalizeQuaternionIntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<QuaternionInterpolation interpolation> CORRADE_ENABLE_SSE2 void interpolateQuaternionIntoSse2(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    const bool shortestPath = interpolation == QuaternionInterpolation::LerpShortestPath || interpolation == QuaternionInterpolation::SlerpShortestPath || interpolation == QuaternionInterpolation::SlerpShortestPathApproximate;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + Vector::Lanes <= size; i += Vector::Lanes) {
+        typename Vector::Type ax, ay, az, aw, bx, by, bz, bw, x, y, z, w, tt;
+        loadQuaternionsSse2(a + std::ptrdiff_t(i)*aStride, aStride, block, ax, ay, az, aw);
+        loadQuaternionsSse2(b + std::ptrdiff_t(i)*bStride, bStride, block, bx, by, bz, bw);
+        if(!tStride) tt = Vector::splat(*reinterpret_cast<const Float*>(t));
+        else if(tStride == std::ptrdiff_t(sizeof(Float)))
+            tt = Vector::load(reinterpret_cast<const Float*>(t + std::ptrdiff_t(i)*tStride), 4);
+        else {
+            for(std::size_t k = 0; k != Vector::Lanes; ++k)
+                std::memcpy(block + k, t + std::ptrdiff_t(i + k)*tStride, sizeof(Float));
+            tt = Vector::load(block, 4);
+        }
+
+        const typename Vector::Type cosHalfAngle = Vector::madd(aw, bw, Vector::madd(az, bz, Vector::madd(ay, by, Vector::mul(ax, bx))));
+        if(interpolation == QuaternionInterpolation::Slerp || interpolation == QuaternionInterpolation::SlerpShortestPath) {
+            slerpQuaternionsSse2<shortestPath>(ax, ay, az, aw, bx, by, bz, bw, cosHalfAngle, tt, x, y, z, w);
+        } else {
+            const typename Vector::Mask flip = Vector::lessThan(cosHalfAngle, Vector::splat(0.0f));
+            const typename Vector::Type shortestAx = shortestPath ? Vector::negateIf(flip, ax) : ax;
+            const typename Vector::Type shortestAy = shortestPath ? Vector::negateIf(flip, ay) : ay;
+            const typename Vector::Type shortestAz = shortestPath ? Vector::negateIf(flip, az) : az;
+            const typename Vector::Type shortestAw = shortestPath ? Vector::negateIf(flip, aw) : aw;
+            typename Vector::Type tAdjusted = tt;
+            if(interpolation == QuaternionInterpolation::SlerpApproximate || interpolation == QuaternionInterpolation::SlerpShortestPathApproximate) {
+                const typename Vector::Type d = Vector::abs(cosHalfAngle);
+                const typename Vector::Type tHalf = Vector::sub(tt, Vector::splat(0.5f));
+                const typename Vector::Type k = Vector::madd(Vector::mul(Vector::madd(Vector::madd(Vector::madd(Vector::splat(-1.43519f), d, Vector::splat(3.55645f)), d, Vector::splat(-3.2452f)), d, Vector::splat(1.0904f)), tHalf), tHalf, Vector::madd(Vector::madd(Vector::splat(0.215638f), d, Vector::splat(-1.06021f)), d, Vector::splat(0.848013f)));
+                tAdjusted = Vector::madd(Vector::mul(Vector::mul(tt, tHalf), Vector::sub(tt, Vector::splat(1.0f))), k, tt);
+            }
+
+            const typename Vector::Type oneMinusT = Vector::sub(Vector::splat(1.0f), tAdjusted);
+            x = Vector::madd(tAdjusted, bx, Vector::mul(oneMinusT, shortestAx));
+            y = Vector::madd(tAdjusted, by, Vector::mul(oneMinusT, shortestAy));
+            z = Vector::madd(tAdjusted, bz, Vector::mul(oneMinusT, shortestAz));
+            w = Vector::madd(tAdjusted, bw, Vector::mul(oneMinusT, shortestAw));
+            normalizeQuaternionsSse2(x, y, z, w);
+
+            if(interpolation == QuaternionInterpolation::SlerpApproximate && Vector::any(flip)) {
+                typename Vector::Type exactX, exactY, exactZ, exactW;
+                slerpQuaternionsSse2<false>(ax, ay, az, aw, bx, by, bz, bw, cosHalfAngle, tt, exactX, exactY, exactZ, exactW);
+                x = Vector::select(flip, exactX, x);
+                y = Vector::select(flip, exactY, y);
+                z = Vector::select(flip, exactZ, z);
+                w = Vector::select(flip, exactW, w);
+            }
+        }
+
+        storeQuaternionsSse2(dst + std::ptrdiff_t(i)*dstStride, dstStride, block, x, y, z, w);
+    }
+
+    interpolateQuaternionIntoScalar<interpolation>(a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, t + std::ptrdiff_t(i)*tStride, tStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_ENABLE(AVX,AVX_FMA) inline void loadQuaternionsAvxFma(const char* const data, const std::ptrdiff_t stride, Float* const block, typename SoaAvxFma::Type& x, typename SoaAvxFma::Type& y, typename SoaAvxFma::Type& z, typename SoaAvxFma::Type& w) {
+    typedef SoaAvxFma Vector;
+    const Float* in = reinterpret_cast<const Float*>(data);
+    if(stride != std::ptrdiff_t(sizeof(Quaternion<Float>))) {
+        for(std::size_t k = 0; k != Vector::Lanes; ++k)
+            std::memcpy(block + k*4, data + std::ptrdiff_t(k)*stride, sizeof(Quaternion<Float>));
+        in = block;
+    }
+
+    const typename Vector::Type xy01 = Vector::unpackLo(Vector::load(in, 16), Vector::load(in + 4, 16));
+    const typename Vector::Type xy23 = Vector::unpackLo(Vector::load(in + 8, 16), Vector::load(in + 12, 16));
+    const typename Vector::Type zw01 = Vector::unpackHi(Vector::load(in, 16), Vector::load(in + 4, 16));
+    const typename Vector::Type zw23 = Vector::unpackHi(Vector::load(in + 8, 16), Vector::load(in + 12, 16));
+    x = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy01, xy23);
+    y = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy01, xy23);
+    z = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(zw01, zw23);
+    w = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(zw01, zw23);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline void storeQuaternionsAvxFma(char* const data, const std::ptrdiff_t stride, Float* const block, const typename SoaAvxFma::Type x, const typename SoaAvxFma::Type y, const typename SoaAvxFma::Type z, const typename SoaAvxFma::Type w) {
+    typedef SoaAvxFma Vector;
+    const bool contiguous = stride == std::ptrdiff_t(sizeof(Quaternion<Float>));
+    Float* out = contiguous ? reinterpret_cast<Float*>(data) : block;
+
+    const typename Vector::Type xy01 = Vector::unpackLo(x, y);
+    const typename Vector::Type xy23 = Vector::unpackHi(x, y);
+    const typename Vector::Type zw01 = Vector::unpackLo(z, w);
+    const typename Vector::Type zw23 = Vector::unpackHi(z, w);
+    Vector::store(out, 16, Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy01, zw01));
+    Vector::store(out + 4, 16, Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy01, zw01));
+    Vector::store(out + 8, 16, Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy23, zw23));
+    Vector::store(out + 12, 16, Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy23, zw23));
+
+    if(!contiguous) for(std::size_t k = 0; k != Vector::Lanes; ++k)
+        std::memcpy(data + std::ptrdiff_t(k)*stride, block + k*4, sizeof(Quaternion<Float>));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type normalizeQuaternionsAvxFma(typename SoaAvxFma::Type& x, typename SoaAvxFma::Type& y, typename SoaAvxFma::Type& z, typename SoaAvxFma::Type& w) {
+    typedef SoaAvxFma Vector;
+    const typename Vector::Type length = Vector::sqrt(Vector::madd(w, w, Vector::madd(z, z, Vector::madd(y, y, Vector::mul(x, x)))));
+    x = Vector::div(x, length);
+    y = Vector::div(y, length);
+    z = Vector::div(z, length);
+    w = Vector::div(w, length);
+    return length;
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type acosAvxFma(const typename SoaAvxFma::Type value) {
+    typedef SoaAvxFma Vector;
+    const typename Vector::Type a = Vector::abs(value);
+    const typename Vector::Mask large = Vector::greaterThan(a, Vector::splat(0.5f));
+    const typename Vector::Type z2 = Vector::select(large, Vector::mul(Vector::splat(0.5f), Vector::sub(Vector::splat(1.0f), a)), Vector::mul(a, a));
+    const typename Vector::Type z = Vector::select(large, Vector::sqrt(z2), a);
+    typename Vector::Type p = Vector::madd(Vector::splat(4.2163199048e-2f), z2, Vector::splat(2.4181311049e-2f));
+    p = Vector::madd(p, z2, Vector::splat(4.5470025998e-2f));
+    p = Vector::madd(p, z2, Vector::splat(7.4953002686e-2f));
+    p = Vector::madd(p, z2, Vector::splat(1.6666752422e-1f));
+    p = Vector::madd(Vector::mul(p, z2), z, z);
+    const typename Vector::Type out = Vector::select(large, Vector::add(p, p), Vector::sub(Vector::splat(Constants<Float>::piHalf()), p));
+    return Vector::select(Vector::lessThan(value, Vector::splat(0.0f)), Vector::sub(Vector::splat(Constants<Float>::pi()), out), out);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type sinAvxFma(const typename SoaAvxFma::Type value) {
+    typedef SoaAvxFma Vector;
+    const typename Vector::Type magic = Vector::splat(12582912.0f);
+    const typename Vector::Type j = Vector::sub(Vector::add(Vector::mul(value, Vector::splat(0.318309886f)), magic), magic);
+    const typename Vector::Type halfJ = Vector::mul(j, Vector::splat(0.5f));
+    const typename Vector::Mask odd = Vector::notEqual(halfJ, Vector::sub(Vector::add(halfJ, magic), magic));
+    const typename Vector::Type x = Vector::sub(Vector::sub(value, Vector::mul(j, Vector::splat(3.14159274101257f))), Vector::mul(j, Vector::splat(-8.7422776573e-8f)));
+    const typename Vector::Type x2 = Vector::mul(x, x);
+    typename Vector::Type p = Vector::madd(Vector::splat(-2.5052108385e-8f), x2, Vector::splat(2.7557319224e-6f));
+    p = Vector::madd(p, x2, Vector::splat(-1.9841269841e-4f));
+    p = Vector::madd(p, x2, Vector::splat(8.3333333333e-3f));
+    p = Vector::madd(p, x2, Vector::splat(-1.6666666667e-1f));
+    return Vector::negateIf(odd, Vector::madd(Vector::mul(p, x2), x, x));
+}
+
+template<bool shortestPath> CORRADE_ENABLE(AVX,AVX_FMA) inline void slerpQuaternionsAvxFma(const typename SoaAvxFma::Type ax, const typename SoaAvxFma::Type ay, const typename SoaAvxFma::Type az, const typename SoaAvxFma::Type aw, const typename SoaAvxFma::Type bx, const typename SoaAvxFma::Type by, const typename SoaAvxFma::Type bz, const typename SoaAvxFma::Type bw, const typename SoaAvxFma::Type cosHalfAngle, const typename SoaAvxFma::Type t, typename SoaAvxFma::Type& x, typename SoaAvxFma::Type& y, typename SoaAvxFma::Type& z, typename SoaAvxFma::Type& w) {
+    typedef SoaAvxFma Vector;
+    const typename Vector::Mask flip = Vector::lessThan(cosHalfAngle, Vector::splat(0.0f));
+    const typename Vector::Type shortestAx = Vector::negateIf(flip, ax);
+    const typename Vector::Type shortestAy = Vector::negateIf(flip, ay);
+    const typename Vector::Type shortestAz = Vector::negateIf(flip, az);
+    const typename Vector::Type shortestAw = Vector::negateIf(flip, aw);
+    const typename Vector::Type absCosHalfAngle = Vector::abs(cosHalfAngle);
+    const typename Vector::Mask linear = shortestPath ?
+        Vector::greaterEqual(absCosHalfAngle, Vector::splat(1.0f - TypeTraits<Float>::epsilon())) :
+        Vector::greaterThan(absCosHalfAngle, Vector::splat(1.0f - 0.5f*TypeTraits<Float>::epsilon()));
+
+    const typename Vector::Type oneMinusT = Vector::sub(Vector::splat(1.0f), t);
+    const typename Vector::Type angle = acosAvxFma(shortestPath ? absCosHalfAngle : cosHalfAngle);
+    const typename Vector::Type sinAngle = sinAvxFma(angle);
+    const typename Vector::Type weightA = sinAvxFma(Vector::mul(oneMinusT, angle));
+    const typename Vector::Type weightB = sinAvxFma(Vector::mul(t, angle));
+    x = Vector::select(linear, Vector::madd(t, bx, Vector::mul(oneMinusT, shortestAx)), Vector::div(Vector::madd(weightB, bx, Vector::mul(weightA, shortestPath ? shortestAx : ax)), sinAngle));
+    y = Vector::select(linear, Vector::madd(t, by, Vector::mul(oneMinusT, shortestAy)), Vector::div(Vector::madd(weightB, by, Vector::mul(weightA, shortestPath ? shortestAy : ay)), sinAngle));
+    z = Vector::select(linear, Vector::madd(t, bz, Vector::mul(oneMinusT, shortestAz)), Vector::div(Vector::madd(weightB, bz, Vector::mul(weightA, shortestPath ? shortestAz : az)), sinAngle));
+    w = Vector::select(linear, Vector::madd(t, bw, Vector::mul(oneMinusT, shortestAw)), Vector::div(Vector::madd(weightB, bw, Vector::mul(weightA, shortestPath ? shortestAw : aw)), sinAngle));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void normalizeQuaternionIntoAvxFma(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + Vector::Lanes <= size; i += Vector::Lanes) {
+        typename Vector::Type x, y, z, w;
+        loadQuaternionsAvxFma(src + std::ptrdiff_t(i)*srcStride, srcStride, block, x, y, z, w);
+        normalizeQuaternionsAvxFma(x, y, z, w);
+        storeQuaternionsAvxFma(dst + std::ptrdiff_t(i)*dstStride, dstStride, block, x, y, z, w);
+    }
+
+    normalizeQuaternionIntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<QuaternionInterpolation interpolation> CORRADE_ENABLE(AVX,AVX_FMA) void interpolateQuaternionIntoAvxFma(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    const bool shortestPath = interpolation == QuaternionInterpolation::LerpShortestPath || interpolation == QuaternionInterpolation::SlerpShortestPath || interpolation == QuaternionInterpolation::SlerpShortestPathApproximate;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + Vector::Lanes <= size; i += Vector::Lanes) {
+        typename Vector::Type ax, ay, az, aw, bx, by, bz, bw, x, y, z, w, tt;
+        loadQuaternionsAvxFma(a + std::ptrdiff_t(i)*aStride, aStride, block, ax, ay, az, aw);
+        loadQuaternionsAvxFma(b + std::ptrdiff_t(i)*bStride, bStride, block, bx, by, bz, bw);
+        if(!tStride) tt = Vector::splat(*reinterpret_cast<const Float*>(t));
+        else if(tStride == std::ptrdiff_t(sizeof(Float)))
+            tt = Vector::load(reinterpret_cast<const Float*>(t + std::ptrdiff_t(i)*tStride), 4);
+        else {
+            for(std::size_t k = 0; k != Vector::Lanes; ++k)
+                std::memcpy(block + k, t + std::ptrdiff_t(i + k)*tStride, sizeof(Float));
+            tt = Vector::load(block, 4);
+        }
+
+        const typename Vector::Type cosHalfAngle = Vector::madd(aw, bw, Vector::madd(az, bz, Vector::madd(ay, by, Vector::mul(ax, bx))));
+        if(interpolation == QuaternionInterpolation::Slerp || interpolation == QuaternionInterpolation::SlerpShortestPath) {
+            slerpQuaternionsAvxFma<shortestPath>(ax, ay, az, aw, bx, by, bz, bw, cosHalfAngle, tt, x, y, z, w);
+        } else {
+            const typename Vector::Mask flip = Vector::lessThan(cosHalfAngle, Vector::splat(0.0f));
+            const typename Vector::Type shortestAx = shortestPath ? Vector::negateIf(flip, ax) : ax;
+            const typename Vector::Type shortestAy = shortestPath ? Vector::negateIf(flip, ay) : ay;
+            const typename Vector::Type shortestAz = shortestPath ? Vector::negateIf(flip, az) : az;
+            const typename Vector::Type shortestAw = shortestPath ? Vector::negateIf(flip, aw) : aw;
+            typename Vector::Type tAdjusted = tt;
+            if(interpolation == QuaternionInterpolation::SlerpApproximate || interpolation == QuaternionInterpolation::SlerpShortestPathApproximate) {
+                const typename Vector::Type d = Vector::abs(cosHalfAngle);
+                const typename Vector::Type tHalf = Vector::sub(tt, Vector::splat(0.5f));
+                const typename Vector::Type k = Vector::madd(Vector::mul(Vector::madd(Vector::madd(Vector::madd(Vector::splat(-1.43519f), d, Vector::splat(3.55645f)), d, Vector::splat(-3.2452f)), d, Vector::splat(1.0904f)), tHalf), tHalf, Vector::madd(Vector::madd(Vector::splat(0.215638f), d, Vector::splat(-1.06021f)), d, Vector::splat(0.848013f)));
+                tAdjusted = Vector::madd(Vector::mul(Vector::mul(tt, tHalf), Vector::sub(tt, Vector::splat(1.0f))), k, tt);
+            }
+
+            const typename Vector::Type oneMinusT = Vector::sub(Vector::splat(1.0f), tAdjusted);
+            x = Vector::madd(tAdjusted, bx, Vector::mul(oneMinusT, shortestAx));
+            y = Vector::madd(tAdjusted, by, Vector::mul(oneMinusT, shortestAy));
+            z = Vector::madd(tAdjusted, bz, Vector::mul(oneMinusT, shortestAz));
+            w = Vector::madd(tAdjusted, bw, Vector::mul(oneMinusT, shortestAw));
+            normalizeQuaternionsAvxFma(x, y, z, w);
+
+            if(interpolation == QuaternionInterpolation::SlerpApproximate && Vector::any(flip)) {
+                typename Vector::Type exactX, exactY, exactZ, exactW;
+                slerpQuaternionsAvxFma<false>(ax, ay, az, aw, bx, by, bz, bw, cosHalfAngle, tt, exactX, exactY, exactZ, exactW);
+                x = Vector::select(flip, exactX, x);
+                y = Vector::select(flip, exactY, y);
+                z = Vector::select(flip, exactZ, z);
+                w = Vector::select(flip, exactW, w);
+            }
+        }
+
+        storeQuaternionsAvxFma(dst + std::ptrdiff_t(i)*dstStride, dstStride, block, x, y, z, w);
+    }
+
+    interpolateQuaternionIntoScalar<interpolation>(a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, t + std::ptrdiff_t(i)*tStride, tStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+CORRADE_ENABLE_AVX512F inline void loadQuaternionsAvx512(const char* const data, const std::ptrdiff_t stride, Float* const block, typename SoaAvx512::Type& x, typename SoaAvx512::Type& y, typename SoaAvx512::Type& z, typename SoaAvx512::Type& w) {
+    typedef SoaAvx512 Vector;
+    const Float* in = reinterpret_cast<const Float*>(data);
+    if(stride != std::ptrdiff_t(sizeof(Quaternion<Float>))) {
+        for(std::size_t k = 0; k != Vector::Lanes; ++k)
+            std::memcpy(block + k*4, data + std::ptrdiff_t(k)*stride, sizeof(Quaternion<Float>));
+        in = block;
+    }
+
+    const typename Vector::Type xy01 = Vector::unpackLo(Vector::load(in, 16), Vector::load(in + 4, 16));
+    const typename Vector::Type xy23 = Vector::unpackLo(Vector::load(in + 8, 16), Vector::load(in + 12, 16));
+    const typename Vector::Type zw01 = Vector::unpackHi(Vector::load(in, 16), Vector::load(in + 4, 16));
+    const typename Vector::Type zw23 = Vector::unpackHi(Vector::load(in + 8, 16), Vector::load(in + 12, 16));
+    x = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy01, xy23);
+    y = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy01, xy23);
+    z = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(zw01, zw23);
+    w = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(zw01, zw23);
+}
+
+CORRADE_ENABLE_AVX512F inline void storeQuaternionsAvx512(char* const data, const std::ptrdiff_t stride, Float* const block, const typename SoaAvx512::Type x, const typename SoaAvx512::Type y, const typename SoaAvx512::Type z, const typename SoaAvx512::Type w) {
+    typedef SoaAvx512 Vector;
+    const bool contiguous = stride == std::ptrdiff_t(sizeof(Quaternion<Float>));
+    Float* out = contiguous ? reinterpret_cast<Float*>(data) : block;
+
+    const typename Vector::Type xy01 = Vector::unpackLo(x, y);
+    const typename Vector::Type xy23 = Vector::unpackHi(x, y);
+    const typename Vector::Type zw01 = Vector::unpackLo(z, w);
+    const typename Vector::Type zw23 = Vector::unpackHi(z, w);
+    Vector::store(out, 16, Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy01, zw01));
+    Vector::store(out + 4, 16, Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy01, zw01));
+    Vector::store(out + 8, 16, Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(xy23, zw23));
+    Vector::store(out + 12, 16, Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(xy23, zw23));
+
+    if(!contiguous) for(std::size_t k = 0; k != Vector::Lanes; ++k)
+        std::memcpy(data + std::ptrdiff_t(k)*stride, block + k*4, sizeof(Quaternion<Float>));
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type normalizeQuaternionsAvx512(typename SoaAvx512::Type& x, typename SoaAvx512::Type& y, typename SoaAvx512::Type& z, typename SoaAvx512::Type& w) {
+    typedef SoaAvx512 Vector;
+    const typename Vector::Type length = Vector::sqrt(Vector::madd(w, w, Vector::madd(z, z, Vector::madd(y, y, Vector::mul(x, x)))));
+    x = Vector::div(x, length);
+    y = Vector::div(y, length);
+    z = Vector::div(z, length);
+    w = Vector::div(w, length);
+    return length;
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type acosAvx512(const typename SoaAvx512::Type value) {
+    typedef SoaAvx512 Vector;
+    const typename Vector::Type a = Vector::abs(value);
+    const typename Vector::Mask large = Vector::greaterThan(a, Vector::splat(0.5f));
+    const typename Vector::Type z2 = Vector::select(large, Vector::mul(Vector::splat(0.5f), Vector::sub(Vector::splat(1.0f), a)), Vector::mul(a, a));
+    const typename Vector::Type z = Vector::select(large, Vector::sqrt(z2), a);
+    typename Vector::Type p = Vector::madd(Vector::splat(4.2163199048e-2f), z2, Vector::splat(2.4181311049e-2f));
+    p = Vector::madd(p, z2, Vector::splat(4.5470025998e-2f));
+    p = Vector::madd(p, z2, Vector::splat(7.4953002686e-2f));
+    p = Vector::madd(p, z2, Vector::splat(1.6666752422e-1f));
+    p = Vector::madd(Vector::mul(p, z2), z, z);
+    const typename Vector::Type out = Vector::select(large, Vector::add(p, p), Vector::sub(Vector::splat(Constants<Float>::piHalf()), p));
+    return Vector::select(Vector::lessThan(value, Vector::splat(0.0f)), Vector::sub(Vector::splat(Constants<Float>::pi()), out), out);
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type sinAvx512(const typename SoaAvx512::Type value) {
+    typedef SoaAvx512 Vector;
+    const typename Vector::Type magic = Vector::splat(12582912.0f);
+    const typename Vector::Type j = Vector::sub(Vector::add(Vector::mul(value, Vector::splat(0.318309886f)), magic), magic);
+    const typename Vector::Type halfJ = Vector::mul(j, Vector::splat(0.5f));
+    const typename Vector::Mask odd = Vector::notEqual(halfJ, Vector::sub(Vector::add(halfJ, magic), magic));
+    const typename Vector::Type x = Vector::sub(Vector::sub(value, Vector::mul(j, Vector::splat(3.14159274101257f))), Vector::mul(j, Vector::splat(-8.7422776573e-8f)));
+    const typename Vector::Type x2 = Vector::mul(x, x);
+    typename Vector::Type p = Vector::madd(Vector::splat(-2.5052108385e-8f), x2, Vector::splat(2.7557319224e-6f));
+    p = Vector::madd(p, x2, Vector::splat(-1.9841269841e-4f));
+    p = Vector::madd(p, x2, Vector::splat(8.3333333333e-3f));
+    p = Vector::madd(p, x2, Vector::splat(-1.6666666667e-1f));
+    return Vector::negateIf(odd, Vector::madd(Vector::mul(p, x2), x, x));
+}
+
+template<bool shortestPath> CORRADE_ENABLE_AVX512F inline void slerpQuaternionsAvx512(const typename SoaAvx512::Type ax, const typename SoaAvx512::Type ay, const typename SoaAvx512::Type az, const typename SoaAvx512::Type aw, const typename SoaAvx512::Type bx, const typename SoaAvx512::Type by, const typename SoaAvx512::Type bz, const typename SoaAvx512::Type bw, const typename SoaAvx512::Type cosHalfAngle, const typename SoaAvx512::Type t, typename SoaAvx512::Type& x, typename SoaAvx512::Type& y, typename SoaAvx512::Type& z, typename SoaAvx512::Type& w) {
+    typedef SoaAvx512 Vector;
+    const typename Vector::Mask flip = Vector::lessThan(cosHalfAngle, Vector::splat(0.0f));
+    const typename Vector::Type shortestAx = Vector::negateIf(flip, ax);
+    const typename Vector::Type shortestAy = Vector::negateIf(flip, ay);
+    const typename Vector::Type shortestAz = Vector::negateIf(flip, az);
+    const typename Vector::Type shortestAw = Vector::negateIf(flip, aw);
+    const typename Vector::Type absCosHalfAngle = Vector::abs(cosHalfAngle);
+    const typename Vector::Mask linear = shortestPath ?
+        Vector::greaterEqual(absCosHalfAngle, Vector::splat(1.0f - TypeTraits<Float>::epsilon())) :
+        Vector::greaterThan(absCosHalfAngle, Vector::splat(1.0f - 0.5f*TypeTraits<Float>::epsilon()));
+
+    const typename Vector::Type oneMinusT = Vector::sub(Vector::splat(1.0f), t);
+    const typename Vector::Type angle = acosAvx512(shortestPath ? absCosHalfAngle : cosHalfAngle);
+    const typename Vector::Type sinAngle = sinAvx512(angle);
+    const typename Vector::Type weightA = sinAvx512(Vector::mul(oneMinusT, angle));
+    const typename Vector::Type weightB = sinAvx512(Vector::mul(t, angle));
+    x = Vector::select(linear, Vector::madd(t, bx, Vector::mul(oneMinusT, shortestAx)), Vector::div(Vector::madd(weightB, bx, Vector::mul(weightA, shortestPath ? shortestAx : ax)), sinAngle));
+    y = Vector::select(linear, Vector::madd(t, by, Vector::mul(oneMinusT, shortestAy)), Vector::div(Vector::madd(weightB, by, Vector::mul(weightA, shortestPath ? shortestAy : ay)), sinAngle));
+    z = Vector::select(linear, Vector::madd(t, bz, Vector::mul(oneMinusT, shortestAz)), Vector::div(Vector::madd(weightB, bz, Vector::mul(weightA, shortestPath ? shortestAz : az)), sinAngle));
+    w = Vector::select(linear, Vector::madd(t, bw, Vector::mul(oneMinusT, shortestAw)), Vector::div(Vector::madd(weightB, bw, Vector::mul(weightA, shortestPath ? shortestAw : aw)), sinAngle));
+}
+
+CORRADE_ENABLE_AVX512F void normalizeQuaternionIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + Vector::Lanes <= size; i += Vector::Lanes) {
+        typename Vector::Type x, y, z, w;
+        loadQuaternionsAvx512(src + std::ptrdiff_t(i)*srcStride, srcStride, block, x, y, z, w);
+        normalizeQuaternionsAvx512(x, y, z, w);
+        storeQuaternionsAvx512(dst + std::ptrdiff_t(i)*dstStride, dstStride, block, x, y, z, w);
+    }
+
+    normalizeQuaternionIntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<QuaternionInterpolation interpolation> CORRADE_ENABLE_AVX512F void interpolateQuaternionIntoAvx512(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const char* t, const std::ptrdiff_t tStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    const bool shortestPath = interpolation == QuaternionInterpolation::LerpShortestPath || interpolation == QuaternionInterpolation::SlerpShortestPath || interpolation == QuaternionInterpolation::SlerpShortestPathApproximate;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + Vector::Lanes <= size; i += Vector::Lanes) {
+        typename Vector::Type ax, ay, az, aw, bx, by, bz, bw, x, y, z, w, tt;
+        loadQuaternionsAvx512(a + std::ptrdiff_t(i)*aStride, aStride, block, ax, ay, az, aw);
+        loadQuaternionsAvx512(b + std::ptrdiff_t(i)*bStride, bStride, block, bx, by, bz, bw);
+        if(!tStride) tt = Vector::splat(*reinterpret_cast<const Float*>(t));
+        else if(tStride == std::ptrdiff_t(sizeof(Float)))
+            tt = Vector::load(reinterpret_cast<const Float*>(t + std::ptrdiff_t(i)*tStride), 4);
+        else {
+            for(std::size_t k = 0; k != Vector::Lanes; ++k)
+                std::memcpy(block + k, t + std::ptrdiff_t(i + k)*tStride, sizeof(Float));
+            tt = Vector::load(block, 4);
+        }
+
+        const typename Vector::Type cosHalfAngle = Vector::madd(aw, bw, Vector::madd(az, bz, Vector::madd(ay, by, Vector::mul(ax, bx))));
+        if(interpolation == QuaternionInterpolation::Slerp || interpolation == QuaternionInterpolation::SlerpShortestPath) {
+            slerpQuaternionsAvx512<shortestPath>(ax, ay, az, aw, bx, by, bz, bw, cosHalfAngle, tt, x, y, z, w);
+        } else {
+            const typename Vector::Mask flip = Vector::lessThan(cosHalfAngle, Vector::splat(0.0f));
+            const typename Vector::Type shortestAx = shortestPath ? Vector::negateIf(flip, ax) : ax;
+            const typename Vector::Type shortestAy = shortestPath ? Vector::negateIf(flip, ay) : ay;
+            const typename Vector::Type shortestAz = shortestPath ? Vector::negateIf(flip, az) : az;
+            const typename Vector::Type shortestAw = shortestPath ? Vector::negateIf(flip, aw) : aw;
+            typename Vector::Type tAdjusted = tt;
+            if(interpolation == QuaternionInterpolation::SlerpApproximate || interpolation == QuaternionInterpolation::SlerpShortestPathApproximate) {
+                const typename Vector::Type d = Vector::abs(cosHalfAngle);
+                const typename Vector::Type tHalf = Vector::sub(tt, Vector::splat(0.5f));
+                const typename Vector::Type k = Vector::madd(Vector::mul(Vector::madd(Vector::madd(Vector::madd(Vector::splat(-1.43519f), d, Vector::splat(3.55645f)), d, Vector::splat(-3.2452f)), d, Vector::splat(1.0904f)), tHalf), tHalf, Vector::madd(Vector::madd(Vector::splat(0.215638f), d, Vector::splat(-1.06021f)), d, Vector::splat(0.848013f)));
+                tAdjusted = Vector::madd(Vector::mul(Vector::mul(tt, tHalf), Vector::sub(tt, Vector::splat(1.0f))), k, tt);
+            }
+
+            const typename Vector::Type oneMinusT = Vector::sub(Vector::splat(1.0f), tAdjusted);
+            x = Vector::madd(tAdjusted, bx, Vector::mul(oneMinusT, shortestAx));
+            y = Vector::madd(tAdjusted, by, Vector::mul(oneMinusT, shortestAy));
+            z = Vector::madd(tAdjusted, bz, Vector::mul(oneMinusT, shortestAz));
+            w = Vector::madd(tAdjusted, bw, Vector::mul(oneMinusT, shortestAw));
+            normalizeQuaternionsAvx512(x, y, z, w);
+
+            if(interpolation == QuaternionInterpolation::SlerpApproximate && Vector::any(flip)) {
+                typename Vector::Type exactX, exactY, exactZ, exactW;
+                slerpQuaternionsAvx512<false>(ax, ay, az, aw, bx, by, bz, bw, cosHalfAngle, tt, exactX, exactY, exactZ, exactW);
+                x = Vector::select(flip, exactX, x);
+                y = Vector::select(flip, exactY, y);
+                z = Vector::select(flip, exactZ, z);
+                w = Vector::select(flip, exactW, w);
+            }
+        }
+
+        storeQuaternionsAvx512(dst + std::ptrdiff_t(i)*dstStride, dstStride, block, x, y, z, w);
+    }
+
+    interpolateQuaternionIntoScalar<interpolation>(a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, t + std::ptrdiff_t(i)*tStride, tStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(normalizeQuaternionInto)>::type normalizeQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return normalizeQuaternionIntoSse2;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(normalizeQuaternionInto)>::type normalizeQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return normalizeQuaternionIntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(normalizeQuaternionInto)>::type normalizeQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return normalizeQuaternionIntoAvx512;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(normalizeQuaternionInto)>::type normalizeQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return normalizeQuaternionIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(normalizeQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(normalizeQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(normalizeQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(normalizeQuaternionInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    normalizeQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(lerpQuaternionInto)>::type lerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return interpolateQuaternionIntoSse2<QuaternionInterpolation::Lerp>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(lerpQuaternionInto)>::type lerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return interpolateQuaternionIntoAvxFma<QuaternionInterpolation::Lerp>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(lerpQuaternionInto)>::type lerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return interpolateQuaternionIntoAvx512<QuaternionInterpolation::Lerp>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(lerpQuaternionInto)>::type lerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return interpolateQuaternionIntoScalar<QuaternionInterpolation::Lerp>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(lerpQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(lerpQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(lerpQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(lerpQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    lerpQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, t, tStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(lerpShortestPathQuaternionInto)>::type lerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return interpolateQuaternionIntoSse2<QuaternionInterpolation::LerpShortestPath>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(lerpShortestPathQuaternionInto)>::type lerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return interpolateQuaternionIntoAvxFma<QuaternionInterpolation::LerpShortestPath>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(lerpShortestPathQuaternionInto)>::type lerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return interpolateQuaternionIntoAvx512<QuaternionInterpolation::LerpShortestPath>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(lerpShortestPathQuaternionInto)>::type lerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return interpolateQuaternionIntoScalar<QuaternionInterpolation::LerpShortestPath>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(lerpShortestPathQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(lerpShortestPathQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(lerpShortestPathQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(lerpShortestPathQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    lerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, t, tStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(slerpQuaternionInto)>::type slerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return interpolateQuaternionIntoSse2<QuaternionInterpolation::Slerp>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(slerpQuaternionInto)>::type slerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return interpolateQuaternionIntoAvxFma<QuaternionInterpolation::Slerp>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(slerpQuaternionInto)>::type slerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return interpolateQuaternionIntoAvx512<QuaternionInterpolation::Slerp>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(slerpQuaternionInto)>::type slerpQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return interpolateQuaternionIntoScalar<QuaternionInterpolation::Slerp>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(slerpQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(slerpQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(slerpQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    slerpQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, t, tStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(slerpShortestPathQuaternionInto)>::type slerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return interpolateQuaternionIntoSse2<QuaternionInterpolation::SlerpShortestPath>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(slerpShortestPathQuaternionInto)>::type slerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return interpolateQuaternionIntoAvxFma<QuaternionInterpolation::SlerpShortestPath>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(slerpShortestPathQuaternionInto)>::type slerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return interpolateQuaternionIntoAvx512<QuaternionInterpolation::SlerpShortestPath>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(slerpShortestPathQuaternionInto)>::type slerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return interpolateQuaternionIntoScalar<QuaternionInterpolation::SlerpShortestPath>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(slerpShortestPathQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(slerpShortestPathQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(slerpShortestPathQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpShortestPathQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    slerpShortestPathQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, t, tStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(slerpApproximateQuaternionInto)>::type slerpApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return interpolateQuaternionIntoSse2<QuaternionInterpolation::SlerpApproximate>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(slerpApproximateQuaternionInto)>::type slerpApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return interpolateQuaternionIntoAvxFma<QuaternionInterpolation::SlerpApproximate>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(slerpApproximateQuaternionInto)>::type slerpApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return interpolateQuaternionIntoAvx512<QuaternionInterpolation::SlerpApproximate>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(slerpApproximateQuaternionInto)>::type slerpApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return interpolateQuaternionIntoScalar<QuaternionInterpolation::SlerpApproximate>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(slerpApproximateQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(slerpApproximateQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(slerpApproximateQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpApproximateQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    slerpApproximateQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, t, tStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(slerpShortestPathApproximateQuaternionInto)>::type slerpShortestPathApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return interpolateQuaternionIntoSse2<QuaternionInterpolation::SlerpShortestPathApproximate>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(slerpShortestPathApproximateQuaternionInto)>::type slerpShortestPathApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return interpolateQuaternionIntoAvxFma<QuaternionInterpolation::SlerpShortestPathApproximate>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(slerpShortestPathApproximateQuaternionInto)>::type slerpShortestPathApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return interpolateQuaternionIntoAvx512<QuaternionInterpolation::SlerpShortestPathApproximate>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(slerpShortestPathApproximateQuaternionInto)>::type slerpShortestPathApproximateQuaternionIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return interpolateQuaternionIntoScalar<QuaternionInterpolation::SlerpShortestPathApproximate>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(slerpShortestPathApproximateQuaternionIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(slerpShortestPathApproximateQuaternionIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(slerpShortestPathApproximateQuaternionIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(slerpShortestPathApproximateQuaternionInto)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    slerpShortestPathApproximateQuaternionIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, t, tStride, dst, dstStride, size);
+})
+
+}
+
+namespace {
+
+void interpolateInto(void(*const function)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, const char* t, std::ptrdiff_t tStride, char* dst, std::ptrdiff_t dstStride, std::size_t size), const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const char* const t, const std::ptrdiff_t tStride, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    function(static_cast<const char*>(normalizedA.data()), normalizedA.stride(), static_cast<const char*>(normalizedB.data()), normalizedB.stride(), t, tStride, static_cast<char*>(dst.data()), dst.stride(), normalizedA.size());
+}
+
+}
+
+void normalizeInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& src, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::normalizeInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    Implementation::normalizeQuaternionInto(static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+void normalizeInPlace(const Containers::StridedArrayView1D<Quaternion<Float>>& data) {
+    Implementation::normalizeQuaternionInto(static_cast<const char*>(data.data()), data.stride(), static_cast<char*>(data.data()), data.stride(), data.size());
+}
+
+void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == dst.size(),
+        "Math::lerpInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << t.size() << "and" << dst.size(), );
+    interpolateInto(Implementation::lerpQuaternionInto, normalizedA, normalizedB, static_cast<const char*>(t.data()), t.stride(), dst);
+}
+
+void lerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == dst.size(),
+        "Math::lerpInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << "and" << dst.size(), );
+    interpolateInto(Implementation::lerpQuaternionInto, normalizedA, normalizedB, reinterpret_cast<const char*>(&t), 0, dst);
+}
+
+void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == dst.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << t.size() << "and" << dst.size(), );
+    interpolateInto(Implementation::lerpShortestPathQuaternionInto, normalizedA, normalizedB, static_cast<const char*>(t.data()), t.stride(), dst);
+}
+
+void lerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == dst.size(),
+        "Math::lerpShortestPathInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << "and" << dst.size(), );
+    interpolateInto(Implementation::lerpShortestPathQuaternionInto, normalizedA, normalizedB, reinterpret_cast<const char*>(&t), 0, dst);
+}
+
+void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, const SlerpMode mode) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == dst.size(),
+        "Math::slerpInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << t.size() << "and" << dst.size(), );
+    interpolateInto(mode == SlerpMode::Approximate ? Implementation::slerpApproximateQuaternionInto : Implementation::slerpQuaternionInto, normalizedA, normalizedB, static_cast<const char*>(t.data()), t.stride(), dst);
+}
+
+void slerpInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, const SlerpMode mode) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == dst.size(),
+        "Math::slerpInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << "and" << dst.size(), );
+    interpolateInto(mode == SlerpMode::Approximate ? Implementation::slerpApproximateQuaternionInto : Implementation::slerpQuaternionInto, normalizedA, normalizedB, reinterpret_cast<const char*>(&t), 0, dst);
+}
+
+void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Containers::StridedArrayView1D<const Float>& t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, const SlerpMode mode) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == t.size() && normalizedA.size() == dst.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << t.size() << "and" << dst.size(), );
+    interpolateInto(mode == SlerpMode::Approximate ? Implementation::slerpShortestPathApproximateQuaternionInto : Implementation::slerpShortestPathQuaternionInto, normalizedA, normalizedB, static_cast<const char*>(t.data()), t.stride(), dst);
+}
+
+void slerpShortestPathInto(const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedA, const Containers::StridedArrayView1D<const Quaternion<Float>>& normalizedB, const Float t, const Containers::StridedArrayView1D<Quaternion<Float>>& dst, const SlerpMode mode) {
+    CORRADE_ASSERT(normalizedA.size() == normalizedB.size() && normalizedA.size() == dst.size(),
+        "Math::slerpShortestPathInto(): expected views of the same size but got" << normalizedA.size() << normalizedB.size() << "and" << dst.size(), );
+    interpolateInto(mode == SlerpMode::Approximate ? Implementation::slerpShortestPathApproximateQuaternionInto : Implementation::slerpShortestPathQuaternionInto, normalizedA, normalizedB, reinterpret_cast<const char*>(&t), 0, dst);
+}
+
+namespace Implementation {
+
+typedef void(*SrgbFunction)(const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t, std::size_t, bool);
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(fromSrgbFloatInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize, bool alpha);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(toSrgbFloatInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize, bool alpha);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(toSrgbUnsignedByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize, bool alpha);
+
+namespace {
+
+struct SrgbTable {
+    SrgbTable() {
+        for(std::size_t i = 0; i != 256; ++i)
+            data[i] = Color3<Float>::fromSrgb(Vector3<UnsignedByte>{UnsignedByte(i)}).r();
+    }
+
+    Float data[256];
+};
+
+const Float* srgbTable() {
+    static const SrgbTable table;
+    return table.data;
+}
+
+inline Float fromSrgbScalar(const Float srgb) {
+    return srgb > 0.04045f ? std::pow((srgb + 0.055f)/(1.0f + 0.055f), 2.4f) : srgb/12.92f;
+}
+
+inline Float toSrgbScalar(const Float rgb) {
+    return rgb > 0.0031308f ? (1.0f + 0.055f)*std::pow(rgb, 1.0f/2.4f) - 0.055f : rgb*12.92f;
+}
+
+inline Float toSrgbSaturatedScalar(const Float rgb) {
+    return toSrgbScalar(Math::min(Math::max(rgb, 0.0f), 1.0f));
+}
+
+inline void storeSrgbScalar(Float& out, const Float value) {
+    out = value;
+}
+
+inline void storeSrgbScalar(UnsignedByte& out, const Float value) {
+    out = packScalar<UnsignedByte>(Math::min(Math::max(value, 0.0f), 1.0f));
+}
+
+template<class T, Float(*convert)(Float)> void srgbIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize, const bool alpha) {
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        for(std::size_t j = 0; j != rowSize; ++j)
+            storeSrgbScalar(dstI[j], alpha && j % 4 == 3 ? srcI[j] : convert(srcI[j]));
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_ENABLE_SSE41 inline __m128 powSse41(const __m128 x, const __m128 exponent) {
+    const __m128i bits = _mm_castps_si128(x);
+    const __m128 mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f000000)));
+    const __m128 below = _mm_cmplt_ps(mantissa, _mm_set1_ps(0.707106781f));
+    const __m128 e = _mm_cvtepi32_ps(_mm_add_epi32(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(126)), _mm_castps_si128(below)));
+    const __m128 m = _mm_sub_ps(_mm_add_ps(mantissa, _mm_and_ps(mantissa, below)), _mm_set1_ps(1.0f));
+    const __m128 m2 = _mm_mul_ps(m, m);
+    __m128 p = _mm_set1_ps(7.0376836292e-2f);
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.1514610310e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.1676998740e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.2420140846e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(1.4249322787e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-1.6668057665e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(2.0000714765e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(-2.4999993993e-1f));
+    p = _mm_add_ps(_mm_mul_ps(p, m), _mm_set1_ps(3.3333331174e-1f));
+    p = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, m), m2), _mm_mul_ps(e, _mm_set1_ps(-2.12194440e-4f)));
+    p = _mm_sub_ps(p, _mm_mul_ps(m2, _mm_set1_ps(0.5f)));
+    const __m128 log = _mm_add_ps(_mm_add_ps(m, p), _mm_mul_ps(e, _mm_set1_ps(0.693359375f)));
+
+    const __m128 l = _mm_min_ps(_mm_max_ps(_mm_mul_ps(log, exponent), _mm_set1_ps(-87.3f)), _mm_set1_ps(88.0f));
+    const __m128 n = _mm_round_ps(_mm_mul_ps(l, _mm_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+    const __m128 r = _mm_sub_ps(_mm_sub_ps(l, _mm_mul_ps(n, _mm_set1_ps(0.693359375f))), _mm_mul_ps(n, _mm_set1_ps(-2.12194440e-4f)));
+    __m128 q = _mm_set1_ps(1.9875691500e-4f);
+    q = _mm_add_ps(_mm_mul_ps(q, r), _mm_set1_ps(1.3981999507e-3f));
+    q = _mm_add_ps(_mm_mul_ps(q, r), _mm_set1_ps(8.3334519073e-3f));
+    q = _mm_add_ps(_mm_mul_ps(q, r), _mm_set1_ps(4.1665795894e-2f));
+    q = _mm_add_ps(_mm_mul_ps(q, r), _mm_set1_ps(1.6666665459e-1f));
+    q = _mm_add_ps(_mm_mul_ps(q, r), _mm_set1_ps(5.0000001201e-1f));
+    q = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(q, r), r), r), _mm_set1_ps(1.0f));
+    return _mm_mul_ps(q, _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23)));
+}
+
+CORRADE_ENABLE_SSE41 inline __m128 fromSrgbSse41(const __m128 srgb) {
+    const __m128 curve = powSse41(_mm_div_ps(_mm_add_ps(srgb, _mm_set1_ps(0.055f)), _mm_set1_ps(1.0f + 0.055f)), _mm_set1_ps(2.4f));
+    return _mm_blendv_ps(_mm_div_ps(srgb, _mm_set1_ps(12.92f)), curve, _mm_cmpgt_ps(srgb, _mm_set1_ps(0.04045f)));
+}
+
+CORRADE_ENABLE_SSE41 inline __m128 toSrgbSse41(const __m128 rgb) {
+    const __m128 curve = _mm_sub_ps(_mm_mul_ps(_mm_set1_ps(1.0f + 0.055f), powSse41(rgb, _mm_set1_ps(1.0f/2.4f))), _mm_set1_ps(0.055f));
+    return _mm_blendv_ps(_mm_mul_ps(rgb, _mm_set1_ps(12.92f)), curve, _mm_cmpgt_ps(rgb, _mm_set1_ps(0.0031308f)));
+}
+
+CORRADE_ENABLE_SSE41 inline __m128 toSrgbSaturatedSse41(const __m128 rgb) {
+    return toSrgbSse41(_mm_min_ps(_mm_max_ps(rgb, _mm_setzero_ps()), _mm_set1_ps(1.0f)));
+}
+
+CORRADE_ENABLE_SSE41 inline void storeSrgbSse41(Float* const data, const __m128 value) {
+    _mm_storeu_ps(data, value);
+}
+
+CORRADE_ENABLE_SSE41 inline void storeSrgbSse41(UnsignedByte* const data, const __m128 value) {
+    narrowSse41(data, roundSse41(_mm_mul_ps(value, _mm_set1_ps(255.0f))));
+}
+
+template<class T, __m128(*convert)(__m128)> CORRADE_ENABLE_SSE41 void srgbIntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize, const bool alpha) {
+    const __m128 alphaMask = _mm_castsi128_ps(alpha ? _mm_set_epi32(-1, 0, 0, 0) : _mm_setzero_si128());
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        std::size_t j = 0;
+        for(; j + 4 <= rowSize; j += 4) {
+            const __m128 in = _mm_loadu_ps(srcI + j);
+            storeSrgbSse41(dstI + j, _mm_blendv_ps(convert(in), in, alphaMask));
+        }
+        if(j != rowSize) {
+            Float in[4]{};
+            T out[4];
+            std::memcpy(in, srcI + j, (rowSize - j)*sizeof(Float));
+            const __m128 tail = _mm_loadu_ps(in);
+            storeSrgbSse41(out, _mm_blendv_ps(convert(tail), tail, alphaMask));
+            std::memcpy(dstI + j, out, (rowSize - j)*sizeof(T));
+        }
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_AVX_FMA) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_ENABLE(AVX2,AVX_FMA) inline __m256 powAvx2Fma(const __m256 x, const __m256 exponent) {
+    const __m256i bits = _mm256_castps_si256(x);
+    const __m256 mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f000000)));
+    const __m256 below = _mm256_cmp_ps(mantissa, _mm256_set1_ps(0.707106781f), _CMP_LT_OQ);
+    const __m256 e = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)), _mm256_castps_si256(below)));
+    const __m256 m = _mm256_sub_ps(_mm256_add_ps(mantissa, _mm256_and_ps(mantissa, below)), _mm256_set1_ps(1.0f));
+    const __m256 m2 = _mm256_mul_ps(m, m);
+    __m256 p = _mm256_set1_ps(7.0376836292e-2f);
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.1514610310e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(1.1676998740e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.2420140846e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(1.4249322787e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-1.6668057665e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(2.0000714765e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(-2.4999993993e-1f));
+    p = _mm256_fmadd_ps(p, m, _mm256_set1_ps(3.3333331174e-1f));
+    p = _mm256_fmadd_ps(_mm256_mul_ps(p, m), m2, _mm256_mul_ps(e, _mm256_set1_ps(-2.12194440e-4f)));
+    p = _mm256_fnmadd_ps(m2, _mm256_set1_ps(0.5f), p);
+    const __m256 log = _mm256_fmadd_ps(e, _mm256_set1_ps(0.693359375f), _mm256_add_ps(m, p));
+
+    const __m256 l = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(log, exponent), _mm256_set1_ps(-87.3f)), _mm256_set1_ps(88.0f));
+    const __m256 n = _mm256_round_ps(_mm256_mul_ps(l, _mm256_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+    const __m256 r = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), l));
+    __m256 q = _mm256_set1_ps(1.9875691500e-4f);
+    q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(1.3981999507e-3f));
+    q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(8.3334519073e-3f));
+    q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(4.1665795894e-2f));
+    q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(1.6666665459e-1f));
+    q = _mm256_fmadd_ps(q, r, _mm256_set1_ps(5.0000001201e-1f));
+    q = _mm256_add_ps(_mm256_fmadd_ps(_mm256_mul_ps(q, r), r, r), _mm256_set1_ps(1.0f));
+    return _mm256_mul_ps(q, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23)));
+}
+
+CORRADE_ENABLE(AVX2,AVX_FMA) inline __m256 fromSrgbAvx2Fma(const __m256 srgb) {
+    const __m256 curve = powAvx2Fma(_mm256_div_ps(_mm256_add_ps(srgb, _mm256_set1_ps(0.055f)), _mm256_set1_ps(1.0f + 0.055f)), _mm256_set1_ps(2.4f));
+    return _mm256_blendv_ps(_mm256_div_ps(srgb, _mm256_set1_ps(12.92f)), curve, _mm256_cmp_ps(srgb, _mm256_set1_ps(0.04045f), _CMP_GT_OQ));
+}
+
+CORRADE_ENABLE(AVX2,AVX_FMA) inline __m256 toSrgbAvx2Fma(const __m256 rgb) {
+    const __m256 curve = _mm256_fmsub_ps(_mm256_set1_ps(1.0f + 0.055f), powAvx2Fma(rgb, _mm256_set1_ps(1.0f/2.4f)), _mm256_set1_ps(0.055f));
+    return _mm256_blendv_ps(_mm256_mul_ps(rgb, _mm256_set1_ps(12.92f)), curve, _mm256_cmp_ps(rgb, _mm256_set1_ps(0.0031308f), _CMP_GT_OQ));
+}
+
+CORRADE_ENABLE(AVX2,AVX_FMA) inline __m256 toSrgbSaturatedAvx2Fma(const __m256 rgb) {
+    return toSrgbAvx2Fma(_mm256_min_ps(_mm256_max_ps(rgb, _mm256_setzero_ps()), _mm256_set1_ps(1.0f)));
+}
+
+CORRADE_ENABLE(AVX2,AVX_FMA) inline void storeSrgbAvx2Fma(Float* const data, const __m256 value) {
+    _mm256_storeu_ps(data, value);
+}
+
+CORRADE_ENABLE(AVX2,AVX_FMA) inline void storeSrgbAvx2Fma(UnsignedByte* const data, const __m256 value) {
+    narrowAvx2(data, roundAvx2(_mm256_mul_ps(value, _mm256_set1_ps(255.0f))));
+}
+
+template<class T, __m256(*convert)(__m256)> CORRADE_ENABLE(AVX2,AVX_FMA) void srgbIntoAvx2Fma(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize, const bool alpha) {
+    const __m256 alphaMask = _mm256_castsi256_ps(alpha ? _mm256_set_epi32(-1, 0, 0, 0, -1, 0, 0, 0) : _mm256_setzero_si256());
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        std::size_t j = 0;
+        for(; j + 8 <= rowSize; j += 8) {
+            const __m256 in = _mm256_loadu_ps(srcI + j);
+            storeSrgbAvx2Fma(dstI + j, _mm256_blendv_ps(convert(in), in, alphaMask));
+        }
+        if(j != rowSize) {
+            Float in[8]{};
+            T out[8];
+            std::memcpy(in, srcI + j, (rowSize - j)*sizeof(Float));
+            const __m256 tail = _mm256_loadu_ps(in);
+            storeSrgbAvx2Fma(out, _mm256_blendv_ps(convert(tail), tail, alphaMask));
+            std::memcpy(dstI + j, out, (rowSize - j)*sizeof(T));
+        }
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+CORRADE_ENABLE_AVX512F inline __m512 powAvx512(const __m512 x, const __m512 exponent) {
+    const __m512i bits = _mm512_castps_si512(x);
+    const __m512 mantissa = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f000000)));
+    const __mmask16 below = _mm512_cmp_ps_mask(mantissa, _mm512_set1_ps(0.707106781f), _CMP_LT_OQ);
+    const __m512i exponentBits = _mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126));
+    const __m512 e = _mm512_cvtepi32_ps(_mm512_mask_sub_epi32(exponentBits, below, exponentBits, _mm512_set1_epi32(1)));
+    const __m512 m = _mm512_sub_ps(_mm512_mask_add_ps(mantissa, below, mantissa, mantissa), _mm512_set1_ps(1.0f));
+    const __m512 m2 = _mm512_mul_ps(m, m);
+    __m512 p = _mm512_set1_ps(7.0376836292e-2f);
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(-1.1514610310e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(1.1676998740e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(-1.2420140846e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(1.4249322787e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(-1.6668057665e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(2.0000714765e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(-2.4999993993e-1f));
+    p = _mm512_fmadd_ps(p, m, _mm512_set1_ps(3.3333331174e-1f));
+    p = _mm512_fmadd_ps(_mm512_mul_ps(p, m), m2, _mm512_mul_ps(e, _mm512_set1_ps(-2.12194440e-4f)));
+    p = _mm512_fnmadd_ps(m2, _mm512_set1_ps(0.5f), p);
+    const __m512 log = _mm512_fmadd_ps(e, _mm512_set1_ps(0.693359375f), _mm512_add_ps(m, p));
+
+    const __m512 l = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(log, exponent), _mm512_set1_ps(-87.3f)), _mm512_set1_ps(88.0f));
+    const __m512 n = _mm512_roundscale_ps(_mm512_mul_ps(l, _mm512_set1_ps(1.44269504088896341f)), _MM_FROUND_TO_NEAREST_INT|_MM_FROUND_NO_EXC);
+    const __m512 r = _mm512_fnmadd_ps(n, _mm512_set1_ps(-2.12194440e-4f), _mm512_fnmadd_ps(n, _mm512_set1_ps(0.693359375f), l));
+    __m512 q = _mm512_set1_ps(1.9875691500e-4f);
+    q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(1.3981999507e-3f));
+    q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(8.3334519073e-3f));
+    q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(4.1665795894e-2f));
+    q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(1.6666665459e-1f));
+    q = _mm512_fmadd_ps(q, r, _mm512_set1_ps(5.0000001201e-1f));
+    q = _mm512_add_ps(_mm512_fmadd_ps(_mm512_mul_ps(q, r), r, r), _mm512_set1_ps(1.0f));
+    return _mm512_scalef_ps(q, n);
+}
+
+CORRADE_ENABLE_AVX512F inline __m512 fromSrgbAvx512(const __m512 srgb) {
+    const __m512 curve = powAvx512(_mm512_div_ps(_mm512_add_ps(srgb, _mm512_set1_ps(0.055f)), _mm512_set1_ps(1.0f + 0.055f)), _mm512_set1_ps(2.4f));
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(srgb, _mm512_set1_ps(0.04045f), _CMP_GT_OQ), _mm512_div_ps(srgb, _mm512_set1_ps(12.92f)), curve);
+}
+
+CORRADE_ENABLE_AVX512F inline __m512 toSrgbAvx512(const __m512 rgb) {
+    const __m512 curve = _mm512_fmsub_ps(_mm512_set1_ps(1.0f + 0.055f), powAvx512(rgb, _mm512_set1_ps(1.0f/2.4f)), _mm512_set1_ps(0.055f));
+    return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(rgb, _mm512_set1_ps(0.0031308f), _CMP_GT_OQ), _mm512_mul_ps(rgb, _mm512_set1_ps(12.92f)), curve);
+}
+
+CORRADE_ENABLE_AVX512F inline __m512 toSrgbSaturatedAvx512(const __m512 rgb) {
+    return toSrgbAvx512(_mm512_min_ps(_mm512_max_ps(rgb, _mm512_setzero_ps()), _mm512_set1_ps(1.0f)));
+}
+
+CORRADE_ENABLE_AVX512F inline void storeSrgbAvx512(Float* const data, const __m512 value) {
+    _mm512_storeu_ps(data, value);
+}
+
+CORRADE_ENABLE_AVX512F inline void storeSrgbAvx512(UnsignedByte* const data, const __m512 value) {
+    narrowAvx512(data, roundAvx512(_mm512_mul_ps(value, _mm512_set1_ps(255.0f))));
+}
+
+template<class T, __m512(*convert)(__m512)> CORRADE_ENABLE_AVX512F void srgbIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t rowCount, const std::size_t rowSize, const bool alpha) {
+    const __mmask16 alphaMask = alpha ? 0x8888 : 0;
+    for(std::size_t i = 0; i != rowCount; ++i) {
+        const Float* srcI = reinterpret_cast<const Float*>(src);
+        T* dstI = reinterpret_cast<T*>(dst);
+        std::size_t j = 0;
+        for(; j + 16 <= rowSize; j += 16) {
+            const __m512 in = _mm512_loadu_ps(srcI + j);
+            storeSrgbAvx512(dstI + j, _mm512_mask_blend_ps(alphaMask, convert(in), in));
+        }
+        if(j != rowSize) {
+            Float in[16]{};
+            T out[16];
+            std::memcpy(in, srcI + j, (rowSize - j)*sizeof(Float));
+            const __m512 tail = _mm512_loadu_ps(in);
+            storeSrgbAvx512(out, _mm512_mask_blend_ps(alphaMask, convert(tail), tail));
+            std::memcpy(dstI + j, out, (rowSize - j)*sizeof(T));
+        }
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(fromSrgbFloatInto)>::type fromSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return srgbIntoSse41<Float, fromSrgbSse41>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_AVX_FMA) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX2,AVX_FMA) typename std::decay<decltype(fromSrgbFloatInto)>::type fromSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2|Cpu::AvxFma)) {
+    return srgbIntoAvx2Fma<Float, fromSrgbAvx2Fma>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(fromSrgbFloatInto)>::type fromSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return srgbIntoAvx512<Float, fromSrgbAvx512>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(fromSrgbFloatInto)>::type fromSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return srgbIntoScalar<Float, fromSrgbScalar>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(fromSrgbFloatIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(fromSrgbFloatIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(fromSrgbFloatIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(fromSrgbFloatInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize, bool alpha))({
+    fromSrgbFloatIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize, alpha);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(toSrgbFloatInto)>::type toSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return srgbIntoSse41<Float, toSrgbSse41>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_AVX_FMA) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX2,AVX_FMA) typename std::decay<decltype(toSrgbFloatInto)>::type toSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2|Cpu::AvxFma)) {
+    return srgbIntoAvx2Fma<Float, toSrgbAvx2Fma>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(toSrgbFloatInto)>::type toSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return srgbIntoAvx512<Float, toSrgbAvx512>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(toSrgbFloatInto)>::type toSrgbFloatIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return srgbIntoScalar<Float, toSrgbScalar>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(toSrgbFloatIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(toSrgbFloatIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(toSrgbFloatIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(toSrgbFloatInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize, bool alpha))({
+    toSrgbFloatIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize, alpha);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(toSrgbUnsignedByteInto)>::type toSrgbUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return srgbIntoSse41<UnsignedByte, toSrgbSaturatedSse41>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_AVX_FMA) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX2,AVX_FMA) typename std::decay<decltype(toSrgbUnsignedByteInto)>::type toSrgbUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2|Cpu::AvxFma)) {
+    return srgbIntoAvx2Fma<UnsignedByte, toSrgbSaturatedAvx2Fma>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(toSrgbUnsignedByteInto)>::type toSrgbUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return srgbIntoAvx512<UnsignedByte, toSrgbSaturatedAvx512>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(toSrgbUnsignedByteInto)>::type toSrgbUnsignedByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return srgbIntoScalar<UnsignedByte, toSrgbSaturatedScalar>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(toSrgbUnsignedByteIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(toSrgbUnsignedByteIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(toSrgbUnsignedByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(toSrgbUnsignedByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t rowCount, std::size_t rowSize, bool alpha))({
+    toSrgbUnsignedByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, rowCount, rowSize, alpha);
+})
+
+}
+
+namespace {
+
+template<class T> inline void srgbInto(const Implementation::SrgbFunction function, const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst) {
+    const bool alpha = src.size()[1] == 4;
+    if(src.isContiguous() && dst.isContiguous())
+        function(reinterpret_cast<const char*>(src.data()), 0, reinterpret_cast<char*>(dst.data()), 0, 1, src.size()[0]*src.size()[1], alpha);
+    else
+        function(reinterpret_cast<const char*>(src.data()), src.stride()[0], reinterpret_cast<char*>(dst.data()), dst.stride()[0], src.size()[0], src.size()[1], alpha);
+}
+
+template<class T> inline void toSrgbIntoImplementation(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<T>& dst, const Implementation::SrgbFunction function) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::toSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.size()[1] == 3 || src.size()[1] == 4,
+        "Math::toSrgbInto(): expected three or four channels but got" << src.size()[1], );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::toSrgbInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.template isContiguous<1>(),
+        "Math::toSrgbInto(): second destination view dimension is not contiguous", );
+
+    srgbInto(function, src, dst);
+}
+
+}
+
+void fromSrgbInto(const Containers::StridedArrayView2D<const UnsignedByte>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::fromSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.size()[1] == 3 || src.size()[1] == 4,
+        "Math::fromSrgbInto(): expected three or four channels but got" << src.size()[1], );
+
+    const Float* const table = Implementation::srgbTable();
+    const std::ptrdiff_t srcChannelStride = src.stride()[1];
+    const std::ptrdiff_t dstChannelStride = dst.stride()[1];
+    const char* srcI = static_cast<const char*>(src.data());
+    char* dstI = static_cast<char*>(dst.data());
+    for(std::size_t i = 0; i != src.size()[0]; ++i) {
+        *reinterpret_cast<Float*>(dstI) = table[UnsignedByte(srcI[0])];
+        *reinterpret_cast<Float*>(dstI + dstChannelStride) = table[UnsignedByte(srcI[srcChannelStride])];
+        *reinterpret_cast<Float*>(dstI + 2*dstChannelStride) = table[UnsignedByte(srcI[2*srcChannelStride])];
+        if(src.size()[1] == 4)
+            *reinterpret_cast<Float*>(dstI + 3*dstChannelStride) = Implementation::unpackScalar(UnsignedByte(srcI[3*srcChannelStride]));
+
+        srcI += src.stride()[0];
+        dstI += dst.stride()[0];
+    }
+}
+
+void fromSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::fromSrgbInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    CORRADE_ASSERT(src.size()[1] == 3 || src.size()[1] == 4,
+        "Math::fromSrgbInto(): expected three or four channels but got" << src.size()[1], );
+    CORRADE_ASSERT(src.isContiguous<1>(),
+        "Math::fromSrgbInto(): second source view dimension is not contiguous", );
+    CORRADE_ASSERT(dst.isContiguous<1>(),
+        "Math::fromSrgbInto(): second destination view dimension is not contiguous", );
+
+    srgbInto(Implementation::fromSrgbFloatInto, src, dst);
+}
+
+void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<UnsignedByte>& dst) {
+    toSrgbIntoImplementation(src, dst, Implementation::toSrgbUnsignedByteInto);
+}
+
+void toSrgbInto(const Containers::StridedArrayView2D<const Float>& src, const Containers::StridedArrayView2D<Float>& dst) {
+    toSrgbIntoImplementation(src, dst, Implementation::toSrgbFloatInto);
+}
+
+namespace Implementation {
+
+typedef void(*FrustumIntoFunction)(const Frustum<Float>&, const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, std::size_t, char*, std::size_t);
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(rangeFrustumInto)(const Frustum<Float>& frustum, const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(aabbFrustumInto)(const Frustum<Float>& frustum, const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, std::size_t size, char* dst, std::size_t dstOffset);
+
+namespace {
+
+template<bool range> void frustumIntoScalar(const Frustum<Float>& frustum, const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const std::size_t bit = dstOffset + i;
+        const Vector3<Float>& first = *reinterpret_cast<const Vector3<Float>*>(a + std::ptrdiff_t(i)*aStride);
+        const Vector3<Float>& second = *reinterpret_cast<const Vector3<Float>*>(b + std::ptrdiff_t(i)*bStride);
+        if(range ? Intersection::rangeFrustum(Range3D<Float>{first, second}, frustum) : Intersection::aabbFrustum(first, second, frustum))
+            dst[bit >> 3] |= char(1 << (bit & 0x07));
+        else
+            dst[bit >> 3] &= char(~(1 << (bit & 0x07)));
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<bool range> CORRADE_ENABLE_SSE2 void frustumIntoSse2(const Frustum<Float>& frustum, const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef SoaSse2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const UnsignedInt allLanes = (1u << lanes) - 1;
+    const bool aContiguous = aStride == std::ptrdiff_t(range ? sizeof(Range3D<Float>) : sizeof(Vector3<Float>));
+    const bool bContiguous = bStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    typename Vector::Type planeX[6], planeY[6], planeZ[6], absPlaneX[6], absPlaneY[6], absPlaneZ[6], planeW[6];
+    for(std::size_t p = 0; p != 6; ++p) {
+        planeX[p] = Vector::splat(frustum[p].x());
+        planeY[p] = Vector::splat(frustum[p].y());
+        planeZ[p] = Vector::splat(frustum[p].z());
+        absPlaneX[p] = Vector::splat(Math::abs(frustum[p].x()));
+        absPlaneY[p] = Vector::splat(Math::abs(frustum[p].y()));
+        absPlaneZ[p] = Vector::splat(Math::abs(frustum[p].z()));
+        planeW[p] = Vector::splat(range ? -2.0f*frustum[p].w() : -frustum[p].w());
+    }
+    Float blockA[lanes*6];
+    Float blockB[lanes*3];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            const Float* inA = reinterpret_cast<const Float*>(a + std::ptrdiff_t(i + k)*aStride);
+            const Float* inB = reinterpret_cast<const Float*>(b + std::ptrdiff_t(i + k)*bStride);
+            if(!aContiguous) {
+                for(std::size_t l = 0; l != lanes; ++l)
+                    std::memcpy(blockA + l*(range ? 6 : 3), a + std::ptrdiff_t(i + k + l)*aStride, range ? sizeof(Range3D<Float>) : sizeof(Vector3<Float>));
+                inA = blockA;
+            }
+            if(!range && !bContiguous) {
+                for(std::size_t l = 0; l != lanes; ++l)
+                    std::memcpy(blockB + l*3, b + std::ptrdiff_t(i + k + l)*bStride, sizeof(Vector3<Float>));
+                inB = blockB;
+            }
+
+            const std::size_t step = range ? 24 : 12;
+            const typename Vector::Type a0 = Vector::load(inA, step);
+            const typename Vector::Type a1 = Vector::load(inA + 4, step);
+            const typename Vector::Type a2 = Vector::load(inA + 8, step);
+            const typename Vector::Type b0 = Vector::load(range ? inA + 12 : inB, step);
+            const typename Vector::Type b1 = Vector::load(range ? inA + 16 : inB + 4, step);
+            const typename Vector::Type b2 = Vector::load(range ? inA + 20 : inB + 8, step);
+            const typename Vector::Type aX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+            const typename Vector::Type aY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+            const typename Vector::Type aZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+            const typename Vector::Type bX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(b0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b1, b2));
+            const typename Vector::Type bY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b1, b2));
+            const typename Vector::Type bZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(b2, b2));
+
+            typename Vector::Type centerX = aX, centerY = aY, centerZ = aZ, extentX = bX, extentY = bY, extentZ = bZ;
+            if(range) {
+                const typename Vector::Type minX = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aX, bX);
+                const typename Vector::Type minY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aY, bY);
+                const typename Vector::Type minZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aZ, bZ);
+                const typename Vector::Type maxX = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aX, bX);
+                const typename Vector::Type maxY = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aY, bY);
+                const typename Vector::Type maxZ = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aZ, bZ);
+                centerX = Vector::add(minX, maxX);
+                centerY = Vector::add(minY, maxY);
+                centerZ = Vector::add(minZ, maxZ);
+                extentX = Vector::sub(maxX, minX);
+                extentY = Vector::sub(maxY, minY);
+                extentZ = Vector::sub(maxZ, minZ);
+            }
+
+            UnsignedInt culled = 0;
+            for(std::size_t p = 0; p != 6 && culled != allLanes; ++p) {
+                const typename Vector::Type d = Vector::madd(centerZ, planeZ[p], Vector::madd(centerY, planeY[p], Vector::mul(centerX, planeX[p])));
+                const typename Vector::Type r = Vector::madd(extentZ, absPlaneZ[p], Vector::madd(extentY, absPlaneY[p], Vector::mul(extentX, absPlaneX[p])));
+                culled |= Vector::bitMask(Vector::lessThan(Vector::add(d, r), planeW[p]));
+            }
+            bits |= (~culled & allLanes) << k;
+        }
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    frustumIntoScalar<range>(frustum, a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, size - i, dst, dstOffset + i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+template<bool range> CORRADE_ENABLE(AVX,AVX_FMA) void frustumIntoAvxFma(const Frustum<Float>& frustum, const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef SoaAvxFma Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const UnsignedInt allLanes = (1u << lanes) - 1;
+    const bool aContiguous = aStride == std::ptrdiff_t(range ? sizeof(Range3D<Float>) : sizeof(Vector3<Float>));
+    const bool bContiguous = bStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    typename Vector::Type planeX[6], planeY[6], planeZ[6], absPlaneX[6], absPlaneY[6], absPlaneZ[6], planeW[6];
+    for(std::size_t p = 0; p != 6; ++p) {
+        planeX[p] = Vector::splat(frustum[p].x());
+        planeY[p] = Vector::splat(frustum[p].y());
+        planeZ[p] = Vector::splat(frustum[p].z());
+        absPlaneX[p] = Vector::splat(Math::abs(frustum[p].x()));
+        absPlaneY[p] = Vector::splat(Math::abs(frustum[p].y()));
+        absPlaneZ[p] = Vector::splat(Math::abs(frustum[p].z()));
+        planeW[p] = Vector::splat(range ? -2.0f*frustum[p].w() : -frustum[p].w());
+    }
+    Float blockA[lanes*6];
+    Float blockB[lanes*3];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            const Float* inA = reinterpret_cast<const Float*>(a + std::ptrdiff_t(i + k)*aStride);
+            const Float* inB = reinterpret_cast<const Float*>(b + std::ptrdiff_t(i + k)*bStride);
+            if(!aContiguous) {
+                for(std::size_t l = 0; l != lanes; ++l)
+                    std::memcpy(blockA + l*(range ? 6 : 3), a + std::ptrdiff_t(i + k + l)*aStride, range ? sizeof(Range3D<Float>) : sizeof(Vector3<Float>));
+                inA = blockA;
+            }
+            if(!range && !bContiguous) {
+                for(std::size_t l = 0; l != lanes; ++l)
+                    std::memcpy(blockB + l*3, b + std::ptrdiff_t(i + k + l)*bStride, sizeof(Vector3<Float>));
+                inB = blockB;
+            }
+
+            const std::size_t step = range ? 24 : 12;
+            const typename Vector::Type a0 = Vector::load(inA, step);
+            const typename Vector::Type a1 = Vector::load(inA + 4, step);
+            const typename Vector::Type a2 = Vector::load(inA + 8, step);
+            const typename Vector::Type b0 = Vector::load(range ? inA + 12 : inB, step);
+            const typename Vector::Type b1 = Vector::load(range ? inA + 16 : inB + 4, step);
+            const typename Vector::Type b2 = Vector::load(range ? inA + 20 : inB + 8, step);
+            const typename Vector::Type aX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+            const typename Vector::Type aY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+            const typename Vector::Type aZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+            const typename Vector::Type bX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(b0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b1, b2));
+            const typename Vector::Type bY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b1, b2));
+            const typename Vector::Type bZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(b2, b2));
+
+            typename Vector::Type centerX = aX, centerY = aY, centerZ = aZ, extentX = bX, extentY = bY, extentZ = bZ;
+            if(range) {
+                const typename Vector::Type minX = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aX, bX);
+                const typename Vector::Type minY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aY, bY);
+                const typename Vector::Type minZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aZ, bZ);
+                const typename Vector::Type maxX = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aX, bX);
+                const typename Vector::Type maxY = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aY, bY);
+                const typename Vector::Type maxZ = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aZ, bZ);
+                centerX = Vector::add(minX, maxX);
+                centerY = Vector::add(minY, maxY);
+                centerZ = Vector::add(minZ, maxZ);
+                extentX = Vector::sub(maxX, minX);
+                extentY = Vector::sub(maxY, minY);
+                extentZ = Vector::sub(maxZ, minZ);
+            }
+
+            UnsignedInt culled = 0;
+            for(std::size_t p = 0; p != 6 && culled != allLanes; ++p) {
+                const typename Vector::Type d = Vector::madd(centerZ, planeZ[p], Vector::madd(centerY, planeY[p], Vector::mul(centerX, planeX[p])));
+                const typename Vector::Type r = Vector::madd(extentZ, absPlaneZ[p], Vector::madd(extentY, absPlaneY[p], Vector::mul(extentX, absPlaneX[p])));
+                culled |= Vector::bitMask(Vector::lessThan(Vector::add(d, r), planeW[p]));
+            }
+            bits |= (~culled & allLanes) << k;
+        }
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    frustumIntoScalar<range>(frustum, a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, size - i, dst, dstOffset + i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+template<bool range> CORRADE_ENABLE_AVX512F void frustumIntoAvx512(const Frustum<Float>& frustum, const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef SoaAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const UnsignedInt allLanes = (1u << lanes) - 1;
+    const bool aContiguous = aStride == std::ptrdiff_t(range ? sizeof(Range3D<Float>) : sizeof(Vector3<Float>));
+    const bool bContiguous = bStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+    typename Vector::Type planeX[6], planeY[6], planeZ[6], absPlaneX[6], absPlaneY[6], absPlaneZ[6], planeW[6];
+    for(std::size_t p = 0; p != 6; ++p) {
+        planeX[p] = Vector::splat(frustum[p].x());
+        planeY[p] = Vector::splat(frustum[p].y());
+        planeZ[p] = Vector::splat(frustum[p].z());
+        absPlaneX[p] = Vector::splat(Math::abs(frustum[p].x()));
+        absPlaneY[p] = Vector::splat(Math::abs(frustum[p].y()));
+        absPlaneZ[p] = Vector::splat(Math::abs(frustum[p].z()));
+        planeW[p] = Vector::splat(range ? -2.0f*frustum[p].w() : -frustum[p].w());
+    }
+    Float blockA[lanes*6];
+    Float blockB[lanes*3];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            const Float* inA = reinterpret_cast<const Float*>(a + std::ptrdiff_t(i + k)*aStride);
+            const Float* inB = reinterpret_cast<const Float*>(b + std::ptrdiff_t(i + k)*bStride);
+            if(!aContiguous) {
+                for(std::size_t l = 0; l != lanes; ++l)
+                    std::memcpy(blockA + l*(range ? 6 : 3), a + std::ptrdiff_t(i + k + l)*aStride, range ? sizeof(Range3D<Float>) : sizeof(Vector3<Float>));
+                inA = blockA;
+            }
+            if(!range && !bContiguous) {
+                for(std::size_t l = 0; l != lanes; ++l)
+                    std::memcpy(blockB + l*3, b + std::ptrdiff_t(i + k + l)*bStride, sizeof(Vector3<Float>));
+                inB = blockB;
+            }
+
+            const std::size_t step = range ? 24 : 12;
+            const typename Vector::Type a0 = Vector::load(inA, step);
+            const typename Vector::Type a1 = Vector::load(inA + 4, step);
+            const typename Vector::Type a2 = Vector::load(inA + 8, step);
+            const typename Vector::Type b0 = Vector::load(range ? inA + 12 : inB, step);
+            const typename Vector::Type b1 = Vector::load(range ? inA + 16 : inB + 4, step);
+            const typename Vector::Type b2 = Vector::load(range ? inA + 20 : inB + 8, step);
+            const typename Vector::Type aX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+            const typename Vector::Type aY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+            const typename Vector::Type aZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+            const typename Vector::Type bX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(b0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b1, b2));
+            const typename Vector::Type bY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b1, b2));
+            const typename Vector::Type bZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(b2, b2));
+
+            typename Vector::Type centerX = aX, centerY = aY, centerZ = aZ, extentX = bX, extentY = bY, extentZ = bZ;
+            if(range) {
+                const typename Vector::Type minX = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aX, bX);
+                const typename Vector::Type minY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aY, bY);
+                const typename Vector::Type minZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aZ, bZ);
+                const typename Vector::Type maxX = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aX, bX);
+                const typename Vector::Type maxY = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aY, bY);
+                const typename Vector::Type maxZ = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aZ, bZ);
+                centerX = Vector::add(minX, maxX);
+                centerY = Vector::add(minY, maxY);
+                centerZ = Vector::add(minZ, maxZ);
+                extentX = Vector::sub(maxX, minX);
+                extentY = Vector::sub(maxY, minY);
+                extentZ = Vector::sub(maxZ, minZ);
+            }
+
+            UnsignedInt culled = 0;
+            for(std::size_t p = 0; p != 6 && culled != allLanes; ++p) {
+                const typename Vector::Type d = Vector::madd(centerZ, planeZ[p], Vector::madd(centerY, planeY[p], Vector::mul(centerX, planeX[p])));
+                const typename Vector::Type r = Vector::madd(extentZ, absPlaneZ[p], Vector::madd(extentY, absPlaneY[p], Vector::mul(extentX, absPlaneX[p])));
+                culled |= Vector::bitMask(Vector::lessThan(Vector::add(d, r), planeW[p]));
+            }
+            bits |= (~culled & allLanes) << k;
+        }
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    frustumIntoScalar<range>(frustum, a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, size - i, dst, dstOffset + i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(rangeFrustumInto)>::type rangeFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return frustumIntoSse2<true>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(rangeFrustumInto)>::type rangeFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return frustumIntoAvxFma<true>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(rangeFrustumInto)>::type rangeFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return frustumIntoAvx512<true>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(rangeFrustumInto)>::type rangeFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return frustumIntoScalar<true>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(rangeFrustumIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(rangeFrustumIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(rangeFrustumIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(rangeFrustumInto)(const Frustum<Float>& frustum, const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    rangeFrustumIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(frustum, a, aStride, b, bStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(aabbFrustumInto)>::type aabbFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return frustumIntoSse2<false>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(aabbFrustumInto)>::type aabbFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return frustumIntoAvxFma<false>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(aabbFrustumInto)>::type aabbFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return frustumIntoAvx512<false>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(aabbFrustumInto)>::type aabbFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return frustumIntoScalar<false>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(aabbFrustumIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(aabbFrustumIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(aabbFrustumIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(aabbFrustumInto)(const Frustum<Float>& frustum, const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    aabbFrustumIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(frustum, a, aStride, b, bStride, size, dst, dstOffset);
+})
+
+}
+
+namespace {
+
+void frustumInto(const Implementation::FrustumIntoFunction function, const Frustum<Float>& frustum, const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, const std::size_t size, const Containers::MutableStridedBitArrayView1D& dst) {
+    if(dst.isContiguous()) {
+        function(frustum, a, aStride, b, bStride, size, static_cast<char*>(dst.data()), dst.offset());
+        return;
+    }
+
+    char bits[64];
+    for(std::size_t i = 0; i < size; i += sizeof(bits)*8) {
+        const std::size_t chunkSize = Math::min(size - i, sizeof(bits)*8);
+        function(frustum, a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, chunkSize, bits, 0);
+        for(std::size_t j = 0; j != chunkSize; ++j)
+            dst.set(i + j, bits[j >> 3] & (1 << (j & 0x07)));
+    }
+}
+
+}
+
+namespace Intersection {
+
+void rangeFrustumInto(const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Frustum<Float>& frustum, const Containers::MutableStridedBitArrayView1D& dst) {
+    CORRADE_ASSERT(ranges.size() == dst.size()[0],
+        "Math::Intersection::rangeFrustumInto(): wrong destination size, got" << dst.size()[0] << "but expected" << ranges.size(), );
+    const char* data = static_cast<const char*>(ranges.data());
+    frustumInto(Implementation::rangeFrustumInto, frustum, data, ranges.stride(), data + sizeof(Vector3<Float>), ranges.stride(), ranges.size(), dst);
+}
+
+void aabbFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& aabbCenters, const Containers::StridedArrayView1D<const Vector3<Float>>& aabbExtents, const Frustum<Float>& frustum, const Containers::MutableStridedBitArrayView1D& dst) {
+    CORRADE_ASSERT(aabbCenters.size() == aabbExtents.size(),
+        "Math::Intersection::aabbFrustumInto(): expected center and extent views to have the same size but got" << aabbCenters.size() << "and" << aabbExtents.size(), );
+    CORRADE_ASSERT(aabbCenters.size() == dst.size()[0],
+        "Math::Intersection::aabbFrustumInto(): wrong destination size, got" << dst.size()[0] << "but expected" << aabbCenters.size(), );
+    frustumInto(Implementation::aabbFrustumInto, frustum, static_cast<const char*>(aabbCenters.data()), aabbCenters.stride(), static_cast<const char*>(aabbExtents.data()), aabbExtents.stride(), aabbCenters.size(), dst);
+}
+
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(multiplyMatrix4Into)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(multiplyMatrix4HierarchyInto)(const char* transformations, std::ptrdiff_t transformationStride, const char* parents, std::ptrdiff_t parentStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(invertedRigidMatrix4Into)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+
+namespace {
+
+inline Matrix4<Float> invertedRigidUnchecked(const Matrix4<Float>& matrix) {
+    const Matrix3x3<Float> inverseRotation = matrix.rotationScaling().transposed();
+    return Matrix4<Float>::from(inverseRotation, inverseRotation*-matrix.translation());
+}
+
+void multiplyMatrix4IntoScalar(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        *reinterpret_cast<Matrix4<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = *reinterpret_cast<const Matrix4<Float>*>(a + std::ptrdiff_t(i)*aStride)**reinterpret_cast<const Matrix4<Float>*>(b + std::ptrdiff_t(i)*bStride);
+}
+
+inline void multiplyMatrix4HierarchyNode(const char* transformations, const std::ptrdiff_t transformationStride, const char* parents, const std::ptrdiff_t parentStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t i) {
+    const Int parent = *reinterpret_cast<const Int*>(parents + std::ptrdiff_t(i)*parentStride);
+    const Matrix4<Float>& transformation = *reinterpret_cast<const Matrix4<Float>*>(transformations + std::ptrdiff_t(i)*transformationStride);
+    *reinterpret_cast<Matrix4<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = parent < 0 ? transformation : *reinterpret_cast<const Matrix4<Float>*>(dst + std::ptrdiff_t(parent)*dstStride)*transformation;
+}
+
+void multiplyMatrix4HierarchyIntoScalar(const char* transformations, const std::ptrdiff_t transformationStride, const char* parents, const std::ptrdiff_t parentStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+}
+
+void invertedRigidMatrix4IntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i)
+        *reinterpret_cast<Matrix4<Float>*>(dst + std::ptrdiff_t(i)*dstStride) = invertedRigidUnchecked(*reinterpret_cast<const Matrix4<Float>*>(src + std::ptrdiff_t(i)*srcStride));
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 inline void loadMatricesSse2(const char* const data, const std::ptrdiff_t stride, const std::size_t count, Float* const block, typename SoaSse2::Type(&columns)[4]) {
+    typedef SoaSse2 Vector;
+    const Float* matrices = reinterpret_cast<const Float*>(data);
+    if(stride != std::ptrdiff_t(sizeof(Matrix4<Float>))) {
+        for(std::size_t k = 0; k != count; ++k)
+            std::memcpy(block + k*16, data + std::ptrdiff_t(k)*stride, sizeof(Matrix4<Float>));
+        matrices = block;
+    }
+    for(std::size_t c = 0; c != 4; ++c)
+        columns[c] = Vector::load(matrices + c*4, 16);
+}
+
+CORRADE_ENABLE_SSE2 inline void storeMatricesSse2(char* const data, const std::ptrdiff_t stride, const std::size_t count, Float* const block, const typename SoaSse2::Type(&columns)[4]) {
+    typedef SoaSse2 Vector;
+    const bool contiguous = stride == std::ptrdiff_t(sizeof(Matrix4<Float>));
+    Float* const matrices = contiguous ? reinterpret_cast<Float*>(data) : block;
+    for(std::size_t c = 0; c != 4; ++c)
+        Vector::store(matrices + c*4, 16, columns[c]);
+    if(!contiguous) for(std::size_t k = 0; k != count; ++k)
+        std::memcpy(data + std::ptrdiff_t(k)*stride, block + k*16, sizeof(Matrix4<Float>));
+}
+
+CORRADE_ENABLE_SSE2 inline void multiplyMatricesSse2(const typename SoaSse2::Type(&a)[4], const typename SoaSse2::Type(&b)[4], typename SoaSse2::Type(&out)[4]) {
+    typedef SoaSse2 Vector;
+    for(std::size_t c = 0; c != 4; ++c)
+        out[c] = Vector::madd(a[3], Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(b[c], b[c]),
+                 Vector::madd(a[2], Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(b[c], b[c]),
+                 Vector::madd(a[1], Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(b[c], b[c]),
+                 Vector::mul(a[0], Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(b[c], b[c])))));
+}
+
+CORRADE_ENABLE_SSE2 void multiplyMatrix4IntoSse2(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type ca[4], cb[4], out[4];
+        loadMatricesSse2(a + std::ptrdiff_t(i)*aStride, aStride, count, block, ca);
+        loadMatricesSse2(b + std::ptrdiff_t(i)*bStride, bStride, count, block, cb);
+        multiplyMatricesSse2(ca, cb, out);
+        storeMatricesSse2(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+    }
+
+    multiplyMatrix4IntoScalar(a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_SSE2 void multiplyMatrix4HierarchyIntoSse2(const char* transformations, const std::ptrdiff_t transformationStride, const char* parents, const std::ptrdiff_t parentStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    while(i + count <= size) {
+        Int groupParents[count];
+        bool independent = true;
+        for(std::size_t k = 0; k != count; ++k) {
+            groupParents[k] = *reinterpret_cast<const Int*>(parents + std::ptrdiff_t(i + k)*parentStride);
+            if(groupParents[k] >= Int(i)) independent = false;
+        }
+        if(!independent) {
+            multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+            ++i;
+            continue;
+        }
+
+        for(std::size_t k = 0; k != count; ++k) {
+            if(groupParents[k] < 0) *reinterpret_cast<Matrix4<Float>*>(block + k*16) = Matrix4<Float>{Math::IdentityInit};
+            else std::memcpy(block + k*16, dst + std::ptrdiff_t(groupParents[k])*dstStride, sizeof(Matrix4<Float>));
+        }
+        typename Vector::Type ca[4], cb[4], out[4];
+        for(std::size_t c = 0; c != 4; ++c)
+            ca[c] = Vector::load(block + c*4, 16);
+        loadMatricesSse2(transformations + std::ptrdiff_t(i)*transformationStride, transformationStride, count, block, cb);
+        multiplyMatricesSse2(ca, cb, out);
+        storeMatricesSse2(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+        i += count;
+    }
+
+    for(; i != size; ++i)
+        multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+}
+
+CORRADE_ENABLE_SSE2 void invertedRigidMatrix4IntoSse2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaSse2 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const Float lastColumn[]{0.0f, 0.0f, 0.0f, 1.0f};
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type w = Vector::load(lastColumn, 0);
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type in[4], out[4];
+        loadMatricesSse2(src + std::ptrdiff_t(i)*srcStride, srcStride, count, block, in);
+        const typename Vector::Type t0 = Vector::unpackLo(in[0], in[1]);
+        const typename Vector::Type t1 = Vector::unpackHi(in[0], in[1]);
+        const typename Vector::Type t2 = Vector::unpackLo(in[2], zero);
+        const typename Vector::Type t3 = Vector::unpackHi(in[2], zero);
+        out[0] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t2);
+        out[1] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t2);
+        out[2] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t1, t3);
+        out[3] = Vector::sub(w,
+            Vector::madd(out[2], Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(in[3], in[3]),
+            Vector::madd(out[1], Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(in[3], in[3]),
+            Vector::mul(out[0], Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(in[3], in[3])))));
+        storeMatricesSse2(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+    }
+
+    invertedRigidMatrix4IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_ENABLE(AVX,AVX_FMA) inline void loadMatricesAvxFma(const char* const data, const std::ptrdiff_t stride, const std::size_t count, Float* const block, typename SoaAvxFma::Type(&columns)[4]) {
+    typedef SoaAvxFma Vector;
+    const Float* matrices = reinterpret_cast<const Float*>(data);
+    if(stride != std::ptrdiff_t(sizeof(Matrix4<Float>))) {
+        for(std::size_t k = 0; k != count; ++k)
+            std::memcpy(block + k*16, data + std::ptrdiff_t(k)*stride, sizeof(Matrix4<Float>));
+        matrices = block;
+    }
+    for(std::size_t c = 0; c != 4; ++c)
+        columns[c] = Vector::load(matrices + c*4, 16);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline void storeMatricesAvxFma(char* const data, const std::ptrdiff_t stride, const std::size_t count, Float* const block, const typename SoaAvxFma::Type(&columns)[4]) {
+    typedef SoaAvxFma Vector;
+    const bool contiguous = stride == std::ptrdiff_t(sizeof(Matrix4<Float>));
+    Float* const matrices = contiguous ? reinterpret_cast<Float*>(data) : block;
+    for(std::size_t c = 0; c != 4; ++c)
+        Vector::store(matrices + c*4, 16, columns[c]);
+    if(!contiguous) for(std::size_t k = 0; k != count; ++k)
+        std::memcpy(data + std::ptrdiff_t(k)*stride, block + k*16, sizeof(Matrix4<Float>));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline void multiplyMatricesAvxFma(const typename SoaAvxFma::Type(&a)[4], const typename SoaAvxFma::Type(&b)[4], typename SoaAvxFma::Type(&out)[4]) {
+    typedef SoaAvxFma Vector;
+    for(std::size_t c = 0; c != 4; ++c)
+        out[c] = Vector::madd(a[3], Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(b[c], b[c]),
+                 Vector::madd(a[2], Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(b[c], b[c]),
+                 Vector::madd(a[1], Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(b[c], b[c]),
+                 Vector::mul(a[0], Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(b[c], b[c])))));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void multiplyMatrix4IntoAvxFma(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    const std::size_t count = Vector::Lanes/4;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type ca[4], cb[4], out[4];
+        loadMatricesAvxFma(a + std::ptrdiff_t(i)*aStride, aStride, count, block, ca);
+        loadMatricesAvxFma(b + std::ptrdiff_t(i)*bStride, bStride, count, block, cb);
+        multiplyMatricesAvxFma(ca, cb, out);
+        storeMatricesAvxFma(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+    }
+
+    multiplyMatrix4IntoScalar(a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void multiplyMatrix4HierarchyIntoAvxFma(const char* transformations, const std::ptrdiff_t transformationStride, const char* parents, const std::ptrdiff_t parentStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    const std::size_t count = Vector::Lanes/4;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    while(i + count <= size) {
+        Int groupParents[count];
+        bool independent = true;
+        for(std::size_t k = 0; k != count; ++k) {
+            groupParents[k] = *reinterpret_cast<const Int*>(parents + std::ptrdiff_t(i + k)*parentStride);
+            if(groupParents[k] >= Int(i)) independent = false;
+        }
+        if(!independent) {
+            multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+            ++i;
+            continue;
+        }
+
+        for(std::size_t k = 0; k != count; ++k) {
+            if(groupParents[k] < 0) *reinterpret_cast<Matrix4<Float>*>(block + k*16) = Matrix4<Float>{Math::IdentityInit};
+            else std::memcpy(block + k*16, dst + std::ptrdiff_t(groupParents[k])*dstStride, sizeof(Matrix4<Float>));
+        }
+        typename Vector::Type ca[4], cb[4], out[4];
+        for(std::size_t c = 0; c != 4; ++c)
+            ca[c] = Vector::load(block + c*4, 16);
+        loadMatricesAvxFma(transformations + std::ptrdiff_t(i)*transformationStride, transformationStride, count, block, cb);
+        multiplyMatricesAvxFma(ca, cb, out);
+        storeMatricesAvxFma(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+        i += count;
+    }
+
+    for(; i != size; ++i)
+        multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void invertedRigidMatrix4IntoAvxFma(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvxFma Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const Float lastColumn[]{0.0f, 0.0f, 0.0f, 1.0f};
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type w = Vector::load(lastColumn, 0);
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type in[4], out[4];
+        loadMatricesAvxFma(src + std::ptrdiff_t(i)*srcStride, srcStride, count, block, in);
+        const typename Vector::Type t0 = Vector::unpackLo(in[0], in[1]);
+        const typename Vector::Type t1 = Vector::unpackHi(in[0], in[1]);
+        const typename Vector::Type t2 = Vector::unpackLo(in[2], zero);
+        const typename Vector::Type t3 = Vector::unpackHi(in[2], zero);
+        out[0] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t2);
+        out[1] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t2);
+        out[2] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t1, t3);
+        out[3] = Vector::sub(w,
+            Vector::madd(out[2], Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(in[3], in[3]),
+            Vector::madd(out[1], Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(in[3], in[3]),
+            Vector::mul(out[0], Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(in[3], in[3])))));
+        storeMatricesAvxFma(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+    }
+
+    invertedRigidMatrix4IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+CORRADE_ENABLE_AVX512F inline void loadMatricesAvx512(const char* const data, const std::ptrdiff_t stride, const std::size_t count, Float* const block, typename SoaAvx512::Type(&columns)[4]) {
+    typedef SoaAvx512 Vector;
+    const Float* matrices = reinterpret_cast<const Float*>(data);
+    if(stride != std::ptrdiff_t(sizeof(Matrix4<Float>))) {
+        for(std::size_t k = 0; k != count; ++k)
+            std::memcpy(block + k*16, data + std::ptrdiff_t(k)*stride, sizeof(Matrix4<Float>));
+        matrices = block;
+    }
+    for(std::size_t c = 0; c != 4; ++c)
+        columns[c] = Vector::load(matrices + c*4, 16);
+}
+
+CORRADE_ENABLE_AVX512F inline void storeMatricesAvx512(char* const data, const std::ptrdiff_t stride, const std::size_t count, Float* const block, const typename SoaAvx512::Type(&columns)[4]) {
+    typedef SoaAvx512 Vector;
+    const bool contiguous = stride == std::ptrdiff_t(sizeof(Matrix4<Float>));
+    Float* const matrices = contiguous ? reinterpret_cast<Float*>(data) : block;
+    for(std::size_t c = 0; c != 4; ++c)
+        Vector::store(matrices + c*4, 16, columns[c]);
+    if(!contiguous) for(std::size_t k = 0; k != count; ++k)
+        std::memcpy(data + std::ptrdiff_t(k)*stride, block + k*16, sizeof(Matrix4<Float>));
+}
+
+CORRADE_ENABLE_AVX512F inline void multiplyMatricesAvx512(const typename SoaAvx512::Type(&a)[4], const typename SoaAvx512::Type(&b)[4], typename SoaAvx512::Type(&out)[4]) {
+    typedef SoaAvx512 Vector;
+    for(std::size_t c = 0; c != 4; ++c)
+        out[c] = Vector::madd(a[3], Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(b[c], b[c]),
+                 Vector::madd(a[2], Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(b[c], b[c]),
+                 Vector::madd(a[1], Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(b[c], b[c]),
+                 Vector::mul(a[0], Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(b[c], b[c])))));
+}
+
+CORRADE_ENABLE_AVX512F void multiplyMatrix4IntoAvx512(const char* a, const std::ptrdiff_t aStride, const char* b, const std::ptrdiff_t bStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type ca[4], cb[4], out[4];
+        loadMatricesAvx512(a + std::ptrdiff_t(i)*aStride, aStride, count, block, ca);
+        loadMatricesAvx512(b + std::ptrdiff_t(i)*bStride, bStride, count, block, cb);
+        multiplyMatricesAvx512(ca, cb, out);
+        storeMatricesAvx512(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+    }
+
+    multiplyMatrix4IntoScalar(a + std::ptrdiff_t(i)*aStride, aStride, b + std::ptrdiff_t(i)*bStride, bStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_AVX512F void multiplyMatrix4HierarchyIntoAvx512(const char* transformations, const std::ptrdiff_t transformationStride, const char* parents, const std::ptrdiff_t parentStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    while(i + count <= size) {
+        Int groupParents[count];
+        bool independent = true;
+        for(std::size_t k = 0; k != count; ++k) {
+            groupParents[k] = *reinterpret_cast<const Int*>(parents + std::ptrdiff_t(i + k)*parentStride);
+            if(groupParents[k] >= Int(i)) independent = false;
+        }
+        if(!independent) {
+            multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+            ++i;
+            continue;
+        }
+
+        for(std::size_t k = 0; k != count; ++k) {
+            if(groupParents[k] < 0) *reinterpret_cast<Matrix4<Float>*>(block + k*16) = Matrix4<Float>{Math::IdentityInit};
+            else std::memcpy(block + k*16, dst + std::ptrdiff_t(groupParents[k])*dstStride, sizeof(Matrix4<Float>));
+        }
+        typename Vector::Type ca[4], cb[4], out[4];
+        for(std::size_t c = 0; c != 4; ++c)
+            ca[c] = Vector::load(block + c*4, 16);
+        loadMatricesAvx512(transformations + std::ptrdiff_t(i)*transformationStride, transformationStride, count, block, cb);
+        multiplyMatricesAvx512(ca, cb, out);
+        storeMatricesAvx512(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+        i += count;
+    }
+
+    for(; i != size; ++i)
+        multiplyMatrix4HierarchyNode(transformations, transformationStride, parents, parentStride, dst, dstStride, i);
+}
+
+CORRADE_ENABLE_AVX512F void invertedRigidMatrix4IntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaAvx512 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const Float lastColumn[]{0.0f, 0.0f, 0.0f, 1.0f};
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type w = Vector::load(lastColumn, 0);
+    Float block[Vector::Lanes*4];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type in[4], out[4];
+        loadMatricesAvx512(src + std::ptrdiff_t(i)*srcStride, srcStride, count, block, in);
+        const typename Vector::Type t0 = Vector::unpackLo(in[0], in[1]);
+        const typename Vector::Type t1 = Vector::unpackHi(in[0], in[1]);
+        const typename Vector::Type t2 = Vector::unpackLo(in[2], zero);
+        const typename Vector::Type t3 = Vector::unpackHi(in[2], zero);
+        out[0] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t2);
+        out[1] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t2);
+        out[2] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t1, t3);
+        out[3] = Vector::sub(w,
+            Vector::madd(out[2], Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(in[3], in[3]),
+            Vector::madd(out[1], Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(in[3], in[3]),
+            Vector::mul(out[0], Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(in[3], in[3])))));
+        storeMatricesAvx512(dst + std::ptrdiff_t(i)*dstStride, dstStride, count, block, out);
+    }
+
+    invertedRigidMatrix4IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(multiplyMatrix4Into)>::type multiplyMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return multiplyMatrix4IntoAvx512;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(multiplyMatrix4Into)>::type multiplyMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return multiplyMatrix4IntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(multiplyMatrix4Into)>::type multiplyMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return multiplyMatrix4IntoSse2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(multiplyMatrix4Into)>::type multiplyMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return multiplyMatrix4IntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(multiplyMatrix4IntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(multiplyMatrix4IntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(multiplyMatrix4IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(multiplyMatrix4Into)(const char* a, std::ptrdiff_t aStride, const char* b, std::ptrdiff_t bStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    multiplyMatrix4IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(a, aStride, b, bStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(multiplyMatrix4HierarchyInto)>::type multiplyMatrix4HierarchyIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return multiplyMatrix4HierarchyIntoAvx512;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(multiplyMatrix4HierarchyInto)>::type multiplyMatrix4HierarchyIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return multiplyMatrix4HierarchyIntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(multiplyMatrix4HierarchyInto)>::type multiplyMatrix4HierarchyIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return multiplyMatrix4HierarchyIntoSse2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(multiplyMatrix4HierarchyInto)>::type multiplyMatrix4HierarchyIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return multiplyMatrix4HierarchyIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(multiplyMatrix4HierarchyIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(multiplyMatrix4HierarchyIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(multiplyMatrix4HierarchyIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(multiplyMatrix4HierarchyInto)(const char* transformations, std::ptrdiff_t transformationStride, const char* parents, std::ptrdiff_t parentStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    multiplyMatrix4HierarchyIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(transformations, transformationStride, parents, parentStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(invertedRigidMatrix4Into)>::type invertedRigidMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return invertedRigidMatrix4IntoAvx512;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(invertedRigidMatrix4Into)>::type invertedRigidMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return invertedRigidMatrix4IntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(invertedRigidMatrix4Into)>::type invertedRigidMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return invertedRigidMatrix4IntoSse2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(invertedRigidMatrix4Into)>::type invertedRigidMatrix4IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return invertedRigidMatrix4IntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(invertedRigidMatrix4IntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(invertedRigidMatrix4IntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(invertedRigidMatrix4IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(invertedRigidMatrix4Into)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    invertedRigidMatrix4IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+}
+
+void multiplyInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& a, const Containers::StridedArrayView1D<const Matrix4<Float>>& b, const Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    CORRADE_ASSERT(a.size() == b.size(),
+        "Math::multiplyInto(): expected views of the same size, got" << a.size() << "and" << b.size(), );
+    CORRADE_ASSERT(a.size() == dst.size(),
+        "Math::multiplyInto(): wrong destination size, got" << dst.size() << "but expected" << a.size(), );
+    Implementation::multiplyMatrix4Into(static_cast<const char*>(a.data()), a.stride(), static_cast<const char*>(b.data()), b.stride(), static_cast<char*>(dst.data()), dst.stride(), a.size());
+}
+
+void multiplyHierarchyInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& transformations, const Containers::StridedArrayView1D<const Int>& parents, const Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    CORRADE_ASSERT(transformations.size() == parents.size(),
+        "Math::multiplyHierarchyInto(): expected parent and transformation views of the same size, got" << parents.size() << "and" << transformations.size(), );
+    CORRADE_ASSERT(transformations.size() == dst.size(),
+        "Math::multiplyHierarchyInto(): wrong destination size, got" << dst.size() << "but expected" << transformations.size(), );
+    for(std::size_t i = 0; i != parents.size(); ++i) {
+        CORRADE_ASSERT(parents[i] < Int(i),
+            "Math::multiplyHierarchyInto(): expected parent of node" << i << "to be either negative or less than" << i << "but got" << parents[i], );
+    }
+    Implementation::multiplyMatrix4HierarchyInto(static_cast<const char*>(transformations.data()), transformations.stride(), static_cast<const char*>(parents.data()), parents.stride(), static_cast<char*>(dst.data()), dst.stride(), transformations.size());
+}
+
+void invertedRigidInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& src, const Containers::StridedArrayView1D<Matrix4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::invertedRigidInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    Implementation::invertedRigidMatrix4Into(static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(skinLinearBlendInto)(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(skinDualQuaternionBlendInto)(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals);
+
+namespace {
+
+inline void skinLinearBlendVertex(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals, const std::size_t i) {
+    const Containers::StridedArrayView1D<const UnsignedInt> ids = jointIds[i];
+    const Containers::StridedArrayView1D<const Float> vertexWeights = weights[i];
+    Matrix4<Float> matrix{Math::ZeroInit};
+    for(std::size_t k = 0; k != ids.size(); ++k)
+        matrix += joints[ids[k]]*vertexWeights[k];
+    const Vector3<Float>& position = positions[i];
+    dstPositions[i] = (matrix[3] + matrix[0]*position.x() + matrix[1]*position.y() + matrix[2]*position.z()).xyz();
+    if(!normals.isEmpty())
+        dstNormals[i] = (matrix.rotationScaling()*normals[i]).normalized();
+}
+
+inline void skinDualQuaternionBlendVertex(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals, const std::size_t i) {
+    const Containers::StridedArrayView1D<const UnsignedInt> ids = jointIds[i];
+    const Containers::StridedArrayView1D<const Float> vertexWeights = weights[i];
+    const Quaternion<Float>& pivot = joints[ids[0]].real();
+    Quaternion<Float> real{Math::ZeroInit};
+    Quaternion<Float> dual{Math::ZeroInit};
+    for(std::size_t k = 0; k != ids.size(); ++k) {
+        const DualQuaternion<Float>& joint = joints[ids[k]];
+        const Float weight = Math::dot(pivot, joint.real()) < 0.0f ? -vertexWeights[k] : vertexWeights[k];
+        real += joint.real()*weight;
+        dual += joint.dual()*weight;
+    }
+    const Float length = real.length();
+    real /= length;
+    dual /= length;
+
+    const Vector3<Float> translation = 2.0f*(real.scalar()*dual.vector() - dual.scalar()*real.vector() + Math::cross(real.vector(), dual.vector()));
+    const Vector3<Float>& position = positions[i];
+    dstPositions[i] = position + 2.0f*Math::cross(real.vector(), Math::cross(real.vector(), position) + real.scalar()*position) + translation;
+    if(!normals.isEmpty()) {
+        const Vector3<Float>& normal = normals[i];
+        dstNormals[i] = normal + 2.0f*Math::cross(real.vector(), Math::cross(real.vector(), normal) + real.scalar()*normal);
+    }
+}
+
+void skinLinearBlendIntoScalar(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        skinLinearBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+
+void skinDualQuaternionBlendIntoScalar(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        skinDualQuaternionBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type dot3Sse2(const typename SoaSse2::Type a, const typename SoaSse2::Type b) {
+    typedef SoaSse2 Vector;
+    const typename Vector::Type ab = Vector::mul(a, b);
+    return Vector::add(ab, Vector::add(Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(ab, ab), Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(ab, ab)));
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type dot4Sse2(const typename SoaSse2::Type a, const typename SoaSse2::Type b) {
+    typedef SoaSse2 Vector;
+    const typename Vector::Type ab = Vector::mul(a, b);
+    const typename Vector::Type pairs = Vector::add(ab, Vector::template shuffle<_MM_SHUFFLE(2, 3, 0, 1)>(ab, ab));
+    return Vector::add(pairs, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(pairs, pairs));
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type crossSse2(const typename SoaSse2::Type a, const typename SoaSse2::Type b) {
+    typedef SoaSse2 Vector;
+    return Vector::sub(
+        Vector::mul(Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(a, a), Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(b, b)),
+        Vector::mul(Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(a, a), Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(b, b)));
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type loadVectorsSse2(const Containers::StridedArrayView1D<const Vector3<Float>>& vectors, const std::size_t offset, Float* const block) {
+    typedef SoaSse2 Vector;
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g) {
+        const Vector3<Float>& vector = vectors[offset + g];
+        block[g*4 + 0] = vector.x();
+        block[g*4 + 1] = vector.y();
+        block[g*4 + 2] = vector.z();
+        block[g*4 + 3] = 0.0f;
+    }
+    return Vector::load(block, 4);
+}
+
+CORRADE_ENABLE_SSE2 inline void storeVectorsSse2(const Containers::StridedArrayView1D<Vector3<Float>>& vectors, const std::size_t offset, Float* const block, const typename SoaSse2::Type value) {
+    typedef SoaSse2 Vector;
+    Vector::store(block, 4, value);
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g)
+        vectors[offset + g] = Vector3<Float>::from(block + g*4);
+}
+
+CORRADE_ENABLE_SSE2 inline typename SoaSse2::Type loadJointWeightsSse2(const char* const jointIds, const std::ptrdiff_t jointIdStride, const char* const weights, const std::ptrdiff_t weightStride, const char* const jointData, const std::ptrdiff_t jointStride, const Float** const joints, Float* const block) {
+    typedef SoaSse2 Vector;
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g) {
+        joints[g] = reinterpret_cast<const Float*>(jointData + std::ptrdiff_t(*reinterpret_cast<const UnsignedInt*>(jointIds + std::ptrdiff_t(g)*jointIdStride))*jointStride);
+        const Float weight = *reinterpret_cast<const Float*>(weights + std::ptrdiff_t(g)*weightStride);
+        block[g*4 + 0] = block[g*4 + 1] = block[g*4 + 2] = block[g*4 + 3] = weight;
+    }
+    return Vector::load(block, 4);
+}
+
+CORRADE_ENABLE_SSE2 void skinLinearBlendIntoSse2(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    typedef SoaSse2 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const std::size_t size = positions.size();
+    const std::size_t influenceCount = jointIds.size()[1];
+    const char* const jointData = static_cast<const char*>(joints.data());
+    const std::ptrdiff_t jointStride = joints.stride();
+    const char* const jointIdData = static_cast<const char*>(jointIds.data());
+    const char* const weightData = static_cast<const char*>(weights.data());
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const Float* matrices[count];
+    Float block[Vector::Lanes];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type c0 = zero, c1 = zero, c2 = zero, c3 = zero;
+        for(std::size_t k = 0; k != influenceCount; ++k) {
+            const typename Vector::Type weight = loadJointWeightsSse2(jointIdData + std::ptrdiff_t(i)*jointIds.stride()[0] + std::ptrdiff_t(k)*jointIds.stride()[1], jointIds.stride()[0], weightData + std::ptrdiff_t(i)*weights.stride()[0] + std::ptrdiff_t(k)*weights.stride()[1], weights.stride()[0], jointData, jointStride, matrices, block);
+            c0 = Vector::madd(Vector::gather(matrices, 0), weight, c0);
+            c1 = Vector::madd(Vector::gather(matrices, 4), weight, c1);
+            c2 = Vector::madd(Vector::gather(matrices, 8), weight, c2);
+            c3 = Vector::madd(Vector::gather(matrices, 12), weight, c3);
+        }
+
+        const typename Vector::Type position = loadVectorsSse2(positions, i, block);
+        storeVectorsSse2(dstPositions, i, block,
+            Vector::madd(c2, Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(position, position),
+            Vector::madd(c1, Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(position, position),
+            Vector::madd(c0, Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(position, position), c3))));
+
+        if(!normals.isEmpty()) {
+            const typename Vector::Type normal = loadVectorsSse2(normals, i, block);
+            const typename Vector::Type transformed =
+                Vector::madd(c2, Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(normal, normal),
+                Vector::madd(c1, Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(normal, normal),
+                Vector::mul(c0, Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(normal, normal))));
+            storeVectorsSse2(dstNormals, i, block, Vector::div(transformed, Vector::sqrt(dot3Sse2(transformed, transformed))));
+        }
+    }
+
+    for(; i != size; ++i)
+        skinLinearBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+
+CORRADE_ENABLE_SSE2 void skinDualQuaternionBlendIntoSse2(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    typedef SoaSse2 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const std::size_t size = positions.size();
+    const std::size_t influenceCount = jointIds.size()[1];
+    const char* const jointData = static_cast<const char*>(joints.data());
+    const std::ptrdiff_t jointStride = joints.stride();
+    const char* const jointIdData = static_cast<const char*>(jointIds.data());
+    const char* const weightData = static_cast<const char*>(weights.data());
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const Float* quaternions[count];
+    Float block[Vector::Lanes];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type real = zero, dual = zero, pivot = zero;
+        for(std::size_t k = 0; k != influenceCount; ++k) {
+            const typename Vector::Type weight = loadJointWeightsSse2(jointIdData + std::ptrdiff_t(i)*jointIds.stride()[0] + std::ptrdiff_t(k)*jointIds.stride()[1], jointIds.stride()[0], weightData + std::ptrdiff_t(i)*weights.stride()[0] + std::ptrdiff_t(k)*weights.stride()[1], weights.stride()[0], jointData, jointStride, quaternions, block);
+            const typename Vector::Type jointReal = Vector::gather(quaternions, 0);
+            if(k == 0) pivot = jointReal;
+            const typename Vector::Type signedWeight = Vector::negateIf(Vector::lessThan(dot4Sse2(pivot, jointReal), zero), weight);
+            real = Vector::madd(jointReal, signedWeight, real);
+            dual = Vector::madd(Vector::gather(quaternions, 4), signedWeight, dual);
+        }
+
+        const typename Vector::Type length = Vector::sqrt(dot4Sse2(real, real));
+        real = Vector::div(real, length);
+        dual = Vector::div(dual, length);
+        const typename Vector::Type two = Vector::splat(2.0f);
+        const typename Vector::Type realScalar = Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(real, real);
+        const typename Vector::Type dualScalar = Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(dual, dual);
+        const typename Vector::Type translation = Vector::mul(two, Vector::add(Vector::sub(Vector::mul(realScalar, dual), Vector::mul(dualScalar, real)), crossSse2(real, dual)));
+
+        const typename Vector::Type position = loadVectorsSse2(positions, i, block);
+        storeVectorsSse2(dstPositions, i, block, Vector::add(Vector::madd(two, crossSse2(real, Vector::madd(realScalar, position, crossSse2(real, position))), position), translation));
+
+        if(!normals.isEmpty()) {
+            const typename Vector::Type normal = loadVectorsSse2(normals, i, block);
+            storeVectorsSse2(dstNormals, i, block, Vector::madd(two, crossSse2(real, Vector::madd(realScalar, normal, crossSse2(real, normal))), normal));
+        }
+    }
+
+    for(; i != size; ++i)
+        skinDualQuaternionBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type dot3AvxFma(const typename SoaAvxFma::Type a, const typename SoaAvxFma::Type b) {
+    typedef SoaAvxFma Vector;
+    const typename Vector::Type ab = Vector::mul(a, b);
+    return Vector::add(ab, Vector::add(Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(ab, ab), Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(ab, ab)));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type dot4AvxFma(const typename SoaAvxFma::Type a, const typename SoaAvxFma::Type b) {
+    typedef SoaAvxFma Vector;
+    const typename Vector::Type ab = Vector::mul(a, b);
+    const typename Vector::Type pairs = Vector::add(ab, Vector::template shuffle<_MM_SHUFFLE(2, 3, 0, 1)>(ab, ab));
+    return Vector::add(pairs, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(pairs, pairs));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type crossAvxFma(const typename SoaAvxFma::Type a, const typename SoaAvxFma::Type b) {
+    typedef SoaAvxFma Vector;
+    return Vector::sub(
+        Vector::mul(Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(a, a), Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(b, b)),
+        Vector::mul(Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(a, a), Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(b, b)));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type loadVectorsAvxFma(const Containers::StridedArrayView1D<const Vector3<Float>>& vectors, const std::size_t offset, Float* const block) {
+    typedef SoaAvxFma Vector;
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g) {
+        const Vector3<Float>& vector = vectors[offset + g];
+        block[g*4 + 0] = vector.x();
+        block[g*4 + 1] = vector.y();
+        block[g*4 + 2] = vector.z();
+        block[g*4 + 3] = 0.0f;
+    }
+    return Vector::load(block, 4);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline void storeVectorsAvxFma(const Containers::StridedArrayView1D<Vector3<Float>>& vectors, const std::size_t offset, Float* const block, const typename SoaAvxFma::Type value) {
+    typedef SoaAvxFma Vector;
+    Vector::store(block, 4, value);
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g)
+        vectors[offset + g] = Vector3<Float>::from(block + g*4);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) inline typename SoaAvxFma::Type loadJointWeightsAvxFma(const char* const jointIds, const std::ptrdiff_t jointIdStride, const char* const weights, const std::ptrdiff_t weightStride, const char* const jointData, const std::ptrdiff_t jointStride, const Float** const joints, Float* const block) {
+    typedef SoaAvxFma Vector;
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g) {
+        joints[g] = reinterpret_cast<const Float*>(jointData + std::ptrdiff_t(*reinterpret_cast<const UnsignedInt*>(jointIds + std::ptrdiff_t(g)*jointIdStride))*jointStride);
+        const Float weight = *reinterpret_cast<const Float*>(weights + std::ptrdiff_t(g)*weightStride);
+        block[g*4 + 0] = block[g*4 + 1] = block[g*4 + 2] = block[g*4 + 3] = weight;
+    }
+    return Vector::load(block, 4);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void skinLinearBlendIntoAvxFma(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    typedef SoaAvxFma Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const std::size_t size = positions.size();
+    const std::size_t influenceCount = jointIds.size()[1];
+    const char* const jointData = static_cast<const char*>(joints.data());
+    const std::ptrdiff_t jointStride = joints.stride();
+    const char* const jointIdData = static_cast<const char*>(jointIds.data());
+    const char* const weightData = static_cast<const char*>(weights.data());
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const Float* matrices[count];
+    Float block[Vector::Lanes];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type c0 = zero, c1 = zero, c2 = zero, c3 = zero;
+        for(std::size_t k = 0; k != influenceCount; ++k) {
+            const typename Vector::Type weight = loadJointWeightsAvxFma(jointIdData + std::ptrdiff_t(i)*jointIds.stride()[0] + std::ptrdiff_t(k)*jointIds.stride()[1], jointIds.stride()[0], weightData + std::ptrdiff_t(i)*weights.stride()[0] + std::ptrdiff_t(k)*weights.stride()[1], weights.stride()[0], jointData, jointStride, matrices, block);
+            c0 = Vector::madd(Vector::gather(matrices, 0), weight, c0);
+            c1 = Vector::madd(Vector::gather(matrices, 4), weight, c1);
+            c2 = Vector::madd(Vector::gather(matrices, 8), weight, c2);
+            c3 = Vector::madd(Vector::gather(matrices, 12), weight, c3);
+        }
+
+        const typename Vector::Type position = loadVectorsAvxFma(positions, i, block);
+        storeVectorsAvxFma(dstPositions, i, block,
+            Vector::madd(c2, Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(position, position),
+            Vector::madd(c1, Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(position, position),
+            Vector::madd(c0, Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(position, position), c3))));
+
+        if(!normals.isEmpty()) {
+            const typename Vector::Type normal = loadVectorsAvxFma(normals, i, block);
+            const typename Vector::Type transformed =
+                Vector::madd(c2, Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(normal, normal),
+                Vector::madd(c1, Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(normal, normal),
+                Vector::mul(c0, Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(normal, normal))));
+            storeVectorsAvxFma(dstNormals, i, block, Vector::div(transformed, Vector::sqrt(dot3AvxFma(transformed, transformed))));
+        }
+    }
+
+    for(; i != size; ++i)
+        skinLinearBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void skinDualQuaternionBlendIntoAvxFma(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    typedef SoaAvxFma Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const std::size_t size = positions.size();
+    const std::size_t influenceCount = jointIds.size()[1];
+    const char* const jointData = static_cast<const char*>(joints.data());
+    const std::ptrdiff_t jointStride = joints.stride();
+    const char* const jointIdData = static_cast<const char*>(jointIds.data());
+    const char* const weightData = static_cast<const char*>(weights.data());
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const Float* quaternions[count];
+    Float block[Vector::Lanes];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type real = zero, dual = zero, pivot = zero;
+        for(std::size_t k = 0; k != influenceCount; ++k) {
+            const typename Vector::Type weight = loadJointWeightsAvxFma(jointIdData + std::ptrdiff_t(i)*jointIds.stride()[0] + std::ptrdiff_t(k)*jointIds.stride()[1], jointIds.stride()[0], weightData + std::ptrdiff_t(i)*weights.stride()[0] + std::ptrdiff_t(k)*weights.stride()[1], weights.stride()[0], jointData, jointStride, quaternions, block);
+            const typename Vector::Type jointReal = Vector::gather(quaternions, 0);
+            if(k == 0) pivot = jointReal;
+            const typename Vector::Type signedWeight = Vector::negateIf(Vector::lessThan(dot4AvxFma(pivot, jointReal), zero), weight);
+            real = Vector::madd(jointReal, signedWeight, real);
+            dual = Vector::madd(Vector::gather(quaternions, 4), signedWeight, dual);
+        }
+
+        const typename Vector::Type length = Vector::sqrt(dot4AvxFma(real, real));
+        real = Vector::div(real, length);
+        dual = Vector::div(dual, length);
+        const typename Vector::Type two = Vector::splat(2.0f);
+        const typename Vector::Type realScalar = Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(real, real);
+        const typename Vector::Type dualScalar = Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(dual, dual);
+        const typename Vector::Type translation = Vector::mul(two, Vector::add(Vector::sub(Vector::mul(realScalar, dual), Vector::mul(dualScalar, real)), crossAvxFma(real, dual)));
+
+        const typename Vector::Type position = loadVectorsAvxFma(positions, i, block);
+        storeVectorsAvxFma(dstPositions, i, block, Vector::add(Vector::madd(two, crossAvxFma(real, Vector::madd(realScalar, position, crossAvxFma(real, position))), position), translation));
+
+        if(!normals.isEmpty()) {
+            const typename Vector::Type normal = loadVectorsAvxFma(normals, i, block);
+            storeVectorsAvxFma(dstNormals, i, block, Vector::madd(two, crossAvxFma(real, Vector::madd(realScalar, normal, crossAvxFma(real, normal))), normal));
+        }
+    }
+
+    for(; i != size; ++i)
+        skinDualQuaternionBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type dot3Avx512(const typename SoaAvx512::Type a, const typename SoaAvx512::Type b) {
+    typedef SoaAvx512 Vector;
+    const typename Vector::Type ab = Vector::mul(a, b);
+    return Vector::add(ab, Vector::add(Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(ab, ab), Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(ab, ab)));
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type dot4Avx512(const typename SoaAvx512::Type a, const typename SoaAvx512::Type b) {
+    typedef SoaAvx512 Vector;
+    const typename Vector::Type ab = Vector::mul(a, b);
+    const typename Vector::Type pairs = Vector::add(ab, Vector::template shuffle<_MM_SHUFFLE(2, 3, 0, 1)>(ab, ab));
+    return Vector::add(pairs, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(pairs, pairs));
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type crossAvx512(const typename SoaAvx512::Type a, const typename SoaAvx512::Type b) {
+    typedef SoaAvx512 Vector;
+    return Vector::sub(
+        Vector::mul(Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(a, a), Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(b, b)),
+        Vector::mul(Vector::template shuffle<_MM_SHUFFLE(3, 1, 0, 2)>(a, a), Vector::template shuffle<_MM_SHUFFLE(3, 0, 2, 1)>(b, b)));
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type loadVectorsAvx512(const Containers::StridedArrayView1D<const Vector3<Float>>& vectors, const std::size_t offset, Float* const block) {
+    typedef SoaAvx512 Vector;
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g) {
+        const Vector3<Float>& vector = vectors[offset + g];
+        block[g*4 + 0] = vector.x();
+        block[g*4 + 1] = vector.y();
+        block[g*4 + 2] = vector.z();
+        block[g*4 + 3] = 0.0f;
+    }
+    return Vector::load(block, 4);
+}
+
+CORRADE_ENABLE_AVX512F inline void storeVectorsAvx512(const Containers::StridedArrayView1D<Vector3<Float>>& vectors, const std::size_t offset, Float* const block, const typename SoaAvx512::Type value) {
+    typedef SoaAvx512 Vector;
+    Vector::store(block, 4, value);
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g)
+        vectors[offset + g] = Vector3<Float>::from(block + g*4);
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaAvx512::Type loadJointWeightsAvx512(const char* const jointIds, const std::ptrdiff_t jointIdStride, const char* const weights, const std::ptrdiff_t weightStride, const char* const jointData, const std::ptrdiff_t jointStride, const Float** const joints, Float* const block) {
+    typedef SoaAvx512 Vector;
+    for(std::size_t g = 0; g != Vector::Lanes/4; ++g) {
+        joints[g] = reinterpret_cast<const Float*>(jointData + std::ptrdiff_t(*reinterpret_cast<const UnsignedInt*>(jointIds + std::ptrdiff_t(g)*jointIdStride))*jointStride);
+        const Float weight = *reinterpret_cast<const Float*>(weights + std::ptrdiff_t(g)*weightStride);
+        block[g*4 + 0] = block[g*4 + 1] = block[g*4 + 2] = block[g*4 + 3] = weight;
+    }
+    return Vector::load(block, 4);
+}
+
+CORRADE_ENABLE_AVX512F void skinLinearBlendIntoAvx512(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    typedef SoaAvx512 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const std::size_t size = positions.size();
+    const std::size_t influenceCount = jointIds.size()[1];
+    const char* const jointData = static_cast<const char*>(joints.data());
+    const std::ptrdiff_t jointStride = joints.stride();
+    const char* const jointIdData = static_cast<const char*>(jointIds.data());
+    const char* const weightData = static_cast<const char*>(weights.data());
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const Float* matrices[count];
+    Float block[Vector::Lanes];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type c0 = zero, c1 = zero, c2 = zero, c3 = zero;
+        for(std::size_t k = 0; k != influenceCount; ++k) {
+            const typename Vector::Type weight = loadJointWeightsAvx512(jointIdData + std::ptrdiff_t(i)*jointIds.stride()[0] + std::ptrdiff_t(k)*jointIds.stride()[1], jointIds.stride()[0], weightData + std::ptrdiff_t(i)*weights.stride()[0] + std::ptrdiff_t(k)*weights.stride()[1], weights.stride()[0], jointData, jointStride, matrices, block);
+            c0 = Vector::madd(Vector::gather(matrices, 0), weight, c0);
+            c1 = Vector::madd(Vector::gather(matrices, 4), weight, c1);
+            c2 = Vector::madd(Vector::gather(matrices, 8), weight, c2);
+            c3 = Vector::madd(Vector::gather(matrices, 12), weight, c3);
+        }
+
+        const typename Vector::Type position = loadVectorsAvx512(positions, i, block);
+        storeVectorsAvx512(dstPositions, i, block,
+            Vector::madd(c2, Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(position, position),
+            Vector::madd(c1, Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(position, position),
+            Vector::madd(c0, Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(position, position), c3))));
+
+        if(!normals.isEmpty()) {
+            const typename Vector::Type normal = loadVectorsAvx512(normals, i, block);
+            const typename Vector::Type transformed =
+                Vector::madd(c2, Vector::template shuffle<_MM_SHUFFLE(2, 2, 2, 2)>(normal, normal),
+                Vector::madd(c1, Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(normal, normal),
+                Vector::mul(c0, Vector::template shuffle<_MM_SHUFFLE(0, 0, 0, 0)>(normal, normal))));
+            storeVectorsAvx512(dstNormals, i, block, Vector::div(transformed, Vector::sqrt(dot3Avx512(transformed, transformed))));
+        }
+    }
+
+    for(; i != size; ++i)
+        skinLinearBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+
+CORRADE_ENABLE_AVX512F void skinDualQuaternionBlendIntoAvx512(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    typedef SoaAvx512 Vector;
+    const std::size_t count = Vector::Lanes/4;
+    const std::size_t size = positions.size();
+    const std::size_t influenceCount = jointIds.size()[1];
+    const char* const jointData = static_cast<const char*>(joints.data());
+    const std::ptrdiff_t jointStride = joints.stride();
+    const char* const jointIdData = static_cast<const char*>(jointIds.data());
+    const char* const weightData = static_cast<const char*>(weights.data());
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const Float* quaternions[count];
+    Float block[Vector::Lanes];
+
+    std::size_t i = 0;
+    for(; i + count <= size; i += count) {
+        typename Vector::Type real = zero, dual = zero, pivot = zero;
+        for(std::size_t k = 0; k != influenceCount; ++k) {
+            const typename Vector::Type weight = loadJointWeightsAvx512(jointIdData + std::ptrdiff_t(i)*jointIds.stride()[0] + std::ptrdiff_t(k)*jointIds.stride()[1], jointIds.stride()[0], weightData + std::ptrdiff_t(i)*weights.stride()[0] + std::ptrdiff_t(k)*weights.stride()[1], weights.stride()[0], jointData, jointStride, quaternions, block);
+            const typename Vector::Type jointReal = Vector::gather(quaternions, 0);
+            if(k == 0) pivot = jointReal;
+            const typename Vector::Type signedWeight = Vector::negateIf(Vector::lessThan(dot4Avx512(pivot, jointReal), zero), weight);
+            real = Vector::madd(jointReal, signedWeight, real);
+            dual = Vector::madd(Vector::gather(quaternions, 4), signedWeight, dual);
+        }
+
+        const typename Vector::Type length = Vector::sqrt(dot4Avx512(real, real));
+        real = Vector::div(real, length);
+        dual = Vector::div(dual, length);
+        const typename Vector::Type two = Vector::splat(2.0f);
+        const typename Vector::Type realScalar = Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(real, real);
+        const typename Vector::Type dualScalar = Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(dual, dual);
+        const typename Vector::Type translation = Vector::mul(two, Vector::add(Vector::sub(Vector::mul(realScalar, dual), Vector::mul(dualScalar, real)), crossAvx512(real, dual)));
+
+        const typename Vector::Type position = loadVectorsAvx512(positions, i, block);
+        storeVectorsAvx512(dstPositions, i, block, Vector::add(Vector::madd(two, crossAvx512(real, Vector::madd(realScalar, position, crossAvx512(real, position))), position), translation));
+
+        if(!normals.isEmpty()) {
+            const typename Vector::Type normal = loadVectorsAvx512(normals, i, block);
+            storeVectorsAvx512(dstNormals, i, block, Vector::madd(two, crossAvx512(real, Vector::madd(realScalar, normal, crossAvx512(real, normal))), normal));
+        }
+    }
+
+    for(; i != size; ++i)
+        skinDualQuaternionBlendVertex(joints, jointIds, weights, positions, normals, dstPositions, dstNormals, i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(skinLinearBlendInto)>::type skinLinearBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return skinLinearBlendIntoAvx512;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(skinLinearBlendInto)>::type skinLinearBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return skinLinearBlendIntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(skinLinearBlendInto)>::type skinLinearBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return skinLinearBlendIntoSse2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(skinLinearBlendInto)>::type skinLinearBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return skinLinearBlendIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(skinLinearBlendIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(skinLinearBlendIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(skinLinearBlendIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(skinLinearBlendInto)(const Containers::StridedArrayView1D<const Matrix4<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals))({
+    skinLinearBlendIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(joints, jointIds, weights, positions, normals, dstPositions, dstNormals);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(skinDualQuaternionBlendInto)>::type skinDualQuaternionBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return skinDualQuaternionBlendIntoAvx512;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(skinDualQuaternionBlendInto)>::type skinDualQuaternionBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return skinDualQuaternionBlendIntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(skinDualQuaternionBlendInto)>::type skinDualQuaternionBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return skinDualQuaternionBlendIntoSse2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(skinDualQuaternionBlendInto)>::type skinDualQuaternionBlendIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return skinDualQuaternionBlendIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(skinDualQuaternionBlendIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(skinDualQuaternionBlendIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(skinDualQuaternionBlendIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(skinDualQuaternionBlendInto)(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& joints, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals))({
+    skinDualQuaternionBlendIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(joints, jointIds, weights, positions, normals, dstPositions, dstNormals);
+})
+
+}
+
+void skinLinearInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& jointMatrices, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    CORRADE_ASSERT(jointIds.size()[1] && jointIds.size() == weights.size(),
+        "Math::skinLinearInto(): expected joint ID and weight views to have the same non-zero size but got" << jointIds.size() << "and" << weights.size(), );
+    CORRADE_ASSERT(jointIds.size()[0] == positions.size() && dstPositions.size() == positions.size(),
+        "Math::skinLinearInto(): expected" << jointIds.size()[0] << "positions and destination positions but got" << positions.size() << "and" << dstPositions.size(), );
+    CORRADE_ASSERT(normals.isEmpty() == dstNormals.isEmpty() && (normals.isEmpty() || (normals.size() == positions.size() && dstNormals.size() == positions.size())),
+        "Math::skinLinearInto(): expected either no normals or" << positions.size() << "normals and destination normals but got" << normals.size() << "and" << dstNormals.size(), );
+    for(std::size_t i = 0; i != jointIds.size()[0]; ++i) for(std::size_t k = 0; k != jointIds.size()[1]; ++k) {
+        CORRADE_ASSERT(jointIds[i][k] < jointMatrices.size(),
+            "Math::skinLinearInto(): joint ID" << jointIds[i][k] << "of vertex" << i << "out of range for" << jointMatrices.size() << "joints", );
+    }
+    Implementation::skinLinearBlendInto(jointMatrices, jointIds, weights, positions, normals, dstPositions, dstNormals);
+}
+
+void skinLinearInto(const Containers::StridedArrayView1D<const Matrix4<Float>>& jointMatrices, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions) {
+    skinLinearInto(jointMatrices, jointIds, weights, positions, nullptr, dstPositions, nullptr);
+}
+
+void skinDualQuaternionInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& jointTransformations, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<const Vector3<Float>>& normals, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions, const Containers::StridedArrayView1D<Vector3<Float>>& dstNormals) {
+    CORRADE_ASSERT(jointIds.size()[1] && jointIds.size() == weights.size(),
+        "Math::skinDualQuaternionInto(): expected joint ID and weight views to have the same non-zero size but got" << jointIds.size() << "and" << weights.size(), );
+    CORRADE_ASSERT(jointIds.size()[0] == positions.size() && dstPositions.size() == positions.size(),
+        "Math::skinDualQuaternionInto(): expected" << jointIds.size()[0] << "positions and destination positions but got" << positions.size() << "and" << dstPositions.size(), );
+    CORRADE_ASSERT(normals.isEmpty() == dstNormals.isEmpty() && (normals.isEmpty() || (normals.size() == positions.size() && dstNormals.size() == positions.size())),
+        "Math::skinDualQuaternionInto(): expected either no normals or" << positions.size() << "normals and destination normals but got" << normals.size() << "and" << dstNormals.size(), );
+    for(std::size_t i = 0; i != jointIds.size()[0]; ++i) for(std::size_t k = 0; k != jointIds.size()[1]; ++k) {
+        CORRADE_ASSERT(jointIds[i][k] < jointTransformations.size(),
+            "Math::skinDualQuaternionInto(): joint ID" << jointIds[i][k] << "of vertex" << i << "out of range for" << jointTransformations.size() << "joints", );
+    }
+    Implementation::skinDualQuaternionBlendInto(jointTransformations, jointIds, weights, positions, normals, dstPositions, dstNormals);
+}
+
+void skinDualQuaternionInto(const Containers::StridedArrayView1D<const DualQuaternion<Float>>& jointTransformations, const Containers::StridedArrayView2D<const UnsignedInt>& jointIds, const Containers::StridedArrayView2D<const Float>& weights, const Containers::StridedArrayView1D<const Vector3<Float>>& positions, const Containers::StridedArrayView1D<Vector3<Float>>& dstPositions) {
+    skinDualQuaternionInto(jointTransformations, jointIds, weights, positions, nullptr, dstPositions, nullptr);
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packOctahedralByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packOctahedralShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackOctahedralByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackOctahedralShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(pack1010102UnsignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(pack1010102SignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpack1010102UnsignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpack1010102SignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packRgb9e5Into)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackRgb9e5Into)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size);
+
+namespace {
+
+template<class T> struct Packed1010102;
+template<> struct Packed1010102<UnsignedInt> {
+    constexpr static Float Min = 0.0f;
+    constexpr static Float Max = 1023.0f;
+    constexpr static Float AlphaMax = 3.0f;
+};
+template<> struct Packed1010102<Int> {
+    constexpr static Float Min = -1.0f;
+    constexpr static Float Max = 511.0f;
+    constexpr static Float AlphaMax = 1.0f;
+};
+
+inline const char* loadPackedBlock(const char* const data, const std::ptrdiff_t stride, const std::size_t itemSize, const std::size_t count, char* const block) {
+    if(stride == std::ptrdiff_t(itemSize)) return data;
+    for(std::size_t i = 0; i != count; ++i)
+        std::memcpy(block + i*itemSize, data + std::ptrdiff_t(i)*stride, itemSize);
+    return block;
+}
+
+inline void storePackedBlock(char* const data, const std::ptrdiff_t stride, const std::size_t itemSize, const std::size_t count, const char* const block) {
+    if(stride == std::ptrdiff_t(itemSize)) return;
+    for(std::size_t i = 0; i != count; ++i)
+        std::memcpy(data + std::ptrdiff_t(i)*stride, block + i*itemSize, itemSize);
+}
+
+inline Float clampPacked(const Float value, const Float min, const Float max) {
+    const Float clamped = value > min ? value : min;
+    return clamped < max ? clamped : max;
+}
+
+inline Float exponentScale(const Int exponent) {
+    const UnsignedInt bits = UnsignedInt(exponent + 127) << 23;
+    Float out;
+    std::memcpy(&out, &bits, 4);
+    return out;
+}
+
+template<class T> void packOctahedralIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& in = *reinterpret_cast<const Vector3<Float>*>(src);
+        const Float length = std::abs(in.x()) + std::abs(in.y()) + std::abs(in.z());
+        Float x = in.x()/length;
+        Float y = in.y()/length;
+        if(in.z() < 0.0f) {
+            const Float foldedX = std::copysign(1.0f - std::abs(y), x);
+            y = std::copysign(1.0f - std::abs(x), y);
+            x = foldedX;
+        }
+        *reinterpret_cast<Vector2<T>*>(dst) = {packScalar<T>(x), packScalar<T>(y)};
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<class T> void unpackOctahedralIntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector2<T>& in = *reinterpret_cast<const Vector2<T>*>(src);
+        Float x = unpackScalar(in.x());
+        Float y = unpackScalar(in.y());
+        const Float z = 1.0f - std::abs(x) - std::abs(y);
+        const Float fold = -z > 0.0f ? -z : 0.0f;
+        x -= std::copysign(fold, x);
+        y -= std::copysign(fold, y);
+        const Float length = std::sqrt(x*x + y*y + z*z);
+        *reinterpret_cast<Vector3<Float>*>(dst) = {x/length, y/length, z/length};
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<class T> void pack1010102IntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef Packed1010102<T> Traits;
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector4<Float>& in = *reinterpret_cast<const Vector4<Float>*>(src);
+        const UnsignedInt x = UnsignedInt(Int(std::round(clampPacked(in.x(), Traits::Min, 1.0f)*Traits::Max)));
+        const UnsignedInt y = UnsignedInt(Int(std::round(clampPacked(in.y(), Traits::Min, 1.0f)*Traits::Max)));
+        const UnsignedInt z = UnsignedInt(Int(std::round(clampPacked(in.z(), Traits::Min, 1.0f)*Traits::Max)));
+        const UnsignedInt w = UnsignedInt(Int(std::round(clampPacked(in.w(), Traits::Min, 1.0f)*Traits::AlphaMax)));
+        *reinterpret_cast<T*>(dst) = T((x & 0x3ff)|(y & 0x3ff) << 10|(z & 0x3ff) << 20|w << 30);
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+template<class T> void unpack1010102IntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef Packed1010102<T> Traits;
+    for(std::size_t i = 0; i != size; ++i) {
+        const T in = *reinterpret_cast<const T*>(src);
+        const Float x = Float(T(UnsignedInt(in) << 22) >> 22)/Traits::Max;
+        const Float y = Float(T(UnsignedInt(in) << 12) >> 22)/Traits::Max;
+        const Float z = Float(T(UnsignedInt(in) << 2) >> 22)/Traits::Max;
+        const Float w = Float(in >> 30)/Traits::AlphaMax;
+        *reinterpret_cast<Vector4<Float>*>(dst) = {
+            x > Traits::Min ? x : Traits::Min,
+            y > Traits::Min ? y : Traits::Min,
+            z > Traits::Min ? z : Traits::Min,
+            w > Traits::Min ? w : Traits::Min};
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+void packRgb9e5IntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& in = *reinterpret_cast<const Vector3<Float>*>(src);
+        const Float r = clampPacked(in.x(), 0.0f, 65408.0f);
+        const Float g = clampPacked(in.y(), 0.0f, 65408.0f);
+        const Float b = clampPacked(in.z(), 0.0f, 65408.0f);
+        const Float max = (r > g ? r : g) > b ? (r > g ? r : g) : b;
+        UnsignedInt maxBits;
+        std::memcpy(&maxBits, &max, 4);
+        const Int maxExponent = Int(maxBits >> 23) - 127;
+        Int exponent = (maxExponent > -16 ? maxExponent : -16) + 16;
+        exponent += Int(max*exponentScale(24 - exponent) + 0.5f) >> 9;
+        const Float scale = exponentScale(24 - exponent);
+        *reinterpret_cast<UnsignedInt*>(dst) =
+            UnsignedInt(r*scale + 0.5f)|
+            UnsignedInt(g*scale + 0.5f) << 9|
+            UnsignedInt(b*scale + 0.5f) << 18|
+            UnsignedInt(exponent) << 27;
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+void unpackRgb9e5IntoScalar(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedInt in = *reinterpret_cast<const UnsignedInt*>(src);
+        const Float scale = exponentScale(Int(in >> 27) - 24);
+        *reinterpret_cast<Vector3<Float>*>(dst) = {
+            Float(in & 0x1ff)*scale,
+            Float((in >> 9) & 0x1ff)*scale,
+            Float((in >> 18) & 0x1ff)*scale};
+
+        src += srcStride;
+        dst += dstStride;
+    }
+}
+
+#ifdef CORRADE_ENABLE_SSE41
+struct SoaPackSse41 {
+    typedef __m128 Type;
+    typedef __m128i IntType;
+    typedef __m128 Mask;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_SSE41 static Type splat(const Float value) {
+        return _mm_set1_ps(value);
+    }
+    CORRADE_ENABLE_SSE41 static IntType splatInt(const Int value) {
+        return _mm_set1_epi32(value);
+    }
+    CORRADE_ENABLE_SSE41 static Type load(const Float* const data, CORRADE_UNUSED const std::size_t step) {
+        return _mm_loadu_ps(data);
+    }
+    CORRADE_ENABLE_SSE41 static void store(Float* const data, CORRADE_UNUSED const std::size_t step, const Type value) {
+        _mm_storeu_ps(data, value);
+    }
+    CORRADE_ENABLE_SSE41 static IntType loadInt(const void* const data) {
+        return _mm_loadu_si128(static_cast<const __m128i*>(data));
+    }
+    CORRADE_ENABLE_SSE41 static void storeInt(void* const data, const IntType value) {
+        _mm_storeu_si128(static_cast<__m128i*>(data), value);
+    }
+    CORRADE_ENABLE_SSE41 static Type add(const Type a, const Type b) {
+        return _mm_add_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type sub(const Type a, const Type b) {
+        return _mm_sub_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type mul(const Type a, const Type b) {
+        return _mm_mul_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type div(const Type a, const Type b) {
+        return _mm_div_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type min(const Type a, const Type b) {
+        return _mm_min_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type max(const Type a, const Type b) {
+        return _mm_max_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type sqrt(const Type a) {
+        return _mm_sqrt_ps(a);
+    }
+    CORRADE_ENABLE_SSE41 static Type abs(const Type a) {
+        return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+    }
+    CORRADE_ENABLE_SSE41 static Type copySign(const Type magnitude, const Type sign) {
+        const __m128 mask = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(mask, magnitude), _mm_and_ps(mask, sign));
+    }
+    CORRADE_ENABLE_SSE41 static Mask lessThan(const Type a, const Type b) {
+        return _mm_cmplt_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type select(const Mask mask, const Type a, const Type b) {
+        return _mm_blendv_ps(b, a, mask);
+    }
+    template<int mask> CORRADE_ENABLE_SSE41 static Type shuffle(const Type a, const Type b) {
+        return _mm_shuffle_ps(a, b, mask);
+    }
+    CORRADE_ENABLE_SSE41 static Type unpackLo(const Type a, const Type b) {
+        return _mm_unpacklo_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static Type unpackHi(const Type a, const Type b) {
+        return _mm_unpackhi_ps(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static IntType round(const Type a) {
+        return roundSse41(a);
+    }
+    CORRADE_ENABLE_SSE41 static IntType truncate(const Type a) {
+        return _mm_cvttps_epi32(a);
+    }
+    CORRADE_ENABLE_SSE41 static Type toFloat(const IntType a) {
+        return _mm_cvtepi32_ps(a);
+    }
+    CORRADE_ENABLE_SSE41 static IntType castInt(const Type a) {
+        return _mm_castps_si128(a);
+    }
+    CORRADE_ENABLE_SSE41 static Type castFloat(const IntType a) {
+        return _mm_castsi128_ps(a);
+    }
+    CORRADE_ENABLE_SSE41 static IntType andInt(const IntType a, const IntType b) {
+        return _mm_and_si128(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static IntType orInt(const IntType a, const IntType b) {
+        return _mm_or_si128(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static IntType addInt(const IntType a, const IntType b) {
+        return _mm_add_epi32(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static IntType subInt(const IntType a, const IntType b) {
+        return _mm_sub_epi32(a, b);
+    }
+    CORRADE_ENABLE_SSE41 static IntType maxInt(const IntType a, const IntType b) {
+        return _mm_max_epi32(a, b);
+    }
+    template<int count> CORRADE_ENABLE_SSE41 static IntType shiftLeft(const IntType a) {
+        return _mm_slli_epi32(a, count);
+    }
+    template<int count> CORRADE_ENABLE_SSE41 static IntType shiftRight(const IntType a) {
+        return _mm_srli_epi32(a, count);
+    }
+    template<int count> CORRADE_ENABLE_SSE41 static IntType shiftRightSigned(const IntType a) {
+        return _mm_srai_epi32(a, count);
+    }
+    template<class T> CORRADE_ENABLE_SSE41 static void narrowInterleaved(T* const data, const IntType a, const IntType b) {
+        narrowSse41(data, _mm_unpacklo_epi32(a, b));
+        narrowSse41(data + 4, _mm_unpackhi_epi32(a, b));
+    }
+    template<class T> CORRADE_ENABLE_SSE41 static void widenDeinterleaved(const T* const data, Type& a, Type& b) {
+        const __m128 first = _mm_cvtepi32_ps(widenSse41(data));
+        const __m128 second = _mm_cvtepi32_ps(widenSse41(data + 4));
+        a = _mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+        b = _mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
+
+CORRADE_ENABLE_SSE41 inline void loadPackedVector3Sse41(const Float* const data, typename SoaPackSse41::Type& x, typename SoaPackSse41::Type& y, typename SoaPackSse41::Type& z) {
+    typedef SoaPackSse41 Vector;
+    const typename Vector::Type r0 = Vector::load(data, 12);
+    const typename Vector::Type r1 = Vector::load(data + 4, 12);
+    const typename Vector::Type r2 = Vector::load(data + 8, 12);
+    const typename Vector::Type xy23 = Vector::template shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(r1, r2);
+    const typename Vector::Type yz01 = Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(r0, r1);
+    x = Vector::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(r0, xy23);
+    y = Vector::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz01, xy23);
+    z = Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 1)>(yz01, Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(r2, r2));
+}
+
+CORRADE_ENABLE_SSE41 inline void storePackedVector3Sse41(Float* const data, const typename SoaPackSse41::Type x, const typename SoaPackSse41::Type y, const typename SoaPackSse41::Type z) {
+    typedef SoaPackSse41 Vector;
+    const typename Vector::Type xy01 = Vector::unpackLo(x, y);
+    const typename Vector::Type xy23 = Vector::unpackHi(x, y);
+    Vector::store(data, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(xy01, Vector::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x)));
+    Vector::store(data + 4, 12, Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z), xy23));
+    Vector::store(data + 8, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x), Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z)));
+}
+
+CORRADE_ENABLE_SSE41 inline void transposePackedSse41(typename SoaPackSse41::Type& a, typename SoaPackSse41::Type& b, typename SoaPackSse41::Type& c, typename SoaPackSse41::Type& d) {
+    typedef SoaPackSse41 Vector;
+    const typename Vector::Type ab01 = Vector::unpackLo(a, b);
+    const typename Vector::Type ab23 = Vector::unpackHi(a, b);
+    const typename Vector::Type cd01 = Vector::unpackLo(c, d);
+    const typename Vector::Type cd23 = Vector::unpackHi(c, d);
+    a = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ab01, cd01);
+    b = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ab01, cd01);
+    c = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ab23, cd23);
+    d = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ab23, cd23);
+}
+
+CORRADE_ENABLE_SSE41 inline typename SoaPackSse41::IntType exponentScaleSse41(const typename SoaPackSse41::IntType exponent) {
+    typedef SoaPackSse41 Vector;
+    return Vector::template shiftLeft<23>(Vector::addInt(exponent, Vector::splatInt(127)));
+}
+
+template<class T> CORRADE_ENABLE_SSE41 void packOctahedralIntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackSse41 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type max = Vector::splat(Float(bitMax<T>()));
+    char srcBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(Vector2<T>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector2<T>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type x, y, z;
+        loadPackedVector3Sse41(reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector3<Float>), lanes, srcBlock)), x, y, z);
+        const typename Vector::Type length = Vector::add(Vector::add(Vector::abs(x), Vector::abs(y)), Vector::abs(z));
+        x = Vector::div(x, length);
+        y = Vector::div(y, length);
+        const typename Vector::Mask negative = Vector::lessThan(z, zero);
+        const typename Vector::Type foldedX = Vector::copySign(Vector::sub(one, Vector::abs(y)), x);
+        const typename Vector::Type foldedY = Vector::copySign(Vector::sub(one, Vector::abs(x)), y);
+        x = Vector::select(negative, foldedX, x);
+        y = Vector::select(negative, foldedY, y);
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::narrowInterleaved(reinterpret_cast<T*>(out), Vector::round(Vector::mul(x, max)), Vector::round(Vector::mul(y, max)));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector2<T>), lanes, dstBlock);
+    }
+
+    packOctahedralIntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE41 void unpackOctahedralIntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackSse41 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type minusOne = Vector::splat(-1.0f);
+    const typename Vector::Type max = Vector::splat(Float(bitMax<T>()));
+    char srcBlock[Vector::Lanes*sizeof(Vector2<T>)];
+    char dstBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type x, y;
+        Vector::widenDeinterleaved(reinterpret_cast<const T*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector2<T>), lanes, srcBlock)), x, y);
+        x = Vector::max(Vector::div(x, max), minusOne);
+        y = Vector::max(Vector::div(y, max), minusOne);
+        const typename Vector::Type z = Vector::sub(Vector::sub(one, Vector::abs(x)), Vector::abs(y));
+        const typename Vector::Type fold = Vector::max(Vector::sub(zero, z), zero);
+        x = Vector::sub(x, Vector::copySign(fold, x));
+        y = Vector::sub(y, Vector::copySign(fold, y));
+        const typename Vector::Type length = Vector::sqrt(Vector::add(Vector::add(Vector::mul(x, x), Vector::mul(y, y)), Vector::mul(z, z)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        storePackedVector3Sse41(reinterpret_cast<Float*>(out), Vector::div(x, length), Vector::div(y, length), Vector::div(z, length));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector3<Float>), lanes, dstBlock);
+    }
+
+    unpackOctahedralIntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE41 void pack1010102IntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackSse41 Vector;
+    typedef Packed1010102<T> Traits;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type min = Vector::splat(Traits::Min);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type max = Vector::splat(Traits::Max);
+    const typename Vector::Type alphaMax = Vector::splat(Traits::AlphaMax);
+    const typename Vector::IntType mask = Vector::splatInt(0x3ff);
+    char srcBlock[Vector::Lanes*sizeof(Vector4<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(T)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(T));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* const in = reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector4<Float>), lanes, srcBlock));
+        typename Vector::Type x = Vector::load(in, 16);
+        typename Vector::Type y = Vector::load(in + 4, 16);
+        typename Vector::Type z = Vector::load(in + 8, 16);
+        typename Vector::Type w = Vector::load(in + 12, 16);
+        transposePackedSse41(x, y, z, w);
+        const typename Vector::IntType packedX = Vector::round(Vector::mul(Vector::min(Vector::max(x, min), one), max));
+        const typename Vector::IntType packedY = Vector::round(Vector::mul(Vector::min(Vector::max(y, min), one), max));
+        const typename Vector::IntType packedZ = Vector::round(Vector::mul(Vector::min(Vector::max(z, min), one), max));
+        const typename Vector::IntType packedW = Vector::round(Vector::mul(Vector::min(Vector::max(w, min), one), alphaMax));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::storeInt(out, Vector::orInt(
+            Vector::orInt(Vector::andInt(packedX, mask), Vector::template shiftLeft<10>(Vector::andInt(packedY, mask))),
+            Vector::orInt(Vector::template shiftLeft<20>(Vector::andInt(packedZ, mask)), Vector::template shiftLeft<30>(packedW))));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(T), lanes, dstBlock);
+    }
+
+    pack1010102IntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_SSE41 void unpack1010102IntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackSse41 Vector;
+    typedef Packed1010102<T> Traits;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type min = Vector::splat(Traits::Min);
+    const typename Vector::Type max = Vector::splat(Traits::Max);
+    const typename Vector::Type alphaMax = Vector::splat(Traits::AlphaMax);
+    char srcBlock[Vector::Lanes*sizeof(T)];
+    char dstBlock[Vector::Lanes*sizeof(Vector4<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector4<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const typename Vector::IntType in = Vector::loadInt(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(T), lanes, srcBlock));
+        typename Vector::IntType x, y, z, w;
+        if(std::is_signed<T>::value) {
+            x = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<22>(in));
+            y = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<12>(in));
+            z = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<2>(in));
+            w = Vector::template shiftRightSigned<30>(in);
+        } else {
+            x = Vector::template shiftRight<22>(Vector::template shiftLeft<22>(in));
+            y = Vector::template shiftRight<22>(Vector::template shiftLeft<12>(in));
+            z = Vector::template shiftRight<22>(Vector::template shiftLeft<2>(in));
+            w = Vector::template shiftRight<30>(in);
+        }
+        typename Vector::Type outX = Vector::max(Vector::div(Vector::toFloat(x), max), min);
+        typename Vector::Type outY = Vector::max(Vector::div(Vector::toFloat(y), max), min);
+        typename Vector::Type outZ = Vector::max(Vector::div(Vector::toFloat(z), max), min);
+        typename Vector::Type outW = Vector::max(Vector::div(Vector::toFloat(w), alphaMax), min);
+        transposePackedSse41(outX, outY, outZ, outW);
+        Float* const out = reinterpret_cast<Float*>(dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock);
+        Vector::store(out, 16, outX);
+        Vector::store(out + 4, 16, outY);
+        Vector::store(out + 8, 16, outZ);
+        Vector::store(out + 12, 16, outW);
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector4<Float>), lanes, dstBlock);
+    }
+
+    unpack1010102IntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_SSE41 void packRgb9e5IntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackSse41 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zeroFloat = Vector::splat(0.0f);
+    const typename Vector::Type half = Vector::splat(0.5f);
+    const typename Vector::Type max = Vector::splat(65408.0f);
+    const typename Vector::IntType zero = Vector::splatInt(0);
+    const typename Vector::IntType bias = Vector::splatInt(127 - 16);
+    const typename Vector::IntType scaleBias = Vector::splatInt(24);
+    char srcBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(UnsignedInt)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(UnsignedInt));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type r, g, b;
+        loadPackedVector3Sse41(reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector3<Float>), lanes, srcBlock)), r, g, b);
+        r = Vector::min(Vector::max(r, zeroFloat), max);
+        g = Vector::min(Vector::max(g, zeroFloat), max);
+        b = Vector::min(Vector::max(b, zeroFloat), max);
+        const typename Vector::Type maxComponent = Vector::max(Vector::max(r, g), b);
+        typename Vector::IntType exponent = Vector::maxInt(Vector::subInt(Vector::template shiftRight<23>(Vector::castInt(maxComponent)), bias), zero);
+        const typename Vector::IntType maxMantissa = Vector::truncate(Vector::add(Vector::mul(maxComponent, Vector::castFloat(exponentScaleSse41(Vector::subInt(scaleBias, exponent)))), half));
+        exponent = Vector::addInt(exponent, Vector::template shiftRight<9>(maxMantissa));
+        const typename Vector::Type scale = Vector::castFloat(exponentScaleSse41(Vector::subInt(scaleBias, exponent)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::storeInt(out, Vector::orInt(
+            Vector::orInt(Vector::truncate(Vector::add(Vector::mul(r, scale), half)), Vector::template shiftLeft<9>(Vector::truncate(Vector::add(Vector::mul(g, scale), half)))),
+            Vector::orInt(Vector::template shiftLeft<18>(Vector::truncate(Vector::add(Vector::mul(b, scale), half))), Vector::template shiftLeft<27>(exponent))));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(UnsignedInt), lanes, dstBlock);
+    }
+
+    packRgb9e5IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_SSE41 void unpackRgb9e5IntoSse41(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackSse41 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::IntType mask = Vector::splatInt(0x1ff);
+    const typename Vector::IntType scaleBias = Vector::splatInt(24);
+    char srcBlock[Vector::Lanes*sizeof(UnsignedInt)];
+    char dstBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const typename Vector::IntType in = Vector::loadInt(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(UnsignedInt), lanes, srcBlock));
+        const typename Vector::Type scale = Vector::castFloat(exponentScaleSse41(Vector::subInt(Vector::template shiftRight<27>(in), scaleBias)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        storePackedVector3Sse41(reinterpret_cast<Float*>(out),
+            Vector::mul(Vector::toFloat(Vector::andInt(in, mask)), scale),
+            Vector::mul(Vector::toFloat(Vector::andInt(Vector::template shiftRight<9>(in), mask)), scale),
+            Vector::mul(Vector::toFloat(Vector::andInt(Vector::template shiftRight<18>(in), mask)), scale));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector3<Float>), lanes, dstBlock);
+    }
+
+    unpackRgb9e5IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+struct SoaPackAvx2 {
+    typedef __m256 Type;
+    typedef __m256i IntType;
+    typedef __m256 Mask;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX2 static Type splat(const Float value) {
+        return _mm256_set1_ps(value);
+    }
+    CORRADE_ENABLE_AVX2 static IntType splatInt(const Int value) {
+        return _mm256_set1_epi32(value);
+    }
+    CORRADE_ENABLE_AVX2 static Type load(const Float* const data, const std::size_t step) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(data)), _mm_loadu_ps(data + step), 1);
+    }
+    CORRADE_ENABLE_AVX2 static void store(Float* const data, const std::size_t step, const Type value) {
+        _mm_storeu_ps(data, _mm256_castps256_ps128(value));
+        _mm_storeu_ps(data + step, _mm256_extractf128_ps(value, 1));
+    }
+    CORRADE_ENABLE_AVX2 static IntType loadInt(const void* const data) {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(data));
+    }
+    CORRADE_ENABLE_AVX2 static void storeInt(void* const data, const IntType value) {
+        _mm256_storeu_si256(static_cast<__m256i*>(data), value);
+    }
+    CORRADE_ENABLE_AVX2 static Type add(const Type a, const Type b) {
+        return _mm256_add_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type sub(const Type a, const Type b) {
+        return _mm256_sub_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type mul(const Type a, const Type b) {
+        return _mm256_mul_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type div(const Type a, const Type b) {
+        return _mm256_div_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type min(const Type a, const Type b) {
+        return _mm256_min_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type max(const Type a, const Type b) {
+        return _mm256_max_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type sqrt(const Type a) {
+        return _mm256_sqrt_ps(a);
+    }
+    CORRADE_ENABLE_AVX2 static Type abs(const Type a) {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+    }
+    CORRADE_ENABLE_AVX2 static Type copySign(const Type magnitude, const Type sign) {
+        const __m256 mask = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(mask, magnitude), _mm256_and_ps(mask, sign));
+    }
+    CORRADE_ENABLE_AVX2 static Mask lessThan(const Type a, const Type b) {
+        return _mm256_cmp_ps(a, b, _CMP_LT_OQ);
+    }
+    CORRADE_ENABLE_AVX2 static Type select(const Mask mask, const Type a, const Type b) {
+        return _mm256_blendv_ps(b, a, mask);
+    }
+    template<int mask> CORRADE_ENABLE_AVX2 static Type shuffle(const Type a, const Type b) {
+        return _mm256_shuffle_ps(a, b, mask);
+    }
+    CORRADE_ENABLE_AVX2 static Type unpackLo(const Type a, const Type b) {
+        return _mm256_unpacklo_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static Type unpackHi(const Type a, const Type b) {
+        return _mm256_unpackhi_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static IntType round(const Type a) {
+        return roundAvx2(a);
+    }
+    CORRADE_ENABLE_AVX2 static IntType truncate(const Type a) {
+        return _mm256_cvttps_epi32(a);
+    }
+    CORRADE_ENABLE_AVX2 static Type toFloat(const IntType a) {
+        return _mm256_cvtepi32_ps(a);
+    }
+    CORRADE_ENABLE_AVX2 static IntType castInt(const Type a) {
+        return _mm256_castps_si256(a);
+    }
+    CORRADE_ENABLE_AVX2 static Type castFloat(const IntType a) {
+        return _mm256_castsi256_ps(a);
+    }
+    CORRADE_ENABLE_AVX2 static IntType andInt(const IntType a, const IntType b) {
+        return _mm256_and_si256(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static IntType orInt(const IntType a, const IntType b) {
+        return _mm256_or_si256(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static IntType addInt(const IntType a, const IntType b) {
+        return _mm256_add_epi32(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static IntType subInt(const IntType a, const IntType b) {
+        return _mm256_sub_epi32(a, b);
+    }
+    CORRADE_ENABLE_AVX2 static IntType maxInt(const IntType a, const IntType b) {
+        return _mm256_max_epi32(a, b);
+    }
+    template<int count> CORRADE_ENABLE_AVX2 static IntType shiftLeft(const IntType a) {
+        return _mm256_slli_epi32(a, count);
+    }
+    template<int count> CORRADE_ENABLE_AVX2 static IntType shiftRight(const IntType a) {
+        return _mm256_srli_epi32(a, count);
+    }
+    template<int count> CORRADE_ENABLE_AVX2 static IntType shiftRightSigned(const IntType a) {
+        return _mm256_srai_epi32(a, count);
+    }
+    template<class T> CORRADE_ENABLE_AVX2 static void narrowInterleaved(T* const data, const IntType a, const IntType b) {
+        const __m256i lo = _mm256_unpacklo_epi32(a, b);
+        const __m256i hi = _mm256_unpackhi_epi32(a, b);
+        narrowAvx2(data, _mm256_permute2x128_si256(lo, hi, 0x20));
+        narrowAvx2(data + 8, _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    template<class T> CORRADE_ENABLE_AVX2 static void widenDeinterleaved(const T* const data, Type& a, Type& b) {
+        const __m256 first = _mm256_cvtepi32_ps(widenAvx2(data));
+        const __m256 second = _mm256_cvtepi32_ps(widenAvx2(data + 8));
+        const __m256 lo = _mm256_permute2f128_ps(first, second, 0x20);
+        const __m256 hi = _mm256_permute2f128_ps(first, second, 0x31);
+        a = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        b = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
+
+CORRADE_ENABLE_AVX2 inline void loadPackedVector3Avx2(const Float* const data, typename SoaPackAvx2::Type& x, typename SoaPackAvx2::Type& y, typename SoaPackAvx2::Type& z) {
+    typedef SoaPackAvx2 Vector;
+    const typename Vector::Type r0 = Vector::load(data, 12);
+    const typename Vector::Type r1 = Vector::load(data + 4, 12);
+    const typename Vector::Type r2 = Vector::load(data + 8, 12);
+    const typename Vector::Type xy23 = Vector::template shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(r1, r2);
+    const typename Vector::Type yz01 = Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(r0, r1);
+    x = Vector::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(r0, xy23);
+    y = Vector::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz01, xy23);
+    z = Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 1)>(yz01, Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(r2, r2));
+}
+
+CORRADE_ENABLE_AVX2 inline void storePackedVector3Avx2(Float* const data, const typename SoaPackAvx2::Type x, const typename SoaPackAvx2::Type y, const typename SoaPackAvx2::Type z) {
+    typedef SoaPackAvx2 Vector;
+    const typename Vector::Type xy01 = Vector::unpackLo(x, y);
+    const typename Vector::Type xy23 = Vector::unpackHi(x, y);
+    Vector::store(data, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(xy01, Vector::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x)));
+    Vector::store(data + 4, 12, Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z), xy23));
+    Vector::store(data + 8, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x), Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z)));
+}
+
+CORRADE_ENABLE_AVX2 inline void transposePackedAvx2(typename SoaPackAvx2::Type& a, typename SoaPackAvx2::Type& b, typename SoaPackAvx2::Type& c, typename SoaPackAvx2::Type& d) {
+    typedef SoaPackAvx2 Vector;
+    const typename Vector::Type ab01 = Vector::unpackLo(a, b);
+    const typename Vector::Type ab23 = Vector::unpackHi(a, b);
+    const typename Vector::Type cd01 = Vector::unpackLo(c, d);
+    const typename Vector::Type cd23 = Vector::unpackHi(c, d);
+    a = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ab01, cd01);
+    b = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ab01, cd01);
+    c = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ab23, cd23);
+    d = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ab23, cd23);
+}
+
+CORRADE_ENABLE_AVX2 inline typename SoaPackAvx2::IntType exponentScaleAvx2(const typename SoaPackAvx2::IntType exponent) {
+    typedef SoaPackAvx2 Vector;
+    return Vector::template shiftLeft<23>(Vector::addInt(exponent, Vector::splatInt(127)));
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void packOctahedralIntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type max = Vector::splat(Float(bitMax<T>()));
+    char srcBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(Vector2<T>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector2<T>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type x, y, z;
+        loadPackedVector3Avx2(reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector3<Float>), lanes, srcBlock)), x, y, z);
+        const typename Vector::Type length = Vector::add(Vector::add(Vector::abs(x), Vector::abs(y)), Vector::abs(z));
+        x = Vector::div(x, length);
+        y = Vector::div(y, length);
+        const typename Vector::Mask negative = Vector::lessThan(z, zero);
+        const typename Vector::Type foldedX = Vector::copySign(Vector::sub(one, Vector::abs(y)), x);
+        const typename Vector::Type foldedY = Vector::copySign(Vector::sub(one, Vector::abs(x)), y);
+        x = Vector::select(negative, foldedX, x);
+        y = Vector::select(negative, foldedY, y);
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::narrowInterleaved(reinterpret_cast<T*>(out), Vector::round(Vector::mul(x, max)), Vector::round(Vector::mul(y, max)));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector2<T>), lanes, dstBlock);
+    }
+
+    packOctahedralIntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void unpackOctahedralIntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type minusOne = Vector::splat(-1.0f);
+    const typename Vector::Type max = Vector::splat(Float(bitMax<T>()));
+    char srcBlock[Vector::Lanes*sizeof(Vector2<T>)];
+    char dstBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type x, y;
+        Vector::widenDeinterleaved(reinterpret_cast<const T*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector2<T>), lanes, srcBlock)), x, y);
+        x = Vector::max(Vector::div(x, max), minusOne);
+        y = Vector::max(Vector::div(y, max), minusOne);
+        const typename Vector::Type z = Vector::sub(Vector::sub(one, Vector::abs(x)), Vector::abs(y));
+        const typename Vector::Type fold = Vector::max(Vector::sub(zero, z), zero);
+        x = Vector::sub(x, Vector::copySign(fold, x));
+        y = Vector::sub(y, Vector::copySign(fold, y));
+        const typename Vector::Type length = Vector::sqrt(Vector::add(Vector::add(Vector::mul(x, x), Vector::mul(y, y)), Vector::mul(z, z)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        storePackedVector3Avx2(reinterpret_cast<Float*>(out), Vector::div(x, length), Vector::div(y, length), Vector::div(z, length));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector3<Float>), lanes, dstBlock);
+    }
+
+    unpackOctahedralIntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void pack1010102IntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx2 Vector;
+    typedef Packed1010102<T> Traits;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type min = Vector::splat(Traits::Min);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type max = Vector::splat(Traits::Max);
+    const typename Vector::Type alphaMax = Vector::splat(Traits::AlphaMax);
+    const typename Vector::IntType mask = Vector::splatInt(0x3ff);
+    char srcBlock[Vector::Lanes*sizeof(Vector4<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(T)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(T));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* const in = reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector4<Float>), lanes, srcBlock));
+        typename Vector::Type x = Vector::load(in, 16);
+        typename Vector::Type y = Vector::load(in + 4, 16);
+        typename Vector::Type z = Vector::load(in + 8, 16);
+        typename Vector::Type w = Vector::load(in + 12, 16);
+        transposePackedAvx2(x, y, z, w);
+        const typename Vector::IntType packedX = Vector::round(Vector::mul(Vector::min(Vector::max(x, min), one), max));
+        const typename Vector::IntType packedY = Vector::round(Vector::mul(Vector::min(Vector::max(y, min), one), max));
+        const typename Vector::IntType packedZ = Vector::round(Vector::mul(Vector::min(Vector::max(z, min), one), max));
+        const typename Vector::IntType packedW = Vector::round(Vector::mul(Vector::min(Vector::max(w, min), one), alphaMax));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::storeInt(out, Vector::orInt(
+            Vector::orInt(Vector::andInt(packedX, mask), Vector::template shiftLeft<10>(Vector::andInt(packedY, mask))),
+            Vector::orInt(Vector::template shiftLeft<20>(Vector::andInt(packedZ, mask)), Vector::template shiftLeft<30>(packedW))));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(T), lanes, dstBlock);
+    }
+
+    pack1010102IntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX2 void unpack1010102IntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx2 Vector;
+    typedef Packed1010102<T> Traits;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type min = Vector::splat(Traits::Min);
+    const typename Vector::Type max = Vector::splat(Traits::Max);
+    const typename Vector::Type alphaMax = Vector::splat(Traits::AlphaMax);
+    char srcBlock[Vector::Lanes*sizeof(T)];
+    char dstBlock[Vector::Lanes*sizeof(Vector4<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector4<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const typename Vector::IntType in = Vector::loadInt(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(T), lanes, srcBlock));
+        typename Vector::IntType x, y, z, w;
+        if(std::is_signed<T>::value) {
+            x = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<22>(in));
+            y = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<12>(in));
+            z = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<2>(in));
+            w = Vector::template shiftRightSigned<30>(in);
+        } else {
+            x = Vector::template shiftRight<22>(Vector::template shiftLeft<22>(in));
+            y = Vector::template shiftRight<22>(Vector::template shiftLeft<12>(in));
+            z = Vector::template shiftRight<22>(Vector::template shiftLeft<2>(in));
+            w = Vector::template shiftRight<30>(in);
+        }
+        typename Vector::Type outX = Vector::max(Vector::div(Vector::toFloat(x), max), min);
+        typename Vector::Type outY = Vector::max(Vector::div(Vector::toFloat(y), max), min);
+        typename Vector::Type outZ = Vector::max(Vector::div(Vector::toFloat(z), max), min);
+        typename Vector::Type outW = Vector::max(Vector::div(Vector::toFloat(w), alphaMax), min);
+        transposePackedAvx2(outX, outY, outZ, outW);
+        Float* const out = reinterpret_cast<Float*>(dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock);
+        Vector::store(out, 16, outX);
+        Vector::store(out + 4, 16, outY);
+        Vector::store(out + 8, 16, outZ);
+        Vector::store(out + 12, 16, outW);
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector4<Float>), lanes, dstBlock);
+    }
+
+    unpack1010102IntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_AVX2 void packRgb9e5IntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zeroFloat = Vector::splat(0.0f);
+    const typename Vector::Type half = Vector::splat(0.5f);
+    const typename Vector::Type max = Vector::splat(65408.0f);
+    const typename Vector::IntType zero = Vector::splatInt(0);
+    const typename Vector::IntType bias = Vector::splatInt(127 - 16);
+    const typename Vector::IntType scaleBias = Vector::splatInt(24);
+    char srcBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(UnsignedInt)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(UnsignedInt));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type r, g, b;
+        loadPackedVector3Avx2(reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector3<Float>), lanes, srcBlock)), r, g, b);
+        r = Vector::min(Vector::max(r, zeroFloat), max);
+        g = Vector::min(Vector::max(g, zeroFloat), max);
+        b = Vector::min(Vector::max(b, zeroFloat), max);
+        const typename Vector::Type maxComponent = Vector::max(Vector::max(r, g), b);
+        typename Vector::IntType exponent = Vector::maxInt(Vector::subInt(Vector::template shiftRight<23>(Vector::castInt(maxComponent)), bias), zero);
+        const typename Vector::IntType maxMantissa = Vector::truncate(Vector::add(Vector::mul(maxComponent, Vector::castFloat(exponentScaleAvx2(Vector::subInt(scaleBias, exponent)))), half));
+        exponent = Vector::addInt(exponent, Vector::template shiftRight<9>(maxMantissa));
+        const typename Vector::Type scale = Vector::castFloat(exponentScaleAvx2(Vector::subInt(scaleBias, exponent)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::storeInt(out, Vector::orInt(
+            Vector::orInt(Vector::truncate(Vector::add(Vector::mul(r, scale), half)), Vector::template shiftLeft<9>(Vector::truncate(Vector::add(Vector::mul(g, scale), half)))),
+            Vector::orInt(Vector::template shiftLeft<18>(Vector::truncate(Vector::add(Vector::mul(b, scale), half))), Vector::template shiftLeft<27>(exponent))));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(UnsignedInt), lanes, dstBlock);
+    }
+
+    packRgb9e5IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_AVX2 void unpackRgb9e5IntoAvx2(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::IntType mask = Vector::splatInt(0x1ff);
+    const typename Vector::IntType scaleBias = Vector::splatInt(24);
+    char srcBlock[Vector::Lanes*sizeof(UnsignedInt)];
+    char dstBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const typename Vector::IntType in = Vector::loadInt(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(UnsignedInt), lanes, srcBlock));
+        const typename Vector::Type scale = Vector::castFloat(exponentScaleAvx2(Vector::subInt(Vector::template shiftRight<27>(in), scaleBias)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        storePackedVector3Avx2(reinterpret_cast<Float*>(out),
+            Vector::mul(Vector::toFloat(Vector::andInt(in, mask)), scale),
+            Vector::mul(Vector::toFloat(Vector::andInt(Vector::template shiftRight<9>(in), mask)), scale),
+            Vector::mul(Vector::toFloat(Vector::andInt(Vector::template shiftRight<18>(in), mask)), scale));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector3<Float>), lanes, dstBlock);
+    }
+
+    unpackRgb9e5IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+struct SoaPackAvx512 {
+    typedef __m512 Type;
+    typedef __m512i IntType;
+    typedef __mmask16 Mask;
+    enum: std::size_t { Lanes = 16 };
+
+    CORRADE_ENABLE_AVX512F static Type splat(const Float value) {
+        return _mm512_set1_ps(value);
+    }
+    CORRADE_ENABLE_AVX512F static IntType splatInt(const Int value) {
+        return _mm512_set1_epi32(value);
+    }
+    CORRADE_ENABLE_AVX512F static Type load(const Float* const data, const std::size_t step) {
+        return _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4(_mm512_castps128_ps512(_mm_loadu_ps(data)), _mm_loadu_ps(data + step), 1), _mm_loadu_ps(data + 2*step), 2), _mm_loadu_ps(data + 3*step), 3);
+    }
+    CORRADE_ENABLE_AVX512F static void store(Float* const data, const std::size_t step, const Type value) {
+        _mm_storeu_ps(data, _mm512_castps512_ps128(value));
+        _mm_storeu_ps(data + step, _mm512_extractf32x4_ps(value, 1));
+        _mm_storeu_ps(data + 2*step, _mm512_extractf32x4_ps(value, 2));
+        _mm_storeu_ps(data + 3*step, _mm512_extractf32x4_ps(value, 3));
+    }
+    CORRADE_ENABLE_AVX512F static IntType loadInt(const void* const data) {
+        return _mm512_loadu_si512(data);
+    }
+    CORRADE_ENABLE_AVX512F static void storeInt(void* const data, const IntType value) {
+        _mm512_storeu_si512(data, value);
+    }
+    CORRADE_ENABLE_AVX512F static Type add(const Type a, const Type b) {
+        return _mm512_add_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type sub(const Type a, const Type b) {
+        return _mm512_sub_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type mul(const Type a, const Type b) {
+        return _mm512_mul_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type div(const Type a, const Type b) {
+        return _mm512_div_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type min(const Type a, const Type b) {
+        return _mm512_min_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type max(const Type a, const Type b) {
+        return _mm512_max_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type sqrt(const Type a) {
+        return _mm512_sqrt_ps(a);
+    }
+    CORRADE_ENABLE_AVX512F static Type abs(const Type a) {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_set1_epi32(0x7fffffff)));
+    }
+    CORRADE_ENABLE_AVX512F static Type copySign(const Type magnitude, const Type sign) {
+        return _mm512_castsi512_ps(_mm512_ternarylogic_epi32(_mm512_castps_si512(magnitude), _mm512_castps_si512(sign), _mm512_set1_epi32(0x7fffffff), 0xe4));
+    }
+    CORRADE_ENABLE_AVX512F static Mask lessThan(const Type a, const Type b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ);
+    }
+    CORRADE_ENABLE_AVX512F static Type select(const Mask mask, const Type a, const Type b) {
+        return _mm512_mask_blend_ps(mask, b, a);
+    }
+    template<int mask> CORRADE_ENABLE_AVX512F static Type shuffle(const Type a, const Type b) {
+        return _mm512_shuffle_ps(a, b, mask);
+    }
+    CORRADE_ENABLE_AVX512F static Type unpackLo(const Type a, const Type b) {
+        return _mm512_unpacklo_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static Type unpackHi(const Type a, const Type b) {
+        return _mm512_unpackhi_ps(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static IntType round(const Type a) {
+        return roundAvx512(a);
+    }
+    CORRADE_ENABLE_AVX512F static IntType truncate(const Type a) {
+        return _mm512_cvttps_epi32(a);
+    }
+    CORRADE_ENABLE_AVX512F static Type toFloat(const IntType a) {
+        return _mm512_cvtepi32_ps(a);
+    }
+    CORRADE_ENABLE_AVX512F static IntType castInt(const Type a) {
+        return _mm512_castps_si512(a);
+    }
+    CORRADE_ENABLE_AVX512F static Type castFloat(const IntType a) {
+        return _mm512_castsi512_ps(a);
+    }
+    CORRADE_ENABLE_AVX512F static IntType andInt(const IntType a, const IntType b) {
+        return _mm512_and_si512(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static IntType orInt(const IntType a, const IntType b) {
+        return _mm512_or_si512(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static IntType addInt(const IntType a, const IntType b) {
+        return _mm512_add_epi32(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static IntType subInt(const IntType a, const IntType b) {
+        return _mm512_sub_epi32(a, b);
+    }
+    CORRADE_ENABLE_AVX512F static IntType maxInt(const IntType a, const IntType b) {
+        return _mm512_max_epi32(a, b);
+    }
+    template<int count> CORRADE_ENABLE_AVX512F static IntType shiftLeft(const IntType a) {
+        return _mm512_slli_epi32(a, count);
+    }
+    template<int count> CORRADE_ENABLE_AVX512F static IntType shiftRight(const IntType a) {
+        return _mm512_srli_epi32(a, count);
+    }
+    template<int count> CORRADE_ENABLE_AVX512F static IntType shiftRightSigned(const IntType a) {
+        return _mm512_srai_epi32(a, count);
+    }
+    template<class T> CORRADE_ENABLE_AVX512F static void narrowInterleaved(T* const data, const IntType a, const IntType b) {
+        const __m512i lo = _mm512_unpacklo_epi32(a, b);
+        const __m512i hi = _mm512_unpackhi_epi32(a, b);
+        const __m512i first = _mm512_shuffle_i32x4(lo, hi, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m512i second = _mm512_shuffle_i32x4(lo, hi, _MM_SHUFFLE(3, 2, 3, 2));
+        narrowAvx512(data, _mm512_shuffle_i32x4(first, first, _MM_SHUFFLE(3, 1, 2, 0)));
+        narrowAvx512(data + 16, _mm512_shuffle_i32x4(second, second, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    template<class T> CORRADE_ENABLE_AVX512F static void widenDeinterleaved(const T* const data, Type& a, Type& b) {
+        const __m512 first = _mm512_cvtepi32_ps(widenAvx512(data));
+        const __m512 second = _mm512_cvtepi32_ps(widenAvx512(data + 16));
+        const __m512 lo = _mm512_shuffle_f32x4(first, second, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m512 hi = _mm512_shuffle_f32x4(first, second, _MM_SHUFFLE(3, 1, 3, 1));
+        a = _mm512_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+        b = _mm512_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+    }
+};
+
+CORRADE_ENABLE_AVX512F inline void loadPackedVector3Avx512(const Float* const data, typename SoaPackAvx512::Type& x, typename SoaPackAvx512::Type& y, typename SoaPackAvx512::Type& z) {
+    typedef SoaPackAvx512 Vector;
+    const typename Vector::Type r0 = Vector::load(data, 12);
+    const typename Vector::Type r1 = Vector::load(data + 4, 12);
+    const typename Vector::Type r2 = Vector::load(data + 8, 12);
+    const typename Vector::Type xy23 = Vector::template shuffle<_MM_SHUFFLE(2, 1, 3, 2)>(r1, r2);
+    const typename Vector::Type yz01 = Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 1)>(r0, r1);
+    x = Vector::template shuffle<_MM_SHUFFLE(2, 0, 3, 0)>(r0, xy23);
+    y = Vector::template shuffle<_MM_SHUFFLE(3, 1, 2, 0)>(yz01, xy23);
+    z = Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 1)>(yz01, Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(r2, r2));
+}
+
+CORRADE_ENABLE_AVX512F inline void storePackedVector3Avx512(Float* const data, const typename SoaPackAvx512::Type x, const typename SoaPackAvx512::Type y, const typename SoaPackAvx512::Type z) {
+    typedef SoaPackAvx512 Vector;
+    const typename Vector::Type xy01 = Vector::unpackLo(x, y);
+    const typename Vector::Type xy23 = Vector::unpackHi(x, y);
+    Vector::store(data, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 1, 0)>(xy01, Vector::template shuffle<_MM_SHUFFLE(1, 1, 0, 0)>(z, x)));
+    Vector::store(data + 4, 12, Vector::template shuffle<_MM_SHUFFLE(1, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 1, 1)>(y, z), xy23));
+    Vector::store(data + 8, 12, Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(3, 3, 2, 2)>(z, x), Vector::template shuffle<_MM_SHUFFLE(3, 3, 3, 3)>(y, z)));
+}
+
+CORRADE_ENABLE_AVX512F inline void transposePackedAvx512(typename SoaPackAvx512::Type& a, typename SoaPackAvx512::Type& b, typename SoaPackAvx512::Type& c, typename SoaPackAvx512::Type& d) {
+    typedef SoaPackAvx512 Vector;
+    const typename Vector::Type ab01 = Vector::unpackLo(a, b);
+    const typename Vector::Type ab23 = Vector::unpackHi(a, b);
+    const typename Vector::Type cd01 = Vector::unpackLo(c, d);
+    const typename Vector::Type cd23 = Vector::unpackHi(c, d);
+    a = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ab01, cd01);
+    b = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ab01, cd01);
+    c = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(ab23, cd23);
+    d = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(ab23, cd23);
+}
+
+CORRADE_ENABLE_AVX512F inline typename SoaPackAvx512::IntType exponentScaleAvx512(const typename SoaPackAvx512::IntType exponent) {
+    typedef SoaPackAvx512 Vector;
+    return Vector::template shiftLeft<23>(Vector::addInt(exponent, Vector::splatInt(127)));
+}
+
+template<class T> CORRADE_ENABLE_AVX512F void packOctahedralIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type max = Vector::splat(Float(bitMax<T>()));
+    char srcBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(Vector2<T>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector2<T>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type x, y, z;
+        loadPackedVector3Avx512(reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector3<Float>), lanes, srcBlock)), x, y, z);
+        const typename Vector::Type length = Vector::add(Vector::add(Vector::abs(x), Vector::abs(y)), Vector::abs(z));
+        x = Vector::div(x, length);
+        y = Vector::div(y, length);
+        const typename Vector::Mask negative = Vector::lessThan(z, zero);
+        const typename Vector::Type foldedX = Vector::copySign(Vector::sub(one, Vector::abs(y)), x);
+        const typename Vector::Type foldedY = Vector::copySign(Vector::sub(one, Vector::abs(x)), y);
+        x = Vector::select(negative, foldedX, x);
+        y = Vector::select(negative, foldedY, y);
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::narrowInterleaved(reinterpret_cast<T*>(out), Vector::round(Vector::mul(x, max)), Vector::round(Vector::mul(y, max)));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector2<T>), lanes, dstBlock);
+    }
+
+    packOctahedralIntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX512F void unpackOctahedralIntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zero = Vector::splat(0.0f);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type minusOne = Vector::splat(-1.0f);
+    const typename Vector::Type max = Vector::splat(Float(bitMax<T>()));
+    char srcBlock[Vector::Lanes*sizeof(Vector2<T>)];
+    char dstBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type x, y;
+        Vector::widenDeinterleaved(reinterpret_cast<const T*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector2<T>), lanes, srcBlock)), x, y);
+        x = Vector::max(Vector::div(x, max), minusOne);
+        y = Vector::max(Vector::div(y, max), minusOne);
+        const typename Vector::Type z = Vector::sub(Vector::sub(one, Vector::abs(x)), Vector::abs(y));
+        const typename Vector::Type fold = Vector::max(Vector::sub(zero, z), zero);
+        x = Vector::sub(x, Vector::copySign(fold, x));
+        y = Vector::sub(y, Vector::copySign(fold, y));
+        const typename Vector::Type length = Vector::sqrt(Vector::add(Vector::add(Vector::mul(x, x), Vector::mul(y, y)), Vector::mul(z, z)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        storePackedVector3Avx512(reinterpret_cast<Float*>(out), Vector::div(x, length), Vector::div(y, length), Vector::div(z, length));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector3<Float>), lanes, dstBlock);
+    }
+
+    unpackOctahedralIntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX512F void pack1010102IntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx512 Vector;
+    typedef Packed1010102<T> Traits;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type min = Vector::splat(Traits::Min);
+    const typename Vector::Type one = Vector::splat(1.0f);
+    const typename Vector::Type max = Vector::splat(Traits::Max);
+    const typename Vector::Type alphaMax = Vector::splat(Traits::AlphaMax);
+    const typename Vector::IntType mask = Vector::splatInt(0x3ff);
+    char srcBlock[Vector::Lanes*sizeof(Vector4<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(T)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(T));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const Float* const in = reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector4<Float>), lanes, srcBlock));
+        typename Vector::Type x = Vector::load(in, 16);
+        typename Vector::Type y = Vector::load(in + 4, 16);
+        typename Vector::Type z = Vector::load(in + 8, 16);
+        typename Vector::Type w = Vector::load(in + 12, 16);
+        transposePackedAvx512(x, y, z, w);
+        const typename Vector::IntType packedX = Vector::round(Vector::mul(Vector::min(Vector::max(x, min), one), max));
+        const typename Vector::IntType packedY = Vector::round(Vector::mul(Vector::min(Vector::max(y, min), one), max));
+        const typename Vector::IntType packedZ = Vector::round(Vector::mul(Vector::min(Vector::max(z, min), one), max));
+        const typename Vector::IntType packedW = Vector::round(Vector::mul(Vector::min(Vector::max(w, min), one), alphaMax));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::storeInt(out, Vector::orInt(
+            Vector::orInt(Vector::andInt(packedX, mask), Vector::template shiftLeft<10>(Vector::andInt(packedY, mask))),
+            Vector::orInt(Vector::template shiftLeft<20>(Vector::andInt(packedZ, mask)), Vector::template shiftLeft<30>(packedW))));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(T), lanes, dstBlock);
+    }
+
+    pack1010102IntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+template<class T> CORRADE_ENABLE_AVX512F void unpack1010102IntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx512 Vector;
+    typedef Packed1010102<T> Traits;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type min = Vector::splat(Traits::Min);
+    const typename Vector::Type max = Vector::splat(Traits::Max);
+    const typename Vector::Type alphaMax = Vector::splat(Traits::AlphaMax);
+    char srcBlock[Vector::Lanes*sizeof(T)];
+    char dstBlock[Vector::Lanes*sizeof(Vector4<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector4<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const typename Vector::IntType in = Vector::loadInt(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(T), lanes, srcBlock));
+        typename Vector::IntType x, y, z, w;
+        if(std::is_signed<T>::value) {
+            x = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<22>(in));
+            y = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<12>(in));
+            z = Vector::template shiftRightSigned<22>(Vector::template shiftLeft<2>(in));
+            w = Vector::template shiftRightSigned<30>(in);
+        } else {
+            x = Vector::template shiftRight<22>(Vector::template shiftLeft<22>(in));
+            y = Vector::template shiftRight<22>(Vector::template shiftLeft<12>(in));
+            z = Vector::template shiftRight<22>(Vector::template shiftLeft<2>(in));
+            w = Vector::template shiftRight<30>(in);
+        }
+        typename Vector::Type outX = Vector::max(Vector::div(Vector::toFloat(x), max), min);
+        typename Vector::Type outY = Vector::max(Vector::div(Vector::toFloat(y), max), min);
+        typename Vector::Type outZ = Vector::max(Vector::div(Vector::toFloat(z), max), min);
+        typename Vector::Type outW = Vector::max(Vector::div(Vector::toFloat(w), alphaMax), min);
+        transposePackedAvx512(outX, outY, outZ, outW);
+        Float* const out = reinterpret_cast<Float*>(dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock);
+        Vector::store(out, 16, outX);
+        Vector::store(out + 4, 16, outY);
+        Vector::store(out + 8, 16, outZ);
+        Vector::store(out + 12, 16, outW);
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector4<Float>), lanes, dstBlock);
+    }
+
+    unpack1010102IntoScalar<T>(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_AVX512F void packRgb9e5IntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::Type zeroFloat = Vector::splat(0.0f);
+    const typename Vector::Type half = Vector::splat(0.5f);
+    const typename Vector::Type max = Vector::splat(65408.0f);
+    const typename Vector::IntType zero = Vector::splatInt(0);
+    const typename Vector::IntType bias = Vector::splatInt(127 - 16);
+    const typename Vector::IntType scaleBias = Vector::splatInt(24);
+    char srcBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    char dstBlock[Vector::Lanes*sizeof(UnsignedInt)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(UnsignedInt));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        typename Vector::Type r, g, b;
+        loadPackedVector3Avx512(reinterpret_cast<const Float*>(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(Vector3<Float>), lanes, srcBlock)), r, g, b);
+        r = Vector::min(Vector::max(r, zeroFloat), max);
+        g = Vector::min(Vector::max(g, zeroFloat), max);
+        b = Vector::min(Vector::max(b, zeroFloat), max);
+        const typename Vector::Type maxComponent = Vector::max(Vector::max(r, g), b);
+        typename Vector::IntType exponent = Vector::maxInt(Vector::subInt(Vector::template shiftRight<23>(Vector::castInt(maxComponent)), bias), zero);
+        const typename Vector::IntType maxMantissa = Vector::truncate(Vector::add(Vector::mul(maxComponent, Vector::castFloat(exponentScaleAvx512(Vector::subInt(scaleBias, exponent)))), half));
+        exponent = Vector::addInt(exponent, Vector::template shiftRight<9>(maxMantissa));
+        const typename Vector::Type scale = Vector::castFloat(exponentScaleAvx512(Vector::subInt(scaleBias, exponent)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        Vector::storeInt(out, Vector::orInt(
+            Vector::orInt(Vector::truncate(Vector::add(Vector::mul(r, scale), half)), Vector::template shiftLeft<9>(Vector::truncate(Vector::add(Vector::mul(g, scale), half)))),
+            Vector::orInt(Vector::template shiftLeft<18>(Vector::truncate(Vector::add(Vector::mul(b, scale), half))), Vector::template shiftLeft<27>(exponent))));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(UnsignedInt), lanes, dstBlock);
+    }
+
+    packRgb9e5IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+
+CORRADE_ENABLE_AVX512F void unpackRgb9e5IntoAvx512(const char* src, const std::ptrdiff_t srcStride, char* dst, const std::ptrdiff_t dstStride, const std::size_t size) {
+    typedef SoaPackAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const typename Vector::IntType mask = Vector::splatInt(0x1ff);
+    const typename Vector::IntType scaleBias = Vector::splatInt(24);
+    char srcBlock[Vector::Lanes*sizeof(UnsignedInt)];
+    char dstBlock[Vector::Lanes*sizeof(Vector3<Float>)];
+    const bool dstContiguous = dstStride == std::ptrdiff_t(sizeof(Vector3<Float>));
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        const typename Vector::IntType in = Vector::loadInt(loadPackedBlock(src + std::ptrdiff_t(i)*srcStride, srcStride, sizeof(UnsignedInt), lanes, srcBlock));
+        const typename Vector::Type scale = Vector::castFloat(exponentScaleAvx512(Vector::subInt(Vector::template shiftRight<27>(in), scaleBias)));
+        char* const out = dstContiguous ? dst + std::ptrdiff_t(i)*dstStride : dstBlock;
+        storePackedVector3Avx512(reinterpret_cast<Float*>(out),
+            Vector::mul(Vector::toFloat(Vector::andInt(in, mask)), scale),
+            Vector::mul(Vector::toFloat(Vector::andInt(Vector::template shiftRight<9>(in), mask)), scale),
+            Vector::mul(Vector::toFloat(Vector::andInt(Vector::template shiftRight<18>(in), mask)), scale));
+        storePackedBlock(dst + std::ptrdiff_t(i)*dstStride, dstStride, sizeof(Vector3<Float>), lanes, dstBlock);
+    }
+
+    unpackRgb9e5IntoScalar(src + std::ptrdiff_t(i)*srcStride, srcStride, dst + std::ptrdiff_t(i)*dstStride, dstStride, size - i);
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packOctahedralByteInto)>::type packOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packOctahedralIntoSse41<Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packOctahedralByteInto)>::type packOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packOctahedralIntoAvx2<Byte>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packOctahedralByteInto)>::type packOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packOctahedralIntoAvx512<Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packOctahedralByteInto)>::type packOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packOctahedralIntoScalar<Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(packOctahedralByteIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packOctahedralByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packOctahedralByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    packOctahedralByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packOctahedralShortInto)>::type packOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packOctahedralIntoSse41<Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packOctahedralShortInto)>::type packOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packOctahedralIntoAvx2<Short>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packOctahedralShortInto)>::type packOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packOctahedralIntoAvx512<Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packOctahedralShortInto)>::type packOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packOctahedralIntoScalar<Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(packOctahedralShortIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packOctahedralShortIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packOctahedralShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    packOctahedralShortIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackOctahedralByteInto)>::type unpackOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackOctahedralIntoSse41<Byte>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackOctahedralByteInto)>::type unpackOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackOctahedralIntoAvx2<Byte>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackOctahedralByteInto)>::type unpackOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackOctahedralIntoAvx512<Byte>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackOctahedralByteInto)>::type unpackOctahedralByteIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackOctahedralIntoScalar<Byte>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(unpackOctahedralByteIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackOctahedralByteIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackOctahedralByteInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    unpackOctahedralByteIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackOctahedralShortInto)>::type unpackOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackOctahedralIntoSse41<Short>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackOctahedralShortInto)>::type unpackOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackOctahedralIntoAvx2<Short>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackOctahedralShortInto)>::type unpackOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackOctahedralIntoAvx512<Short>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackOctahedralShortInto)>::type unpackOctahedralShortIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackOctahedralIntoScalar<Short>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(unpackOctahedralShortIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackOctahedralShortIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackOctahedralShortInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    unpackOctahedralShortIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(pack1010102UnsignedInto)>::type pack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return pack1010102IntoSse41<UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(pack1010102UnsignedInto)>::type pack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return pack1010102IntoAvx2<UnsignedInt>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(pack1010102UnsignedInto)>::type pack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return pack1010102IntoAvx512<UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(pack1010102UnsignedInto)>::type pack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return pack1010102IntoScalar<UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(pack1010102UnsignedIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(pack1010102UnsignedIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(pack1010102UnsignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    pack1010102UnsignedIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(pack1010102SignedInto)>::type pack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return pack1010102IntoSse41<Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(pack1010102SignedInto)>::type pack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return pack1010102IntoAvx2<Int>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(pack1010102SignedInto)>::type pack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return pack1010102IntoAvx512<Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(pack1010102SignedInto)>::type pack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return pack1010102IntoScalar<Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(pack1010102SignedIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(pack1010102SignedIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(pack1010102SignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    pack1010102SignedIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpack1010102UnsignedInto)>::type unpack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpack1010102IntoSse41<UnsignedInt>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpack1010102UnsignedInto)>::type unpack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpack1010102IntoAvx2<UnsignedInt>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpack1010102UnsignedInto)>::type unpack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpack1010102IntoAvx512<UnsignedInt>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpack1010102UnsignedInto)>::type unpack1010102UnsignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpack1010102IntoScalar<UnsignedInt>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(unpack1010102UnsignedIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpack1010102UnsignedIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpack1010102UnsignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    unpack1010102UnsignedIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpack1010102SignedInto)>::type unpack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpack1010102IntoSse41<Int>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpack1010102SignedInto)>::type unpack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpack1010102IntoAvx2<Int>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpack1010102SignedInto)>::type unpack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpack1010102IntoAvx512<Int>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpack1010102SignedInto)>::type unpack1010102SignedIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpack1010102IntoScalar<Int>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(unpack1010102SignedIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpack1010102SignedIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpack1010102SignedInto)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    unpack1010102SignedIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(packRgb9e5Into)>::type packRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return packRgb9e5IntoSse41;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(packRgb9e5Into)>::type packRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return packRgb9e5IntoAvx2;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(packRgb9e5Into)>::type packRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return packRgb9e5IntoAvx512;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(packRgb9e5Into)>::type packRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return packRgb9e5IntoScalar;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(packRgb9e5IntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(packRgb9e5IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(packRgb9e5Into)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    packRgb9e5IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(unpackRgb9e5Into)>::type unpackRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return unpackRgb9e5IntoSse41;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX2) && defined(CORRADE_ENABLE_SSE41)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(unpackRgb9e5Into)>::type unpackRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return unpackRgb9e5IntoAvx2;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(unpackRgb9e5Into)>::type unpackRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return unpackRgb9e5IntoAvx512;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(unpackRgb9e5Into)>::type unpackRgb9e5IntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return unpackRgb9e5IntoScalar;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(unpackRgb9e5IntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(unpackRgb9e5IntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(unpackRgb9e5Into)(const char* src, std::ptrdiff_t srcStride, char* dst, std::ptrdiff_t dstStride, std::size_t size))({
+    unpackRgb9e5IntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(src, srcStride, dst, dstStride, size);
+})
+
+}
+
+namespace {
+
+template<class T, class U> void packedIntoImplementation(const Containers::StridedArrayView1D<const T>& src, const Containers::StridedArrayView1D<U>& dst, void(*function)(const char*, std::ptrdiff_t, char*, std::ptrdiff_t, std::size_t)) {
+    function(static_cast<const char*>(src.data()), src.stride(), static_cast<char*>(dst.data()), dst.stride(), src.size());
+}
+
+}
+
+void packOctahedralInto(const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector2<Byte>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packOctahedralInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::packOctahedralByteInto);
+}
+
+void packOctahedralInto(const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<Vector2<Short>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packOctahedralInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::packOctahedralShortInto);
+}
+
+void unpackOctahedralInto(const Containers::StridedArrayView1D<const Vector2<Byte>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackOctahedralInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::unpackOctahedralByteInto);
+}
+
+void unpackOctahedralInto(const Containers::StridedArrayView1D<const Vector2<Short>>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackOctahedralInto(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::unpackOctahedralShortInto);
+}
+
+void pack1010102Into(const Containers::StridedArrayView1D<const Vector4<Float>>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::pack1010102Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::pack1010102UnsignedInto);
+}
+
+void pack1010102Into(const Containers::StridedArrayView1D<const Vector4<Float>>& src, const Containers::StridedArrayView1D<Int>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::pack1010102Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::pack1010102SignedInto);
+}
+
+void unpack1010102Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView1D<Vector4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpack1010102Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::unpack1010102UnsignedInto);
+}
+
+void unpack1010102Into(const Containers::StridedArrayView1D<const Int>& src, const Containers::StridedArrayView1D<Vector4<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpack1010102Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::unpack1010102SignedInto);
+}
+
+void packRgb9e5Into(const Containers::StridedArrayView1D<const Vector3<Float>>& src, const Containers::StridedArrayView1D<UnsignedInt>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::packRgb9e5Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::packRgb9e5Into);
+}
+
+void unpackRgb9e5Into(const Containers::StridedArrayView1D<const UnsignedInt>& src, const Containers::StridedArrayView1D<Vector3<Float>>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Math::unpackRgb9e5Into(): wrong destination size, got" << dst.size() << "but expected" << src.size(), );
+    packedIntoImplementation(src, dst, Implementation::unpackRgb9e5Into);
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sumIntoFloat)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, const Float* shift, Float* sum, Float* sumSquares);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sumIntoDouble)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, const Double* shift, Double* sum, Double* sumSquares);
+
+namespace {
+
+template<class T, std::size_t components> struct SumState {
+    T sum[components];
+    T sumCompensation[components];
+    T sumSquares[components];
+    T sumSquaresCompensation[components];
+};
+
+template<class T> struct SumBlock {
+    enum: std::size_t { Size = 128/sizeof(T) };
+};
+
+template<class T> inline void kahanAdd(T& sum, T& compensation, const T value) {
+    const T y = value - compensation;
+    const T t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+}
+
+template<class T, std::size_t components, bool squares> CORRADE_NEVER_INLINE void sumComponentsAccumulate(const char* data, const std::ptrdiff_t stride, const std::size_t size, const T* const shift, SumState<T, components>& state) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const T* in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+        for(std::size_t j = 0; j != components; ++j) {
+            const T value = in[j] - shift[j];
+            kahanAdd(state.sum[j], state.sumCompensation[j], value);
+            if(squares) kahanAdd(state.sumSquares[j], state.sumSquaresCompensation[j], value*value);
+        }
+    }
+}
+
+template<class T, std::size_t components> inline void sumFold(const T* const block, const std::size_t lanes, T* const sum, T* const compensation) {
+    for(std::size_t j = 0; j != components*lanes; ++j) {
+        kahanAdd(sum[j % components], compensation[j % components], block[j]);
+        kahanAdd(sum[j % components], compensation[j % components], -block[components*lanes + j]);
+    }
+}
+
+template<class T, std::size_t components> inline void sumFinalize(const SumState<T, components>& state, T* const sum, T* const sumSquares) {
+    for(std::size_t j = 0; j != components; ++j) {
+        sum[j] = state.sum[j] - state.sumCompensation[j];
+        if(sumSquares) sumSquares[j] = state.sumSquares[j] - state.sumSquaresCompensation[j];
+    }
+}
+
+template<class T, std::size_t components, bool squares> void sumComponentsIntoScalar(const char* data, const std::ptrdiff_t stride, const std::size_t size, const T* const shift, T* const sum, T* const sumSquares) {
+    const std::size_t blockSize = SumBlock<T>::Size*components;
+    T sumV[blockSize]{}, sumCompensationV[blockSize]{};
+    T squaresV[blockSize]{}, squaresCompensationV[blockSize]{};
+
+    std::size_t i = 0;
+    for(; i + SumBlock<T>::Size <= size; i += SumBlock<T>::Size) {
+        for(std::size_t k = 0; k != SumBlock<T>::Size; ++k) {
+            const T* in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i + k)*stride);
+            for(std::size_t j = 0; j != components; ++j) {
+                const T value = in[j] - shift[j];
+                kahanAdd(sumV[k*components + j], sumCompensationV[k*components + j], value);
+                if(squares) kahanAdd(squaresV[k*components + j], squaresCompensationV[k*components + j], value*value);
+            }
+        }
+    }
+
+    SumState<T, components> state{};
+    for(std::size_t j = 0; j != blockSize; ++j) {
+        kahanAdd(state.sum[j % components], state.sumCompensation[j % components], sumV[j]);
+        kahanAdd(state.sum[j % components], state.sumCompensation[j % components], -sumCompensationV[j]);
+    }
+    if(squares) for(std::size_t j = 0; j != blockSize; ++j) {
+        kahanAdd(state.sumSquares[j % components], state.sumSquaresCompensation[j % components], squaresV[j]);
+        kahanAdd(state.sumSquares[j % components], state.sumSquaresCompensation[j % components], -squaresCompensationV[j]);
+    }
+
+    sumComponentsAccumulate<T, components, squares>(data + std::ptrdiff_t(i)*stride, stride, size - i, shift, state);
+    sumFinalize<T, components>(state, sum, sumSquares);
+}
+
+template<class T> void sumIntoScalar(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, const T* const shift, T* const sum, T* const sumSquares) {
+    switch(components) {
+        case 1: return sumSquares ? sumComponentsIntoScalar<T, 1, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoScalar<T, 1, false>(data, stride, size, shift, sum, sumSquares);
+        case 2: return sumSquares ? sumComponentsIntoScalar<T, 2, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoScalar<T, 2, false>(data, stride, size, shift, sum, sumSquares);
+        case 3: return sumSquares ? sumComponentsIntoScalar<T, 3, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoScalar<T, 3, false>(data, stride, size, shift, sum, sumSquares);
+        case 4: return sumSquares ? sumComponentsIntoScalar<T, 4, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoScalar<T, 4, false>(data, stride, size, shift, sum, sumSquares);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class T> struct SumSse2;
+
+template<> struct SumSse2<Float> {
+    typedef __m128 Type;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_SSE2 static Type zero() { return _mm_setzero_ps(); }
+    CORRADE_ENABLE_SSE2 static Type load(const Float* const data) { return _mm_loadu_ps(data); }
+    CORRADE_ENABLE_SSE2 static void store(Float* const data, const Type value) { _mm_storeu_ps(data, value); }
+    CORRADE_ENABLE_SSE2 static Type sub(const Type a, const Type b) { return _mm_sub_ps(a, b); }
+    CORRADE_ENABLE_SSE2 static Type mul(const Type a, const Type b) { return _mm_mul_ps(a, b); }
+    CORRADE_ENABLE_SSE2 static void kahanAdd(Type& sum, Type& compensation, const Type value) {
+        const Type y = _mm_sub_ps(value, compensation);
+        const Type t = _mm_add_ps(sum, y);
+        compensation = _mm_sub_ps(_mm_sub_ps(t, sum), y);
+        sum = t;
+    }
+};
+
+template<> struct SumSse2<Double> {
+    typedef __m128d Type;
+    enum: std::size_t { Lanes = 2 };
+
+    CORRADE_ENABLE_SSE2 static Type zero() { return _mm_setzero_pd(); }
+    CORRADE_ENABLE_SSE2 static Type load(const Double* const data) { return _mm_loadu_pd(data); }
+    CORRADE_ENABLE_SSE2 static void store(Double* const data, const Type value) { _mm_storeu_pd(data, value); }
+    CORRADE_ENABLE_SSE2 static Type sub(const Type a, const Type b) { return _mm_sub_pd(a, b); }
+    CORRADE_ENABLE_SSE2 static Type mul(const Type a, const Type b) { return _mm_mul_pd(a, b); }
+    CORRADE_ENABLE_SSE2 static void kahanAdd(Type& sum, Type& compensation, const Type value) {
+        const Type y = _mm_sub_pd(value, compensation);
+        const Type t = _mm_add_pd(sum, y);
+        compensation = _mm_sub_pd(_mm_sub_pd(t, sum), y);
+        sum = t;
+    }
+};
+
+template<class T, std::size_t components, bool squares> CORRADE_ENABLE_SSE2 void sumComponentsIntoSse2(const char* data, const std::ptrdiff_t stride, const std::size_t size, const T* const shift, T* const sum, T* const sumSquares) {
+    typedef SumSse2<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t unroll = SumBlock<T>::Size/lanes;
+    T block[SumBlock<T>::Size*components];
+    typename Vector::Type shiftV[components];
+    typename Vector::Type sumV[unroll][components], sumCompensationV[unroll][components];
+    typename Vector::Type squaresV[unroll][components], squaresCompensationV[unroll][components];
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = shift[j % components];
+    for(std::size_t j = 0; j != components; ++j) {
+        shiftV[j] = Vector::load(block + j*lanes);
+        for(std::size_t u = 0; u != unroll; ++u) {
+            sumV[u][j] = sumCompensationV[u][j] = Vector::zero();
+            squaresV[u][j] = squaresCompensationV[u][j] = Vector::zero();
+        }
+    }
+
+    const bool contiguous = stride == std::ptrdiff_t(components*sizeof(T));
+    std::size_t i = 0;
+    for(; i + SumBlock<T>::Size <= size; i += SumBlock<T>::Size) {
+        const T* in = block;
+        if(contiguous)
+            in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+        else for(std::size_t k = 0; k != SumBlock<T>::Size; ++k)
+            std::memcpy(block + k*components, data + std::ptrdiff_t(i + k)*stride, components*sizeof(T));
+
+        for(std::size_t u = 0; u != unroll; ++u) {
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::sub(Vector::load(in + (u*components + j)*lanes), shiftV[j]);
+                Vector::kahanAdd(sumV[u][j], sumCompensationV[u][j], value);
+                if(squares) Vector::kahanAdd(squaresV[u][j], squaresCompensationV[u][j], Vector::mul(value, value));
+            }
+        }
+    }
+
+    SumState<T, components> state{};
+    for(std::size_t u = 0; u != unroll; ++u) {
+        for(std::size_t j = 0; j != components; ++j) {
+            Vector::store(block + j*lanes, sumV[u][j]);
+            Vector::store(block + (components + j)*lanes, sumCompensationV[u][j]);
+        }
+        sumFold<T, components>(block, lanes, state.sum, state.sumCompensation);
+        if(squares) {
+            for(std::size_t j = 0; j != components; ++j) {
+                Vector::store(block + j*lanes, squaresV[u][j]);
+                Vector::store(block + (components + j)*lanes, squaresCompensationV[u][j]);
+            }
+            sumFold<T, components>(block, lanes, state.sumSquares, state.sumSquaresCompensation);
+        }
+    }
+
+    sumComponentsAccumulate<T, components, squares>(data + std::ptrdiff_t(i)*stride, stride, size - i, shift, state);
+    sumFinalize<T, components>(state, sum, sumSquares);
+}
+
+template<class T> void sumIntoSse2(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, const T* const shift, T* const sum, T* const sumSquares) {
+    switch(components) {
+        case 1: return sumSquares ? sumComponentsIntoSse2<T, 1, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoSse2<T, 1, false>(data, stride, size, shift, sum, sumSquares);
+        case 2: return sumSquares ? sumComponentsIntoSse2<T, 2, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoSse2<T, 2, false>(data, stride, size, shift, sum, sumSquares);
+        case 3: return sumSquares ? sumComponentsIntoSse2<T, 3, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoSse2<T, 3, false>(data, stride, size, shift, sum, sumSquares);
+        case 4: return sumSquares ? sumComponentsIntoSse2<T, 4, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoSse2<T, 4, false>(data, stride, size, shift, sum, sumSquares);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+template<class T> struct SumAvx;
+
+template<> struct SumAvx<Float> {
+    typedef __m256 Type;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX static Type zero() { return _mm256_setzero_ps(); }
+    CORRADE_ENABLE_AVX static Type load(const Float* const data) { return _mm256_loadu_ps(data); }
+    CORRADE_ENABLE_AVX static void store(Float* const data, const Type value) { _mm256_storeu_ps(data, value); }
+    CORRADE_ENABLE_AVX static Type sub(const Type a, const Type b) { return _mm256_sub_ps(a, b); }
+    CORRADE_ENABLE_AVX static Type mul(const Type a, const Type b) { return _mm256_mul_ps(a, b); }
+    CORRADE_ENABLE_AVX static void kahanAdd(Type& sum, Type& compensation, const Type value) {
+        const Type y = _mm256_sub_ps(value, compensation);
+        const Type t = _mm256_add_ps(sum, y);
+        compensation = _mm256_sub_ps(_mm256_sub_ps(t, sum), y);
+        sum = t;
+    }
+};
+
+template<> struct SumAvx<Double> {
+    typedef __m256d Type;
+    enum: std::size_t { Lanes = 4 };
+
+    CORRADE_ENABLE_AVX static Type zero() { return _mm256_setzero_pd(); }
+    CORRADE_ENABLE_AVX static Type load(const Double* const data) { return _mm256_loadu_pd(data); }
+    CORRADE_ENABLE_AVX static void store(Double* const data, const Type value) { _mm256_storeu_pd(data, value); }
+    CORRADE_ENABLE_AVX static Type sub(const Type a, const Type b) { return _mm256_sub_pd(a, b); }
+    CORRADE_ENABLE_AVX static Type mul(const Type a, const Type b) { return _mm256_mul_pd(a, b); }
+    CORRADE_ENABLE_AVX static void kahanAdd(Type& sum, Type& compensation, const Type value) {
+        const Type y = _mm256_sub_pd(value, compensation);
+        const Type t = _mm256_add_pd(sum, y);
+        compensation = _mm256_sub_pd(_mm256_sub_pd(t, sum), y);
+        sum = t;
+    }
+};
+
+template<class T, std::size_t components, bool squares> CORRADE_ENABLE_AVX void sumComponentsIntoAvx(const char* data, const std::ptrdiff_t stride, const std::size_t size, const T* const shift, T* const sum, T* const sumSquares) {
+    typedef SumAvx<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t unroll = SumBlock<T>::Size/lanes;
+    T block[SumBlock<T>::Size*components];
+    typename Vector::Type shiftV[components];
+    typename Vector::Type sumV[unroll][components], sumCompensationV[unroll][components];
+    typename Vector::Type squaresV[unroll][components], squaresCompensationV[unroll][components];
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = shift[j % components];
+    for(std::size_t j = 0; j != components; ++j) {
+        shiftV[j] = Vector::load(block + j*lanes);
+        for(std::size_t u = 0; u != unroll; ++u) {
+            sumV[u][j] = sumCompensationV[u][j] = Vector::zero();
+            squaresV[u][j] = squaresCompensationV[u][j] = Vector::zero();
+        }
+    }
+
+    const bool contiguous = stride == std::ptrdiff_t(components*sizeof(T));
+    std::size_t i = 0;
+    for(; i + SumBlock<T>::Size <= size; i += SumBlock<T>::Size) {
+        const T* in = block;
+        if(contiguous)
+            in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+        else for(std::size_t k = 0; k != SumBlock<T>::Size; ++k)
+            std::memcpy(block + k*components, data + std::ptrdiff_t(i + k)*stride, components*sizeof(T));
+
+        for(std::size_t u = 0; u != unroll; ++u) {
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::sub(Vector::load(in + (u*components + j)*lanes), shiftV[j]);
+                Vector::kahanAdd(sumV[u][j], sumCompensationV[u][j], value);
+                if(squares) Vector::kahanAdd(squaresV[u][j], squaresCompensationV[u][j], Vector::mul(value, value));
+            }
+        }
+    }
+
+    SumState<T, components> state{};
+    for(std::size_t u = 0; u != unroll; ++u) {
+        for(std::size_t j = 0; j != components; ++j) {
+            Vector::store(block + j*lanes, sumV[u][j]);
+            Vector::store(block + (components + j)*lanes, sumCompensationV[u][j]);
+        }
+        sumFold<T, components>(block, lanes, state.sum, state.sumCompensation);
+        if(squares) {
+            for(std::size_t j = 0; j != components; ++j) {
+                Vector::store(block + j*lanes, squaresV[u][j]);
+                Vector::store(block + (components + j)*lanes, squaresCompensationV[u][j]);
+            }
+            sumFold<T, components>(block, lanes, state.sumSquares, state.sumSquaresCompensation);
+        }
+    }
+
+    sumComponentsAccumulate<T, components, squares>(data + std::ptrdiff_t(i)*stride, stride, size - i, shift, state);
+    sumFinalize<T, components>(state, sum, sumSquares);
+}
+
+template<class T> void sumIntoAvx(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, const T* const shift, T* const sum, T* const sumSquares) {
+    switch(components) {
+        case 1: return sumSquares ? sumComponentsIntoAvx<T, 1, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx<T, 1, false>(data, stride, size, shift, sum, sumSquares);
+        case 2: return sumSquares ? sumComponentsIntoAvx<T, 2, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx<T, 2, false>(data, stride, size, shift, sum, sumSquares);
+        case 3: return sumSquares ? sumComponentsIntoAvx<T, 3, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx<T, 3, false>(data, stride, size, shift, sum, sumSquares);
+        case 4: return sumSquares ? sumComponentsIntoAvx<T, 4, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx<T, 4, false>(data, stride, size, shift, sum, sumSquares);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+template<class T> struct SumAvx512;
+
+template<> struct SumAvx512<Float> {
+    typedef __m512 Type;
+    enum: std::size_t { Lanes = 16 };
+
+    CORRADE_ENABLE_AVX512F static Type zero() { return _mm512_setzero_ps(); }
+    CORRADE_ENABLE_AVX512F static Type load(const Float* const data) { return _mm512_loadu_ps(data); }
+    CORRADE_ENABLE_AVX512F static void store(Float* const data, const Type value) { _mm512_storeu_ps(data, value); }
+    CORRADE_ENABLE_AVX512F static Type sub(const Type a, const Type b) { return _mm512_sub_ps(a, b); }
+    CORRADE_ENABLE_AVX512F static Type mul(const Type a, const Type b) { return _mm512_mul_round_ps(a, b, _MM_FROUND_CUR_DIRECTION); }
+    CORRADE_ENABLE_AVX512F static void kahanAdd(Type& sum, Type& compensation, const Type value) {
+        const Type y = _mm512_sub_ps(value, compensation);
+        const Type t = _mm512_add_ps(sum, y);
+        compensation = _mm512_sub_ps(_mm512_sub_ps(t, sum), y);
+        sum = t;
+    }
+};
+
+template<> struct SumAvx512<Double> {
+    typedef __m512d Type;
+    enum: std::size_t { Lanes = 8 };
+
+    CORRADE_ENABLE_AVX512F static Type zero() { return _mm512_setzero_pd(); }
+    CORRADE_ENABLE_AVX512F static Type load(const Double* const data) { return _mm512_loadu_pd(data); }
+    CORRADE_ENABLE_AVX512F static void store(Double* const data, const Type value) { _mm512_storeu_pd(data, value); }
+    CORRADE_ENABLE_AVX512F static Type sub(const Type a, const Type b) { return _mm512_sub_pd(a, b); }
+    CORRADE_ENABLE_AVX512F static Type mul(const Type a, const Type b) { return _mm512_mul_round_pd(a, b, _MM_FROUND_CUR_DIRECTION); }
+    CORRADE_ENABLE_AVX512F static void kahanAdd(Type& sum, Type& compensation, const Type value) {
+        const Type y = _mm512_sub_pd(value, compensation);
+        const Type t = _mm512_add_pd(sum, y);
+        compensation = _mm512_sub_pd(_mm512_sub_pd(t, sum), y);
+        sum = t;
+    }
+};
+
+template<class T, std::size_t components, bool squares> CORRADE_ENABLE_AVX512F void sumComponentsIntoAvx512(const char* data, const std::ptrdiff_t stride, const std::size_t size, const T* const shift, T* const sum, T* const sumSquares) {
+    typedef SumAvx512<T> Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t unroll = SumBlock<T>::Size/lanes;
+    T block[SumBlock<T>::Size*components];
+    typename Vector::Type shiftV[components];
+    typename Vector::Type sumV[unroll][components], sumCompensationV[unroll][components];
+    typename Vector::Type squaresV[unroll][components], squaresCompensationV[unroll][components];
+    for(std::size_t j = 0; j != components*lanes; ++j)
+        block[j] = shift[j % components];
+    for(std::size_t j = 0; j != components; ++j) {
+        shiftV[j] = Vector::load(block + j*lanes);
+        for(std::size_t u = 0; u != unroll; ++u) {
+            sumV[u][j] = sumCompensationV[u][j] = Vector::zero();
+            squaresV[u][j] = squaresCompensationV[u][j] = Vector::zero();
+        }
+    }
+
+    const bool contiguous = stride == std::ptrdiff_t(components*sizeof(T));
+    std::size_t i = 0;
+    for(; i + SumBlock<T>::Size <= size; i += SumBlock<T>::Size) {
+        const T* in = block;
+        if(contiguous)
+            in = reinterpret_cast<const T*>(data + std::ptrdiff_t(i)*stride);
+        else for(std::size_t k = 0; k != SumBlock<T>::Size; ++k)
+            std::memcpy(block + k*components, data + std::ptrdiff_t(i + k)*stride, components*sizeof(T));
+
+        for(std::size_t u = 0; u != unroll; ++u) {
+            for(std::size_t j = 0; j != components; ++j) {
+                const typename Vector::Type value = Vector::sub(Vector::load(in + (u*components + j)*lanes), shiftV[j]);
+                Vector::kahanAdd(sumV[u][j], sumCompensationV[u][j], value);
+                if(squares) Vector::kahanAdd(squaresV[u][j], squaresCompensationV[u][j], Vector::mul(value, value));
+            }
+        }
+    }
+
+    SumState<T, components> state{};
+    for(std::size_t u = 0; u != unroll; ++u) {
+        for(std::size_t j = 0; j != components; ++j) {
+            Vector::store(block + j*lanes, sumV[u][j]);
+            Vector::store(block + (components + j)*lanes, sumCompensationV[u][j]);
+        }
+        sumFold<T, components>(block, lanes, state.sum, state.sumCompensation);
+        if(squares) {
+            for(std::size_t j = 0; j != components; ++j) {
+                Vector::store(block + j*lanes, squaresV[u][j]);
+                Vector::store(block + (components + j)*lanes, squaresCompensationV[u][j]);
+            }
+            sumFold<T, components>(block, lanes, state.sumSquares, state.sumSquaresCompensation);
+        }
+    }
+
+    sumComponentsAccumulate<T, components, squares>(data + std::ptrdiff_t(i)*stride, stride, size - i, shift, state);
+    sumFinalize<T, components>(state, sum, sumSquares);
+}
+
+template<class T> void sumIntoAvx512(const char* data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, const T* const shift, T* const sum, T* const sumSquares) {
+    switch(components) {
+        case 1: return sumSquares ? sumComponentsIntoAvx512<T, 1, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx512<T, 1, false>(data, stride, size, shift, sum, sumSquares);
+        case 2: return sumSquares ? sumComponentsIntoAvx512<T, 2, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx512<T, 2, false>(data, stride, size, shift, sum, sumSquares);
+        case 3: return sumSquares ? sumComponentsIntoAvx512<T, 3, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx512<T, 3, false>(data, stride, size, shift, sum, sumSquares);
+        case 4: return sumSquares ? sumComponentsIntoAvx512<T, 4, true>(data, stride, size, shift, sum, sumSquares) : sumComponentsIntoAvx512<T, 4, false>(data, stride, size, shift, sum, sumSquares);
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(sumIntoFloat)>::type sumIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return sumIntoSse2<Float>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(sumIntoFloat)>::type sumIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return sumIntoAvx<Float>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(sumIntoFloat)>::type sumIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return sumIntoAvx512<Float>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(sumIntoFloat)>::type sumIntoFloatImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return sumIntoScalar<Float>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(sumIntoFloatImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(sumIntoFloatImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sumIntoFloat)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, const Float* shift, Float* sum, Float* sumSquares))({
+    sumIntoFloatImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, shift, sum, sumSquares);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(sumIntoDouble)>::type sumIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return sumIntoSse2<Double>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX typename std::decay<decltype(sumIntoDouble)>::type sumIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx)) {
+    return sumIntoAvx<Double>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(sumIntoDouble)>::type sumIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return sumIntoAvx512<Double>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(sumIntoDouble)>::type sumIntoDoubleImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return sumIntoScalar<Double>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(sumIntoDoubleImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(sumIntoDoubleImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sumIntoDouble)(const char* data, std::ptrdiff_t stride, std::size_t size, std::size_t components, const Double* shift, Double* sum, Double* sumSquares))({
+    sumIntoDoubleImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, stride, size, components, shift, sum, sumSquares);
+})
+
+namespace {
+
+template<class T> void meanVarianceIntoImplementation(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, T* const mean, T* const variance, void(*const sumIntoFunction)(const char*, std::ptrdiff_t, std::size_t, std::size_t, const T*, T*, T*)) {
+    T sum[4];
+    T sumSquares[4];
+    sumIntoFunction(data, stride, size, components, reinterpret_cast<const T*>(data), sum, sumSquares);
+    for(std::size_t j = 0; j != components; ++j) {
+        const T shiftedMean = sum[j]/T(size);
+        mean[j] = reinterpret_cast<const T*>(data)[j] + shiftedMean;
+        variance[j] = Math::max(sumSquares[j]/T(size) - shiftedMean*shiftedMean, T(0));
+    }
+}
+
+}
+
+void sumInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Float* const sum) {
+    const Float zero[4]{};
+    sumIntoFloat(data, stride, size, components, zero, sum, nullptr);
+}
+
+void sumInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Double* const sum) {
+    const Double zero[4]{};
+    sumIntoDouble(data, stride, size, components, zero, sum, nullptr);
+}
+
+void meanVarianceInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Float* const mean, Float* const variance) {
+    meanVarianceIntoImplementation(data, stride, size, components, mean, variance, sumIntoFloat);
+}
+
+void meanVarianceInto(const char* const data, const std::ptrdiff_t stride, const std::size_t size, const std::size_t components, Double* const mean, Double* const variance) {
+    meanVarianceIntoImplementation(data, stride, size, components, mean, variance, sumIntoDouble);
+}
+
+}
+
+namespace Implementation {
+
+typedef void(*RayRangeIntoFunction)(const char* const*, const std::ptrdiff_t*, std::size_t, char*, std::ptrdiff_t, char*, std::ptrdiff_t, char*, std::size_t);
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(rayRangeInto)(const char* const* data, const std::ptrdiff_t* strides, std::size_t size, char* tNear, std::ptrdiff_t tNearStride, char* tFar, std::ptrdiff_t tFarStride, char* hits, std::size_t hitsOffset);
+
+namespace {
+
+inline Float rayRangeMin(const Float a, const Float b) {
+    return a < b ? a : b;
+}
+
+inline Float rayRangeMax(const Float a, const Float b) {
+    return a > b ? a : b;
+}
+
+void rayRangeIntoScalar(const char* const* const data, const std::ptrdiff_t* const strides, const std::size_t size, char* const tNear, const std::ptrdiff_t tNearStride, char* const tFar, const std::ptrdiff_t tFarStride, char* const hits, const std::size_t hitsOffset) {
+    for(std::size_t i = 0; i != size; ++i) {
+        Float values[12];
+        for(std::size_t c = 0; c != 12; ++c)
+            values[c] = *reinterpret_cast<const Float*>(data[c] + std::ptrdiff_t(i)*strides[c]);
+
+        Float tNearValue = 0.0f, tFarValue = 0.0f;
+        for(std::size_t a = 0; a != 3; ++a) {
+            const Float t0 = (values[6 + a] - values[a])*values[3 + a];
+            const Float t1 = (values[9 + a] - values[a])*values[3 + a];
+            const Float low = rayRangeMin(t0, t1);
+            const Float high = rayRangeMax(t0, t1);
+            tNearValue = a ? rayRangeMax(tNearValue, low) : low;
+            tFarValue = a ? rayRangeMin(tFarValue, high) : high;
+        }
+
+        *reinterpret_cast<Float*>(tNear + std::ptrdiff_t(i)*tNearStride) = tNearValue;
+        *reinterpret_cast<Float*>(tFar + std::ptrdiff_t(i)*tFarStride) = tFarValue;
+        const std::size_t bit = hitsOffset + i;
+        if(tFarValue >= tNearValue)
+            hits[bit >> 3] |= char(1 << (bit & 0x07));
+        else
+            hits[bit >> 3] &= char(~(1 << (bit & 0x07)));
+    }
+}
+
+struct RayRangeLayout {
+    bool packedOrigins;
+    bool packedInverseDirections;
+    bool packedRanges;
+};
+
+inline bool isPackedRayRangeStream(const char* const* const data, const std::ptrdiff_t* const strides, const std::size_t components) {
+    for(std::size_t c = 0; c != components; ++c)
+        if(strides[c] != std::ptrdiff_t(components*sizeof(Float)) || data[c] != data[0] + c*sizeof(Float))
+            return false;
+    return true;
+}
+
+inline RayRangeLayout rayRangeLayout(const char* const* const data, const std::ptrdiff_t* const strides) {
+    return {isPackedRayRangeStream(data, strides, 3),
+            isPackedRayRangeStream(data + 3, strides + 3, 3),
+            isPackedRayRangeStream(data + 6, strides + 6, 6)};
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class Vector> CORRADE_ENABLE_SSE2 inline void rayRangeLoadSse2(const char* const* const data, const std::ptrdiff_t* const strides, const RayRangeLayout& layout, const std::size_t i, const std::size_t count, typename Vector::Type* const values, Float* const block) {
+    const std::size_t lanes = Vector::Lanes;
+    const bool full = count == lanes;
+    for(std::size_t c = 0; c != 12; ++c) {
+        if(!strides[c]) continue;
+        if(full && c < 3 && layout.packedOrigins) continue;
+        if(full && c >= 3 && c < 6 && layout.packedInverseDirections) continue;
+        if(full && c >= 6 && layout.packedRanges) continue;
+
+        const char* const in = data[c] + std::ptrdiff_t(i)*strides[c];
+        if(full && strides[c] == std::ptrdiff_t(sizeof(Float))) {
+            values[c] = Vector::load(reinterpret_cast<const Float*>(in), 4);
+            continue;
+        }
+        for(std::size_t l = 0; l != lanes; ++l)
+            block[l] = l < count ? *reinterpret_cast<const Float*>(in + std::ptrdiff_t(l)*strides[c]) : 0.0f;
+        values[c] = Vector::load(block, 4);
+    }
+
+    if(!full) return;
+    for(std::size_t c = 0; c != 6; c += 3) {
+        if(!(c ? layout.packedInverseDirections : layout.packedOrigins)) continue;
+        const Float* in = reinterpret_cast<const Float*>(data[c] + std::ptrdiff_t(i)*strides[c]);
+        const typename Vector::Type a0 = Vector::load(in, 12);
+        const typename Vector::Type a1 = Vector::load(in + 4, 12);
+        const typename Vector::Type a2 = Vector::load(in + 8, 12);
+        values[c + 0] = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        values[c + 1] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        values[c + 2] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+    }
+    if(layout.packedRanges) {
+        const Float* in = reinterpret_cast<const Float*>(data[6] + std::ptrdiff_t(i)*strides[6]);
+        const typename Vector::Type a0 = Vector::load(in, 24);
+        const typename Vector::Type a1 = Vector::load(in + 4, 24);
+        const typename Vector::Type a2 = Vector::load(in + 8, 24);
+        const typename Vector::Type b0 = Vector::load(in + 12, 24);
+        const typename Vector::Type b1 = Vector::load(in + 16, 24);
+        const typename Vector::Type b2 = Vector::load(in + 20, 24);
+        const typename Vector::Type aX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        const typename Vector::Type aY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        const typename Vector::Type aZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+        const typename Vector::Type bX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(b0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b1, b2));
+        const typename Vector::Type bY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b1, b2));
+        const typename Vector::Type bZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(b2, b2));
+        values[6] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aX, bX);
+        values[7] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aY, bY);
+        values[8] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aZ, bZ);
+        values[9] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aX, bX);
+        values[10] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aY, bY);
+        values[11] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aZ, bZ);
+    }
+}
+
+template<class Vector> CORRADE_ENABLE_SSE2 inline void rayRangeStoreSse2(char* const out, const std::ptrdiff_t stride, const std::size_t i, const std::size_t count, const typename Vector::Type value, Float* const block) {
+    char* const data = out + std::ptrdiff_t(i)*stride;
+    if(count == Vector::Lanes && stride == std::ptrdiff_t(sizeof(Float))) {
+        Vector::store(reinterpret_cast<Float*>(data), 4, value);
+        return;
+    }
+    Vector::store(block, 4, value);
+    for(std::size_t l = 0; l != count; ++l)
+        *reinterpret_cast<Float*>(data + std::ptrdiff_t(l)*stride) = block[l];
+}
+
+template<class Vector> CORRADE_ENABLE_SSE2 inline UnsignedInt rayRangeSlabsSse2(const typename Vector::Type* const values, typename Vector::Type& tNearValue, typename Vector::Type& tFarValue) {
+    for(std::size_t a = 0; a != 3; ++a) {
+        const typename Vector::Type t0 = Vector::mul(Vector::sub(values[6 + a], values[a]), values[3 + a]);
+        const typename Vector::Type t1 = Vector::mul(Vector::sub(values[9 + a], values[a]), values[3 + a]);
+        const typename Vector::Type low = Vector::min(t0, t1);
+        const typename Vector::Type high = Vector::max(t0, t1);
+        tNearValue = a ? Vector::max(tNearValue, low) : low;
+        tFarValue = a ? Vector::min(tFarValue, high) : high;
+    }
+    return Vector::bitMask(Vector::greaterEqual(tFarValue, tNearValue));
+}
+
+CORRADE_ENABLE_SSE2 void rayRangeIntoSse2(const char* const* const data, const std::ptrdiff_t* const strides, const std::size_t size, char* const tNear, const std::ptrdiff_t tNearStride, char* const tFar, const std::ptrdiff_t tFarStride, char* const hits, const std::size_t hitsOffset) {
+    typedef SoaSse2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const RayRangeLayout layout = rayRangeLayout(data, strides);
+    typename Vector::Type values[12];
+    for(std::size_t c = 0; c != 12; ++c)
+        if(!strides[c]) values[c] = Vector::splat(*reinterpret_cast<const Float*>(data[c]));
+    Float block[lanes];
+    typename Vector::Type tNearValue, tFarValue;
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            rayRangeLoadSse2<Vector>(data, strides, layout, i + k, lanes, values, block);
+            bits |= rayRangeSlabsSse2<Vector>(values, tNearValue, tFarValue) << k;
+            rayRangeStoreSse2<Vector>(tNear, tNearStride, i + k, lanes, tNearValue, block);
+            rayRangeStoreSse2<Vector>(tFar, tFarStride, i + k, lanes, tFarValue, block);
+        }
+        writeBits(hits, hitsOffset + i, bits, chunk);
+    }
+
+    for(; i < size; i += lanes) {
+        const std::size_t count = Math::min(size - i, lanes);
+        rayRangeLoadSse2<Vector>(data, strides, layout, i, count, values, block);
+        const UnsignedInt bits = rayRangeSlabsSse2<Vector>(values, tNearValue, tFarValue);
+        rayRangeStoreSse2<Vector>(tNear, tNearStride, i, count, tNearValue, block);
+        rayRangeStoreSse2<Vector>(tFar, tFarStride, i, count, tFarValue, block);
+        for(std::size_t l = 0; l != count; ++l) {
+            const std::size_t bit = hitsOffset + i + l;
+            if(bits & (1u << l))
+                hits[bit >> 3] |= char(1 << (bit & 0x07));
+            else
+                hits[bit >> 3] &= char(~(1 << (bit & 0x07)));
+        }
+    }
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+template<class Vector> CORRADE_ENABLE(AVX,AVX_FMA) inline void rayRangeLoadAvxFma(const char* const* const data, const std::ptrdiff_t* const strides, const RayRangeLayout& layout, const std::size_t i, const std::size_t count, typename Vector::Type* const values, Float* const block) {
+    const std::size_t lanes = Vector::Lanes;
+    const bool full = count == lanes;
+    for(std::size_t c = 0; c != 12; ++c) {
+        if(!strides[c]) continue;
+        if(full && c < 3 && layout.packedOrigins) continue;
+        if(full && c >= 3 && c < 6 && layout.packedInverseDirections) continue;
+        if(full && c >= 6 && layout.packedRanges) continue;
+
+        const char* const in = data[c] + std::ptrdiff_t(i)*strides[c];
+        if(full && strides[c] == std::ptrdiff_t(sizeof(Float))) {
+            values[c] = Vector::load(reinterpret_cast<const Float*>(in), 4);
+            continue;
+        }
+        for(std::size_t l = 0; l != lanes; ++l)
+            block[l] = l < count ? *reinterpret_cast<const Float*>(in + std::ptrdiff_t(l)*strides[c]) : 0.0f;
+        values[c] = Vector::load(block, 4);
+    }
+
+    if(!full) return;
+    for(std::size_t c = 0; c != 6; c += 3) {
+        if(!(c ? layout.packedInverseDirections : layout.packedOrigins)) continue;
+        const Float* in = reinterpret_cast<const Float*>(data[c] + std::ptrdiff_t(i)*strides[c]);
+        const typename Vector::Type a0 = Vector::load(in, 12);
+        const typename Vector::Type a1 = Vector::load(in + 4, 12);
+        const typename Vector::Type a2 = Vector::load(in + 8, 12);
+        values[c + 0] = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        values[c + 1] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        values[c + 2] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+    }
+    if(layout.packedRanges) {
+        const Float* in = reinterpret_cast<const Float*>(data[6] + std::ptrdiff_t(i)*strides[6]);
+        const typename Vector::Type a0 = Vector::load(in, 24);
+        const typename Vector::Type a1 = Vector::load(in + 4, 24);
+        const typename Vector::Type a2 = Vector::load(in + 8, 24);
+        const typename Vector::Type b0 = Vector::load(in + 12, 24);
+        const typename Vector::Type b1 = Vector::load(in + 16, 24);
+        const typename Vector::Type b2 = Vector::load(in + 20, 24);
+        const typename Vector::Type aX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        const typename Vector::Type aY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        const typename Vector::Type aZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+        const typename Vector::Type bX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(b0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b1, b2));
+        const typename Vector::Type bY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b1, b2));
+        const typename Vector::Type bZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(b2, b2));
+        values[6] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aX, bX);
+        values[7] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aY, bY);
+        values[8] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aZ, bZ);
+        values[9] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aX, bX);
+        values[10] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aY, bY);
+        values[11] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aZ, bZ);
+    }
+}
+
+template<class Vector> CORRADE_ENABLE(AVX,AVX_FMA) inline void rayRangeStoreAvxFma(char* const out, const std::ptrdiff_t stride, const std::size_t i, const std::size_t count, const typename Vector::Type value, Float* const block) {
+    char* const data = out + std::ptrdiff_t(i)*stride;
+    if(count == Vector::Lanes && stride == std::ptrdiff_t(sizeof(Float))) {
+        Vector::store(reinterpret_cast<Float*>(data), 4, value);
+        return;
+    }
+    Vector::store(block, 4, value);
+    for(std::size_t l = 0; l != count; ++l)
+        *reinterpret_cast<Float*>(data + std::ptrdiff_t(l)*stride) = block[l];
+}
+
+template<class Vector> CORRADE_ENABLE(AVX,AVX_FMA) inline UnsignedInt rayRangeSlabsAvxFma(const typename Vector::Type* const values, typename Vector::Type& tNearValue, typename Vector::Type& tFarValue) {
+    for(std::size_t a = 0; a != 3; ++a) {
+        const typename Vector::Type t0 = Vector::mul(Vector::sub(values[6 + a], values[a]), values[3 + a]);
+        const typename Vector::Type t1 = Vector::mul(Vector::sub(values[9 + a], values[a]), values[3 + a]);
+        const typename Vector::Type low = Vector::min(t0, t1);
+        const typename Vector::Type high = Vector::max(t0, t1);
+        tNearValue = a ? Vector::max(tNearValue, low) : low;
+        tFarValue = a ? Vector::min(tFarValue, high) : high;
+    }
+    return Vector::bitMask(Vector::greaterEqual(tFarValue, tNearValue));
+}
+
+CORRADE_ENABLE(AVX,AVX_FMA) void rayRangeIntoAvxFma(const char* const* const data, const std::ptrdiff_t* const strides, const std::size_t size, char* const tNear, const std::ptrdiff_t tNearStride, char* const tFar, const std::ptrdiff_t tFarStride, char* const hits, const std::size_t hitsOffset) {
+    typedef SoaAvxFma Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const RayRangeLayout layout = rayRangeLayout(data, strides);
+    typename Vector::Type values[12];
+    for(std::size_t c = 0; c != 12; ++c)
+        if(!strides[c]) values[c] = Vector::splat(*reinterpret_cast<const Float*>(data[c]));
+    Float block[lanes];
+    typename Vector::Type tNearValue, tFarValue;
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            rayRangeLoadAvxFma<Vector>(data, strides, layout, i + k, lanes, values, block);
+            bits |= rayRangeSlabsAvxFma<Vector>(values, tNearValue, tFarValue) << k;
+            rayRangeStoreAvxFma<Vector>(tNear, tNearStride, i + k, lanes, tNearValue, block);
+            rayRangeStoreAvxFma<Vector>(tFar, tFarStride, i + k, lanes, tFarValue, block);
+        }
+        writeBits(hits, hitsOffset + i, bits, chunk);
+    }
+
+    for(; i < size; i += lanes) {
+        const std::size_t count = Math::min(size - i, lanes);
+        rayRangeLoadAvxFma<Vector>(data, strides, layout, i, count, values, block);
+        const UnsignedInt bits = rayRangeSlabsAvxFma<Vector>(values, tNearValue, tFarValue);
+        rayRangeStoreAvxFma<Vector>(tNear, tNearStride, i, count, tNearValue, block);
+        rayRangeStoreAvxFma<Vector>(tFar, tFarStride, i, count, tFarValue, block);
+        for(std::size_t l = 0; l != count; ++l) {
+            const std::size_t bit = hitsOffset + i + l;
+            if(bits & (1u << l))
+                hits[bit >> 3] |= char(1 << (bit & 0x07));
+            else
+                hits[bit >> 3] &= char(~(1 << (bit & 0x07)));
+        }
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+template<class Vector> CORRADE_ENABLE_AVX512F inline void rayRangeLoadAvx512(const char* const* const data, const std::ptrdiff_t* const strides, const RayRangeLayout& layout, const std::size_t i, const std::size_t count, typename Vector::Type* const values, Float* const block) {
+    const std::size_t lanes = Vector::Lanes;
+    const bool full = count == lanes;
+    for(std::size_t c = 0; c != 12; ++c) {
+        if(!strides[c]) continue;
+        if(full && c < 3 && layout.packedOrigins) continue;
+        if(full && c >= 3 && c < 6 && layout.packedInverseDirections) continue;
+        if(full && c >= 6 && layout.packedRanges) continue;
+
+        const char* const in = data[c] + std::ptrdiff_t(i)*strides[c];
+        if(full && strides[c] == std::ptrdiff_t(sizeof(Float))) {
+            values[c] = Vector::load(reinterpret_cast<const Float*>(in), 4);
+            continue;
+        }
+        for(std::size_t l = 0; l != lanes; ++l)
+            block[l] = l < count ? *reinterpret_cast<const Float*>(in + std::ptrdiff_t(l)*strides[c]) : 0.0f;
+        values[c] = Vector::load(block, 4);
+    }
+
+    if(!full) return;
+    for(std::size_t c = 0; c != 6; c += 3) {
+        if(!(c ? layout.packedInverseDirections : layout.packedOrigins)) continue;
+        const Float* in = reinterpret_cast<const Float*>(data[c] + std::ptrdiff_t(i)*strides[c]);
+        const typename Vector::Type a0 = Vector::load(in, 12);
+        const typename Vector::Type a1 = Vector::load(in + 4, 12);
+        const typename Vector::Type a2 = Vector::load(in + 8, 12);
+        values[c + 0] = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        values[c + 1] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        values[c + 2] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+    }
+    if(layout.packedRanges) {
+        const Float* in = reinterpret_cast<const Float*>(data[6] + std::ptrdiff_t(i)*strides[6]);
+        const typename Vector::Type a0 = Vector::load(in, 24);
+        const typename Vector::Type a1 = Vector::load(in + 4, 24);
+        const typename Vector::Type a2 = Vector::load(in + 8, 24);
+        const typename Vector::Type b0 = Vector::load(in + 12, 24);
+        const typename Vector::Type b1 = Vector::load(in + 16, 24);
+        const typename Vector::Type b2 = Vector::load(in + 20, 24);
+        const typename Vector::Type aX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        const typename Vector::Type aY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        const typename Vector::Type aZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+        const typename Vector::Type bX = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(b0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(b1, b2));
+        const typename Vector::Type bY = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(b1, b2));
+        const typename Vector::Type bZ = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(b0, b1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(b2, b2));
+        values[6] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aX, bX);
+        values[7] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aY, bY);
+        values[8] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(aZ, bZ);
+        values[9] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aX, bX);
+        values[10] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aY, bY);
+        values[11] = Vector::template shuffle<_MM_SHUFFLE(3, 1, 3, 1)>(aZ, bZ);
+    }
+}
+
+template<class Vector> CORRADE_ENABLE_AVX512F inline void rayRangeStoreAvx512(char* const out, const std::ptrdiff_t stride, const std::size_t i, const std::size_t count, const typename Vector::Type value, Float* const block) {
+    char* const data = out + std::ptrdiff_t(i)*stride;
+    if(count == Vector::Lanes && stride == std::ptrdiff_t(sizeof(Float))) {
+        Vector::store(reinterpret_cast<Float*>(data), 4, value);
+        return;
+    }
+    Vector::store(block, 4, value);
+    for(std::size_t l = 0; l != count; ++l)
+        *reinterpret_cast<Float*>(data + std::ptrdiff_t(l)*stride) = block[l];
+}
+
+template<class Vector> CORRADE_ENABLE_AVX512F inline UnsignedInt rayRangeSlabsAvx512(const typename Vector::Type* const values, typename Vector::Type& tNearValue, typename Vector::Type& tFarValue) {
+    for(std::size_t a = 0; a != 3; ++a) {
+        const typename Vector::Type t0 = Vector::mul(Vector::sub(values[6 + a], values[a]), values[3 + a]);
+        const typename Vector::Type t1 = Vector::mul(Vector::sub(values[9 + a], values[a]), values[3 + a]);
+        const typename Vector::Type low = Vector::min(t0, t1);
+        const typename Vector::Type high = Vector::max(t0, t1);
+        tNearValue = a ? Vector::max(tNearValue, low) : low;
+        tFarValue = a ? Vector::min(tFarValue, high) : high;
+    }
+    return Vector::bitMask(Vector::greaterEqual(tFarValue, tNearValue));
+}
+
+CORRADE_ENABLE_AVX512F void rayRangeIntoAvx512(const char* const* const data, const std::ptrdiff_t* const strides, const std::size_t size, char* const tNear, const std::ptrdiff_t tNearStride, char* const tFar, const std::ptrdiff_t tFarStride, char* const hits, const std::size_t hitsOffset) {
+    typedef SoaAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const RayRangeLayout layout = rayRangeLayout(data, strides);
+    typename Vector::Type values[12];
+    for(std::size_t c = 0; c != 12; ++c)
+        if(!strides[c]) values[c] = Vector::splat(*reinterpret_cast<const Float*>(data[c]));
+    Float block[lanes];
+    typename Vector::Type tNearValue, tFarValue;
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            rayRangeLoadAvx512<Vector>(data, strides, layout, i + k, lanes, values, block);
+            bits |= rayRangeSlabsAvx512<Vector>(values, tNearValue, tFarValue) << k;
+            rayRangeStoreAvx512<Vector>(tNear, tNearStride, i + k, lanes, tNearValue, block);
+            rayRangeStoreAvx512<Vector>(tFar, tFarStride, i + k, lanes, tFarValue, block);
+        }
+        writeBits(hits, hitsOffset + i, bits, chunk);
+    }
+
+    for(; i < size; i += lanes) {
+        const std::size_t count = Math::min(size - i, lanes);
+        rayRangeLoadAvx512<Vector>(data, strides, layout, i, count, values, block);
+        const UnsignedInt bits = rayRangeSlabsAvx512<Vector>(values, tNearValue, tFarValue);
+        rayRangeStoreAvx512<Vector>(tNear, tNearStride, i, count, tNearValue, block);
+        rayRangeStoreAvx512<Vector>(tFar, tFarStride, i, count, tFarValue, block);
+        for(std::size_t l = 0; l != count; ++l) {
+            const std::size_t bit = hitsOffset + i + l;
+            if(bits & (1u << l))
+                hits[bit >> 3] |= char(1 << (bit & 0x07));
+            else
+                hits[bit >> 3] &= char(~(1 << (bit & 0x07)));
+        }
+    }
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(rayRangeInto)>::type rayRangeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return rayRangeIntoSse2;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(rayRangeInto)>::type rayRangeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return rayRangeIntoAvxFma;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(rayRangeInto)>::type rayRangeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return rayRangeIntoAvx512;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(rayRangeInto)>::type rayRangeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return rayRangeIntoScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(rayRangeIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(rayRangeIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(rayRangeIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(rayRangeInto)(const char* const* data, const std::ptrdiff_t* strides, std::size_t size, char* tNear, std::ptrdiff_t tNearStride, char* tFar, std::ptrdiff_t tFarStride, char* hits, std::size_t hitsOffset))({
+    rayRangeIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(data, strides, size, tNear, tNearStride, tFar, tFarStride, hits, hitsOffset);
+})
+
+}
+
+namespace {
+
+void rayRangeIntoImplementation(const char* const* const data, const std::ptrdiff_t* const strides, const std::size_t size, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits) {
+    CORRADE_ASSERT(tNear.size() == size && tFar.size() == size,
+        "Math::Intersection::rayRangeInto(): wrong distance destination size, got" << tNear.size() << "and" << tFar.size() << "but expected" << size, );
+    CORRADE_ASSERT(hits.size()[0] == size,
+        "Math::Intersection::rayRangeInto(): wrong hit destination size, got" << hits.size()[0] << "but expected" << size, );
+
+    char* const tNearData = static_cast<char*>(tNear.data());
+    char* const tFarData = static_cast<char*>(tFar.data());
+    if(hits.isContiguous()) {
+        Implementation::rayRangeInto(data, strides, size, tNearData, tNear.stride(), tFarData, tFar.stride(), static_cast<char*>(hits.data()), hits.offset());
+        return;
+    }
+
+    char bits[64];
+    const char* chunkData[12];
+    for(std::size_t i = 0; i < size; i += sizeof(bits)*8) {
+        const std::size_t chunkSize = Math::min(size - i, sizeof(bits)*8);
+        for(std::size_t c = 0; c != 12; ++c)
+            chunkData[c] = data[c] + std::ptrdiff_t(i)*strides[c];
+        Implementation::rayRangeInto(chunkData, strides, chunkSize, tNearData + std::ptrdiff_t(i)*tNear.stride(), tNear.stride(), tFarData + std::ptrdiff_t(i)*tFar.stride(), tFar.stride(), bits, 0);
+        for(std::size_t j = 0; j != chunkSize; ++j)
+            hits.set(i + j, bits[j >> 3] & (1 << (j & 0x07)));
+    }
+}
+
+}
+
+namespace Intersection {
+
+void rayRangeInto(const Vector3<Float>& rayOrigin, const Vector3<Float>& inverseRayDirection, const Containers::StridedArrayView1D<const Range3D<Float>>& ranges, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits) {
+    const char* const rangeData = static_cast<const char*>(ranges.data());
+    const char* const data[12]{
+        reinterpret_cast<const char*>(rayOrigin.data()),
+        reinterpret_cast<const char*>(rayOrigin.data() + 1),
+        reinterpret_cast<const char*>(rayOrigin.data() + 2),
+        reinterpret_cast<const char*>(inverseRayDirection.data()),
+        reinterpret_cast<const char*>(inverseRayDirection.data() + 1),
+        reinterpret_cast<const char*>(inverseRayDirection.data() + 2),
+        rangeData, rangeData + 4, rangeData + 8,
+        rangeData + 12, rangeData + 16, rangeData + 20};
+    const std::ptrdiff_t s = ranges.stride();
+    const std::ptrdiff_t strides[12]{0, 0, 0, 0, 0, 0, s, s, s, s, s, s};
+    rayRangeIntoImplementation(data, strides, ranges.size(), tNear, tFar, hits);
+}
+
+void rayRangeInto(const Vector3<Float>& rayOrigin, const Vector3<Float>& inverseRayDirection, const Containers::StridedArrayView2D<const Float>& rangeMin, const Containers::StridedArrayView2D<const Float>& rangeMax, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits) {
+    CORRADE_ASSERT(rangeMin.size()[0] == 3 && rangeMax.size()[0] == 3,
+        "Math::Intersection::rayRangeInto(): expected range min and max views to have three components but got" << rangeMin.size()[0] << "and" << rangeMax.size()[0], );
+    CORRADE_ASSERT(rangeMin.size()[1] == rangeMax.size()[1],
+        "Math::Intersection::rayRangeInto(): expected range min and max views to have the same size but got" << rangeMin.size()[1] << "and" << rangeMax.size()[1], );
+    const char* const minData = static_cast<const char*>(rangeMin.data());
+    const char* const maxData = static_cast<const char*>(rangeMax.data());
+    const char* const data[12]{
+        reinterpret_cast<const char*>(rayOrigin.data()),
+        reinterpret_cast<const char*>(rayOrigin.data() + 1),
+        reinterpret_cast<const char*>(rayOrigin.data() + 2),
+        reinterpret_cast<const char*>(inverseRayDirection.data()),
+        reinterpret_cast<const char*>(inverseRayDirection.data() + 1),
+        reinterpret_cast<const char*>(inverseRayDirection.data() + 2),
+        minData, minData + rangeMin.stride()[0], minData + 2*rangeMin.stride()[0],
+        maxData, maxData + rangeMax.stride()[0], maxData + 2*rangeMax.stride()[0]};
+    const std::ptrdiff_t minStride = rangeMin.stride()[1];
+    const std::ptrdiff_t maxStride = rangeMax.stride()[1];
+    const std::ptrdiff_t strides[12]{0, 0, 0, 0, 0, 0, minStride, minStride, minStride, maxStride, maxStride, maxStride};
+    rayRangeIntoImplementation(data, strides, rangeMin.size()[1], tNear, tFar, hits);
+}
+
+void rayRangeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& rayOrigins, const Containers::StridedArrayView1D<const Vector3<Float>>& inverseRayDirections, const Range3D<Float>& range, const Containers::StridedArrayView1D<Float>& tNear, const Containers::StridedArrayView1D<Float>& tFar, const Containers::MutableStridedBitArrayView1D& hits) {
+    CORRADE_ASSERT(rayOrigins.size() == inverseRayDirections.size(),
+        "Math::Intersection::rayRangeInto(): expected ray origin and inverse direction views to have the same size but got" << rayOrigins.size() << "and" << inverseRayDirections.size(), );
+    const char* const originData = static_cast<const char*>(rayOrigins.data());
+    const char* const directionData = static_cast<const char*>(inverseRayDirections.data());
+    const Vector3<Float> rangeMin = range.min();
+    const Vector3<Float> rangeMax = range.max();
+    const char* const data[12]{
+        originData, originData + 4, originData + 8,
+        directionData, directionData + 4, directionData + 8,
+        reinterpret_cast<const char*>(rangeMin.data()),
+        reinterpret_cast<const char*>(rangeMin.data() + 1),
+        reinterpret_cast<const char*>(rangeMin.data() + 2),
+        reinterpret_cast<const char*>(rangeMax.data()),
+        reinterpret_cast<const char*>(rangeMax.data() + 1),
+        reinterpret_cast<const char*>(rangeMax.data() + 2)};
+    const std::ptrdiff_t o = rayOrigins.stride();
+    const std::ptrdiff_t d = inverseRayDirections.stride();
+    const std::ptrdiff_t strides[12]{o, o, o, d, d, d, 0, 0, 0, 0, 0, 0};
+    rayRangeIntoImplementation(data, strides, rayOrigins.size(), tNear, tFar, hits);
+}
+
+}
+
+namespace Implementation {
+
+struct SphereConeParameters {
+    Vector3<Float> origin;
+    Vector3<Float> normal;
+    Float sinAngle;
+    Float sinAngleNormalDot;
+    Float tanAngleSqPlusOne;
+};
+
+struct SphereConeViewParameters {
+    Matrix4<Float> view;
+    Float sinAngle;
+    Float tanAngle;
+};
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sphereFrustumInto)(const Frustum<Float>& parameters, const char* centers, std::ptrdiff_t centerStride, const char* radii, std::ptrdiff_t radiusStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sphereConeInto)(const SphereConeParameters& parameters, const char* centers, std::ptrdiff_t centerStride, const char* radii, std::ptrdiff_t radiusStride, std::size_t size, char* dst, std::size_t dstOffset);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sphereConeViewInto)(const SphereConeViewParameters& parameters, const char* centers, std::ptrdiff_t centerStride, const char* radii, std::ptrdiff_t radiusStride, std::size_t size, char* dst, std::size_t dstOffset);
+
+namespace {
+
+inline bool sphereTestScalar(const Frustum<Float>& frustum, const Vector3<Float>& center, const Float radius) {
+    return Intersection::sphereFrustum(center, radius, frustum);
+}
+
+inline bool sphereTestScalar(const SphereConeParameters& cone, const Vector3<Float>& center, const Float radius) {
+    const Vector3<Float> diff = center - cone.origin;
+    const Float normalDot = diff.x()*cone.normal.x() + diff.y()*cone.normal.y() + diff.z()*cone.normal.z();
+    const Vector3<Float> c = diff*cone.sinAngle + cone.normal*radius;
+    const Float lenA = c.x()*cone.normal.x() + c.y()*cone.normal.y() + c.z()*cone.normal.z();
+    if(normalDot - radius*cone.sinAngleNormalDot > 0.0f)
+        return c.x()*c.x() + c.y()*c.y() + c.z()*c.z() <= lenA*lenA*cone.tanAngleSqPlusOne;
+    return diff.x()*diff.x() + diff.y()*diff.y() + diff.z()*diff.z() <= radius*radius;
+}
+
+inline bool sphereTestScalar(const SphereConeViewParameters& cone, const Vector3<Float>& center, const Float radius) {
+    const Matrix4<Float>& m = cone.view;
+    const Float x = m[0][0]*center.x() + m[1][0]*center.y() + m[2][0]*center.z() + m[3][0];
+    const Float y = m[0][1]*center.x() + m[1][1]*center.y() + m[2][1]*center.z() + m[3][1];
+    const Float z = m[0][2]*center.x() + m[1][2]*center.y() + m[2][2]*center.z() + m[3][2];
+    const Float xyDot = x*x + y*y;
+    if(z < radius*cone.sinAngle) {
+        const Float coneRadius = cone.tanAngle*(z - radius/cone.sinAngle);
+        return xyDot <= coneRadius*coneRadius;
+    }
+    return xyDot + z*z <= radius*radius;
+}
+
+template<class T> void sphereIntoScalar(const T& parameters, const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const std::size_t bit = dstOffset + i;
+        const Vector3<Float>& center = *reinterpret_cast<const Vector3<Float>*>(centers + std::ptrdiff_t(i)*centerStride);
+        const Float radius = *reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i)*radiusStride);
+        if(sphereTestScalar(parameters, center, radius))
+            dst[bit >> 3] |= char(1 << (bit & 0x07));
+        else
+            dst[bit >> 3] &= char(~(1 << (bit & 0x07)));
+    }
+}
+
+enum class SphereLayout {
+    Strided,
+    PackedCenters,
+    PackedSpheres
+};
+
+inline SphereLayout sphereLayout(const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride) {
+    if(centerStride == 4*sizeof(Float) && radiusStride == 4*sizeof(Float) && radii == centers + 3*sizeof(Float))
+        return SphereLayout::PackedSpheres;
+    if(centerStride == 3*sizeof(Float))
+        return SphereLayout::PackedCenters;
+    return SphereLayout::Strided;
+}
+
+#ifdef CORRADE_ENABLE_SSE2
+template<class Vector> CORRADE_ENABLE_SSE2 inline void sphereLoadSse2(const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const SphereLayout layout, const std::size_t i, const std::size_t count, typename Vector::Type* const values, Float* const block) {
+    const std::size_t lanes = Vector::Lanes;
+    const bool full = count == lanes;
+    if(full && layout == SphereLayout::PackedSpheres) {
+        const Float* const in = reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i)*centerStride);
+        const typename Vector::Type r0 = Vector::load(in, 16);
+        const typename Vector::Type r1 = Vector::load(in + 4, 16);
+        const typename Vector::Type r2 = Vector::load(in + 8, 16);
+        const typename Vector::Type r3 = Vector::load(in + 12, 16);
+        const typename Vector::Type t0 = Vector::unpackLo(r0, r1);
+        const typename Vector::Type t1 = Vector::unpackLo(r2, r3);
+        const typename Vector::Type t2 = Vector::unpackHi(r0, r1);
+        const typename Vector::Type t3 = Vector::unpackHi(r2, r3);
+        values[0] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+        values[1] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+        values[2] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+        values[3] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+        return;
+    }
+
+    if(full && layout == SphereLayout::PackedCenters) {
+        const Float* const in = reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i)*centerStride);
+        const typename Vector::Type a0 = Vector::load(in, 12);
+        const typename Vector::Type a1 = Vector::load(in + 4, 12);
+        const typename Vector::Type a2 = Vector::load(in + 8, 12);
+        values[0] = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        values[1] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        values[2] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+    } else for(std::size_t c = 0; c != 3; ++c) {
+        for(std::size_t l = 0; l != lanes; ++l)
+            block[l] = l < count ? reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i + l)*centerStride)[c] : 0.0f;
+        values[c] = Vector::load(block, 4);
+    }
+
+    if(full && radiusStride == std::ptrdiff_t(sizeof(Float))) {
+        values[3] = Vector::load(reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i)*radiusStride), 4);
+        return;
+    }
+    for(std::size_t l = 0; l != lanes; ++l)
+        block[l] = l < count ? *reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i + l)*radiusStride) : 0.0f;
+    values[3] = Vector::load(block, 4);
+}
+
+template<class Vector> struct SphereFrustumSse2 {
+    CORRADE_ENABLE_SSE2 explicit SphereFrustumSse2(const Frustum<Float>& frustum) {
+        for(std::size_t p = 0; p != 6; ++p) {
+            planeX[p] = Vector::splat(frustum[p].x());
+            planeY[p] = Vector::splat(frustum[p].y());
+            planeZ[p] = Vector::splat(frustum[p].z());
+            planeW[p] = Vector::splat(frustum[p].w());
+        }
+    }
+
+    CORRADE_ENABLE_SSE2 UnsignedInt operator()(const typename Vector::Type* const values) const {
+        const UnsignedInt allLanes = UnsignedInt((1ull << Vector::Lanes) - 1);
+        const typename Vector::Type minusRadiusSq = Vector::sub(Vector::splat(0.0f), Vector::mul(values[3], values[3]));
+        UnsignedInt culled = 0;
+        for(std::size_t p = 0; p != 6 && culled != allLanes; ++p) {
+            const typename Vector::Type d = Vector::add(Vector::add(Vector::add(Vector::mul(planeX[p], values[0]), Vector::mul(planeY[p], values[1])), Vector::mul(planeZ[p], values[2])), planeW[p]);
+            culled |= Vector::bitMask(Vector::lessThan(d, minusRadiusSq));
+        }
+        return ~culled & allLanes;
+    }
+
+    typename Vector::Type planeX[6], planeY[6], planeZ[6], planeW[6];
+};
+
+template<class Vector> struct SphereConeSse2 {
+    CORRADE_ENABLE_SSE2 explicit SphereConeSse2(const SphereConeParameters& cone): originX{Vector::splat(cone.origin.x())}, originY{Vector::splat(cone.origin.y())}, originZ{Vector::splat(cone.origin.z())}, normalX{Vector::splat(cone.normal.x())}, normalY{Vector::splat(cone.normal.y())}, normalZ{Vector::splat(cone.normal.z())}, sinAngle{Vector::splat(cone.sinAngle)}, sinAngleNormalDot{Vector::splat(cone.sinAngleNormalDot)}, tanAngleSqPlusOne{Vector::splat(cone.tanAngleSqPlusOne)}, zero{Vector::splat(0.0f)} {}
+
+    CORRADE_ENABLE_SSE2 UnsignedInt operator()(const typename Vector::Type* const values) const {
+        const typename Vector::Type diffX = Vector::sub(values[0], originX);
+        const typename Vector::Type diffY = Vector::sub(values[1], originY);
+        const typename Vector::Type diffZ = Vector::sub(values[2], originZ);
+        const typename Vector::Type radius = values[3];
+        const typename Vector::Type normalDot = Vector::add(Vector::add(Vector::mul(diffX, normalX), Vector::mul(diffY, normalY)), Vector::mul(diffZ, normalZ));
+        const typename Vector::Type cX = Vector::add(Vector::mul(diffX, sinAngle), Vector::mul(normalX, radius));
+        const typename Vector::Type cY = Vector::add(Vector::mul(diffY, sinAngle), Vector::mul(normalY, radius));
+        const typename Vector::Type cZ = Vector::add(Vector::mul(diffZ, sinAngle), Vector::mul(normalZ, radius));
+        const typename Vector::Type lenA = Vector::add(Vector::add(Vector::mul(cX, normalX), Vector::mul(cY, normalY)), Vector::mul(cZ, normalZ));
+        const typename Vector::Type cDot = Vector::add(Vector::add(Vector::mul(cX, cX), Vector::mul(cY, cY)), Vector::mul(cZ, cZ));
+        const typename Vector::Type diffDot = Vector::add(Vector::add(Vector::mul(diffX, diffX), Vector::mul(diffY, diffY)), Vector::mul(diffZ, diffZ));
+        const UnsignedInt front = Vector::bitMask(Vector::greaterThan(Vector::sub(normalDot, Vector::mul(radius, sinAngleNormalDot)), zero));
+        const UnsignedInt insideCone = Vector::bitMask(Vector::greaterEqual(Vector::mul(Vector::mul(lenA, lenA), tanAngleSqPlusOne), cDot));
+        const UnsignedInt insideSphere = Vector::bitMask(Vector::greaterEqual(Vector::mul(radius, radius), diffDot));
+        return (front & insideCone) | (~front & insideSphere);
+    }
+
+    typename Vector::Type originX, originY, originZ, normalX, normalY, normalZ, sinAngle, sinAngleNormalDot, tanAngleSqPlusOne, zero;
+};
+
+template<class Vector> struct SphereConeViewSse2 {
+    CORRADE_ENABLE_SSE2 explicit SphereConeViewSse2(const SphereConeViewParameters& cone): sinAngle{Vector::splat(cone.sinAngle)}, tanAngle{Vector::splat(cone.tanAngle)} {
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 3; ++row)
+                view[col][row] = Vector::splat(cone.view[col][row]);
+    }
+
+    CORRADE_ENABLE_SSE2 UnsignedInt operator()(const typename Vector::Type* const values) const {
+        typename Vector::Type transformed[3];
+        for(std::size_t row = 0; row != 3; ++row)
+            transformed[row] = Vector::add(Vector::add(Vector::add(Vector::mul(view[0][row], values[0]), Vector::mul(view[1][row], values[1])), Vector::mul(view[2][row], values[2])), view[3][row]);
+        const typename Vector::Type radius = values[3];
+        const typename Vector::Type xyDot = Vector::add(Vector::mul(transformed[0], transformed[0]), Vector::mul(transformed[1], transformed[1]));
+        const typename Vector::Type coneRadius = Vector::mul(tanAngle, Vector::sub(transformed[2], Vector::div(radius, sinAngle)));
+        const UnsignedInt front = Vector::bitMask(Vector::lessThan(transformed[2], Vector::mul(radius, sinAngle)));
+        const UnsignedInt insideCone = Vector::bitMask(Vector::greaterEqual(Vector::mul(coneRadius, coneRadius), xyDot));
+        const UnsignedInt insideSphere = Vector::bitMask(Vector::greaterEqual(Vector::mul(radius, radius), Vector::add(xyDot, Vector::mul(transformed[2], transformed[2]))));
+        return (front & insideCone) | (~front & insideSphere);
+    }
+
+    typename Vector::Type view[4][3];
+    typename Vector::Type sinAngle, tanAngle;
+};
+
+template<class Test, class Parameters> CORRADE_ENABLE_SSE2 void sphereIntoSse2(const Parameters& parameters, const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef SoaSse2 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const SphereLayout layout = sphereLayout(centers, centerStride, radii, radiusStride);
+    const Test test{parameters};
+    typename Vector::Type values[4];
+    Float block[lanes];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            sphereLoadSse2<Vector>(centers, centerStride, radii, radiusStride, layout, i + k, lanes, values, block);
+            bits |= test(values) << k;
         }
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
 
-        srcPtr += srcStride;
-        dstPtr += dstStride;
+    for(; i < size; i += lanes) {
+        const std::size_t count = Math::min(size - i, lanes);
+        sphereLoadSse2<Vector>(centers, centerStride, radii, radiusStride, layout, i, count, values, block);
+        const UnsignedInt bits = test(values);
+        for(std::size_t l = 0; l != count; ++l) {
+            const std::size_t bit = dstOffset + i + l;
+            if(bits & (1u << l))
+                dst[bit >> 3] |= char(1 << (bit & 0x07));
+            else
+                dst[bit >> 3] &= char(~(1 << (bit & 0x07)));
+        }
+    }
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+template<class Vector> CORRADE_ENABLE(AVX,AVX_FMA) inline void sphereLoadAvxFma(const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const SphereLayout layout, const std::size_t i, const std::size_t count, typename Vector::Type* const values, Float* const block) {
+    const std::size_t lanes = Vector::Lanes;
+    const bool full = count == lanes;
+    if(full && layout == SphereLayout::PackedSpheres) {
+        const Float* const in = reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i)*centerStride);
+        const typename Vector::Type r0 = Vector::load(in, 16);
+        const typename Vector::Type r1 = Vector::load(in + 4, 16);
+        const typename Vector::Type r2 = Vector::load(in + 8, 16);
+        const typename Vector::Type r3 = Vector::load(in + 12, 16);
+        const typename Vector::Type t0 = Vector::unpackLo(r0, r1);
+        const typename Vector::Type t1 = Vector::unpackLo(r2, r3);
+        const typename Vector::Type t2 = Vector::unpackHi(r0, r1);
+        const typename Vector::Type t3 = Vector::unpackHi(r2, r3);
+        values[0] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+        values[1] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+        values[2] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+        values[3] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+        return;
+    }
+
+    if(full && layout == SphereLayout::PackedCenters) {
+        const Float* const in = reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i)*centerStride);
+        const typename Vector::Type a0 = Vector::load(in, 12);
+        const typename Vector::Type a1 = Vector::load(in + 4, 12);
+        const typename Vector::Type a2 = Vector::load(in + 8, 12);
+        values[0] = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        values[1] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        values[2] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+    } else for(std::size_t c = 0; c != 3; ++c) {
+        for(std::size_t l = 0; l != lanes; ++l)
+            block[l] = l < count ? reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i + l)*centerStride)[c] : 0.0f;
+        values[c] = Vector::load(block, 4);
+    }
+
+    if(full && radiusStride == std::ptrdiff_t(sizeof(Float))) {
+        values[3] = Vector::load(reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i)*radiusStride), 4);
+        return;
+    }
+    for(std::size_t l = 0; l != lanes; ++l)
+        block[l] = l < count ? *reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i + l)*radiusStride) : 0.0f;
+    values[3] = Vector::load(block, 4);
+}
+
+template<class Vector> struct SphereFrustumAvxFma {
+    CORRADE_ENABLE(AVX,AVX_FMA) explicit SphereFrustumAvxFma(const Frustum<Float>& frustum) {
+        for(std::size_t p = 0; p != 6; ++p) {
+            planeX[p] = Vector::splat(frustum[p].x());
+            planeY[p] = Vector::splat(frustum[p].y());
+            planeZ[p] = Vector::splat(frustum[p].z());
+            planeW[p] = Vector::splat(frustum[p].w());
+        }
+    }
+
+    CORRADE_ENABLE(AVX,AVX_FMA) UnsignedInt operator()(const typename Vector::Type* const values) const {
+        const UnsignedInt allLanes = UnsignedInt((1ull << Vector::Lanes) - 1);
+        const typename Vector::Type minusRadiusSq = Vector::sub(Vector::splat(0.0f), Vector::mul(values[3], values[3]));
+        UnsignedInt culled = 0;
+        for(std::size_t p = 0; p != 6 && culled != allLanes; ++p) {
+            const typename Vector::Type d = Vector::add(Vector::add(Vector::add(Vector::mul(planeX[p], values[0]), Vector::mul(planeY[p], values[1])), Vector::mul(planeZ[p], values[2])), planeW[p]);
+            culled |= Vector::bitMask(Vector::lessThan(d, minusRadiusSq));
+        }
+        return ~culled & allLanes;
+    }
+
+    typename Vector::Type planeX[6], planeY[6], planeZ[6], planeW[6];
+};
+
+template<class Vector> struct SphereConeAvxFma {
+    CORRADE_ENABLE(AVX,AVX_FMA) explicit SphereConeAvxFma(const SphereConeParameters& cone): originX{Vector::splat(cone.origin.x())}, originY{Vector::splat(cone.origin.y())}, originZ{Vector::splat(cone.origin.z())}, normalX{Vector::splat(cone.normal.x())}, normalY{Vector::splat(cone.normal.y())}, normalZ{Vector::splat(cone.normal.z())}, sinAngle{Vector::splat(cone.sinAngle)}, sinAngleNormalDot{Vector::splat(cone.sinAngleNormalDot)}, tanAngleSqPlusOne{Vector::splat(cone.tanAngleSqPlusOne)}, zero{Vector::splat(0.0f)} {}
+
+    CORRADE_ENABLE(AVX,AVX_FMA) UnsignedInt operator()(const typename Vector::Type* const values) const {
+        const typename Vector::Type diffX = Vector::sub(values[0], originX);
+        const typename Vector::Type diffY = Vector::sub(values[1], originY);
+        const typename Vector::Type diffZ = Vector::sub(values[2], originZ);
+        const typename Vector::Type radius = values[3];
+        const typename Vector::Type normalDot = Vector::add(Vector::add(Vector::mul(diffX, normalX), Vector::mul(diffY, normalY)), Vector::mul(diffZ, normalZ));
+        const typename Vector::Type cX = Vector::add(Vector::mul(diffX, sinAngle), Vector::mul(normalX, radius));
+        const typename Vector::Type cY = Vector::add(Vector::mul(diffY, sinAngle), Vector::mul(normalY, radius));
+        const typename Vector::Type cZ = Vector::add(Vector::mul(diffZ, sinAngle), Vector::mul(normalZ, radius));
+        const typename Vector::Type lenA = Vector::add(Vector::add(Vector::mul(cX, normalX), Vector::mul(cY, normalY)), Vector::mul(cZ, normalZ));
+        const typename Vector::Type cDot = Vector::add(Vector::add(Vector::mul(cX, cX), Vector::mul(cY, cY)), Vector::mul(cZ, cZ));
+        const typename Vector::Type diffDot = Vector::add(Vector::add(Vector::mul(diffX, diffX), Vector::mul(diffY, diffY)), Vector::mul(diffZ, diffZ));
+        const UnsignedInt front = Vector::bitMask(Vector::greaterThan(Vector::sub(normalDot, Vector::mul(radius, sinAngleNormalDot)), zero));
+        const UnsignedInt insideCone = Vector::bitMask(Vector::greaterEqual(Vector::mul(Vector::mul(lenA, lenA), tanAngleSqPlusOne), cDot));
+        const UnsignedInt insideSphere = Vector::bitMask(Vector::greaterEqual(Vector::mul(radius, radius), diffDot));
+        return (front & insideCone) | (~front & insideSphere);
+    }
+
+    typename Vector::Type originX, originY, originZ, normalX, normalY, normalZ, sinAngle, sinAngleNormalDot, tanAngleSqPlusOne, zero;
+};
+
+template<class Vector> struct SphereConeViewAvxFma {
+    CORRADE_ENABLE(AVX,AVX_FMA) explicit SphereConeViewAvxFma(const SphereConeViewParameters& cone): sinAngle{Vector::splat(cone.sinAngle)}, tanAngle{Vector::splat(cone.tanAngle)} {
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 3; ++row)
+                view[col][row] = Vector::splat(cone.view[col][row]);
+    }
+
+    CORRADE_ENABLE(AVX,AVX_FMA) UnsignedInt operator()(const typename Vector::Type* const values) const {
+        typename Vector::Type transformed[3];
+        for(std::size_t row = 0; row != 3; ++row)
+            transformed[row] = Vector::add(Vector::add(Vector::add(Vector::mul(view[0][row], values[0]), Vector::mul(view[1][row], values[1])), Vector::mul(view[2][row], values[2])), view[3][row]);
+        const typename Vector::Type radius = values[3];
+        const typename Vector::Type xyDot = Vector::add(Vector::mul(transformed[0], transformed[0]), Vector::mul(transformed[1], transformed[1]));
+        const typename Vector::Type coneRadius = Vector::mul(tanAngle, Vector::sub(transformed[2], Vector::div(radius, sinAngle)));
+        const UnsignedInt front = Vector::bitMask(Vector::lessThan(transformed[2], Vector::mul(radius, sinAngle)));
+        const UnsignedInt insideCone = Vector::bitMask(Vector::greaterEqual(Vector::mul(coneRadius, coneRadius), xyDot));
+        const UnsignedInt insideSphere = Vector::bitMask(Vector::greaterEqual(Vector::mul(radius, radius), Vector::add(xyDot, Vector::mul(transformed[2], transformed[2]))));
+        return (front & insideCone) | (~front & insideSphere);
+    }
+
+    typename Vector::Type view[4][3];
+    typename Vector::Type sinAngle, tanAngle;
+};
+
+template<class Test, class Parameters> CORRADE_ENABLE(AVX,AVX_FMA) void sphereIntoAvxFma(const Parameters& parameters, const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef SoaAvxFma Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const SphereLayout layout = sphereLayout(centers, centerStride, radii, radiusStride);
+    const Test test{parameters};
+    typename Vector::Type values[4];
+    Float block[lanes];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            sphereLoadAvxFma<Vector>(centers, centerStride, radii, radiusStride, layout, i + k, lanes, values, block);
+            bits |= test(values) << k;
+        }
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    for(; i < size; i += lanes) {
+        const std::size_t count = Math::min(size - i, lanes);
+        sphereLoadAvxFma<Vector>(centers, centerStride, radii, radiusStride, layout, i, count, values, block);
+        const UnsignedInt bits = test(values);
+        for(std::size_t l = 0; l != count; ++l) {
+            const std::size_t bit = dstOffset + i + l;
+            if(bits & (1u << l))
+                dst[bit >> 3] |= char(1 << (bit & 0x07));
+            else
+                dst[bit >> 3] &= char(~(1 << (bit & 0x07)));
+        }
+    }
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+template<class Vector> CORRADE_ENABLE_AVX512F inline void sphereLoadAvx512(const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const SphereLayout layout, const std::size_t i, const std::size_t count, typename Vector::Type* const values, Float* const block) {
+    const std::size_t lanes = Vector::Lanes;
+    const bool full = count == lanes;
+    if(full && layout == SphereLayout::PackedSpheres) {
+        const Float* const in = reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i)*centerStride);
+        const typename Vector::Type r0 = Vector::load(in, 16);
+        const typename Vector::Type r1 = Vector::load(in + 4, 16);
+        const typename Vector::Type r2 = Vector::load(in + 8, 16);
+        const typename Vector::Type r3 = Vector::load(in + 12, 16);
+        const typename Vector::Type t0 = Vector::unpackLo(r0, r1);
+        const typename Vector::Type t1 = Vector::unpackLo(r2, r3);
+        const typename Vector::Type t2 = Vector::unpackHi(r0, r1);
+        const typename Vector::Type t3 = Vector::unpackHi(r2, r3);
+        values[0] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t0, t1);
+        values[1] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t0, t1);
+        values[2] = Vector::template shuffle<_MM_SHUFFLE(1, 0, 1, 0)>(t2, t3);
+        values[3] = Vector::template shuffle<_MM_SHUFFLE(3, 2, 3, 2)>(t2, t3);
+        return;
+    }
+
+    if(full && layout == SphereLayout::PackedCenters) {
+        const Float* const in = reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i)*centerStride);
+        const typename Vector::Type a0 = Vector::load(in, 12);
+        const typename Vector::Type a1 = Vector::load(in + 4, 12);
+        const typename Vector::Type a2 = Vector::load(in + 8, 12);
+        values[0] = Vector::template shuffle<_MM_SHUFFLE(3, 0, 3, 0)>(a0, Vector::template shuffle<_MM_SHUFFLE(1, 0, 3, 2)>(a1, a2));
+        values[1] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(0, 0, 1, 1)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(2, 2, 3, 3)>(a1, a2));
+        values[2] = Vector::template shuffle<_MM_SHUFFLE(2, 0, 2, 0)>(Vector::template shuffle<_MM_SHUFFLE(1, 1, 2, 2)>(a0, a1), Vector::template shuffle<_MM_SHUFFLE(3, 3, 0, 0)>(a2, a2));
+    } else for(std::size_t c = 0; c != 3; ++c) {
+        for(std::size_t l = 0; l != lanes; ++l)
+            block[l] = l < count ? reinterpret_cast<const Float*>(centers + std::ptrdiff_t(i + l)*centerStride)[c] : 0.0f;
+        values[c] = Vector::load(block, 4);
+    }
+
+    if(full && radiusStride == std::ptrdiff_t(sizeof(Float))) {
+        values[3] = Vector::load(reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i)*radiusStride), 4);
+        return;
+    }
+    for(std::size_t l = 0; l != lanes; ++l)
+        block[l] = l < count ? *reinterpret_cast<const Float*>(radii + std::ptrdiff_t(i + l)*radiusStride) : 0.0f;
+    values[3] = Vector::load(block, 4);
+}
+
+template<class Vector> struct SphereFrustumAvx512 {
+    CORRADE_ENABLE_AVX512F explicit SphereFrustumAvx512(const Frustum<Float>& frustum) {
+        for(std::size_t p = 0; p != 6; ++p) {
+            planeX[p] = Vector::splat(frustum[p].x());
+            planeY[p] = Vector::splat(frustum[p].y());
+            planeZ[p] = Vector::splat(frustum[p].z());
+            planeW[p] = Vector::splat(frustum[p].w());
+        }
+    }
+
+    CORRADE_ENABLE_AVX512F UnsignedInt operator()(const typename Vector::Type* const values) const {
+        const UnsignedInt allLanes = UnsignedInt((1ull << Vector::Lanes) - 1);
+        const typename Vector::Type minusRadiusSq = Vector::sub(Vector::splat(0.0f), Vector::mul(values[3], values[3]));
+        UnsignedInt culled = 0;
+        for(std::size_t p = 0; p != 6 && culled != allLanes; ++p) {
+            const typename Vector::Type d = Vector::add(Vector::add(Vector::add(Vector::mul(planeX[p], values[0]), Vector::mul(planeY[p], values[1])), Vector::mul(planeZ[p], values[2])), planeW[p]);
+            culled |= Vector::bitMask(Vector::lessThan(d, minusRadiusSq));
+        }
+        return ~culled & allLanes;
+    }
+
+    typename Vector::Type planeX[6], planeY[6], planeZ[6], planeW[6];
+};
+
+template<class Vector> struct SphereConeAvx512 {
+    CORRADE_ENABLE_AVX512F explicit SphereConeAvx512(const SphereConeParameters& cone): originX{Vector::splat(cone.origin.x())}, originY{Vector::splat(cone.origin.y())}, originZ{Vector::splat(cone.origin.z())}, normalX{Vector::splat(cone.normal.x())}, normalY{Vector::splat(cone.normal.y())}, normalZ{Vector::splat(cone.normal.z())}, sinAngle{Vector::splat(cone.sinAngle)}, sinAngleNormalDot{Vector::splat(cone.sinAngleNormalDot)}, tanAngleSqPlusOne{Vector::splat(cone.tanAngleSqPlusOne)}, zero{Vector::splat(0.0f)} {}
+
+    CORRADE_ENABLE_AVX512F UnsignedInt operator()(const typename Vector::Type* const values) const {
+        const typename Vector::Type diffX = Vector::sub(values[0], originX);
+        const typename Vector::Type diffY = Vector::sub(values[1], originY);
+        const typename Vector::Type diffZ = Vector::sub(values[2], originZ);
+        const typename Vector::Type radius = values[3];
+        const typename Vector::Type normalDot = Vector::add(Vector::add(Vector::mul(diffX, normalX), Vector::mul(diffY, normalY)), Vector::mul(diffZ, normalZ));
+        const typename Vector::Type cX = Vector::add(Vector::mul(diffX, sinAngle), Vector::mul(normalX, radius));
+        const typename Vector::Type cY = Vector::add(Vector::mul(diffY, sinAngle), Vector::mul(normalY, radius));
+        const typename Vector::Type cZ = Vector::add(Vector::mul(diffZ, sinAngle), Vector::mul(normalZ, radius));
+        const typename Vector::Type lenA = Vector::add(Vector::add(Vector::mul(cX, normalX), Vector::mul(cY, normalY)), Vector::mul(cZ, normalZ));
+        const typename Vector::Type cDot = Vector::add(Vector::add(Vector::mul(cX, cX), Vector::mul(cY, cY)), Vector::mul(cZ, cZ));
+        const typename Vector::Type diffDot = Vector::add(Vector::add(Vector::mul(diffX, diffX), Vector::mul(diffY, diffY)), Vector::mul(diffZ, diffZ));
+        const UnsignedInt front = Vector::bitMask(Vector::greaterThan(Vector::sub(normalDot, Vector::mul(radius, sinAngleNormalDot)), zero));
+        const UnsignedInt insideCone = Vector::bitMask(Vector::greaterEqual(Vector::mul(Vector::mul(lenA, lenA), tanAngleSqPlusOne), cDot));
+        const UnsignedInt insideSphere = Vector::bitMask(Vector::greaterEqual(Vector::mul(radius, radius), diffDot));
+        return (front & insideCone) | (~front & insideSphere);
+    }
+
+    typename Vector::Type originX, originY, originZ, normalX, normalY, normalZ, sinAngle, sinAngleNormalDot, tanAngleSqPlusOne, zero;
+};
+
+template<class Vector> struct SphereConeViewAvx512 {
+    CORRADE_ENABLE_AVX512F explicit SphereConeViewAvx512(const SphereConeViewParameters& cone): sinAngle{Vector::splat(cone.sinAngle)}, tanAngle{Vector::splat(cone.tanAngle)} {
+        for(std::size_t col = 0; col != 4; ++col)
+            for(std::size_t row = 0; row != 3; ++row)
+                view[col][row] = Vector::splat(cone.view[col][row]);
+    }
+
+    CORRADE_ENABLE_AVX512F UnsignedInt operator()(const typename Vector::Type* const values) const {
+        typename Vector::Type transformed[3];
+        for(std::size_t row = 0; row != 3; ++row)
+            transformed[row] = Vector::add(Vector::add(Vector::add(Vector::mul(view[0][row], values[0]), Vector::mul(view[1][row], values[1])), Vector::mul(view[2][row], values[2])), view[3][row]);
+        const typename Vector::Type radius = values[3];
+        const typename Vector::Type xyDot = Vector::add(Vector::mul(transformed[0], transformed[0]), Vector::mul(transformed[1], transformed[1]));
+        const typename Vector::Type coneRadius = Vector::mul(tanAngle, Vector::sub(transformed[2], Vector::div(radius, sinAngle)));
+        const UnsignedInt front = Vector::bitMask(Vector::lessThan(transformed[2], Vector::mul(radius, sinAngle)));
+        const UnsignedInt insideCone = Vector::bitMask(Vector::greaterEqual(Vector::mul(coneRadius, coneRadius), xyDot));
+        const UnsignedInt insideSphere = Vector::bitMask(Vector::greaterEqual(Vector::mul(radius, radius), Vector::add(xyDot, Vector::mul(transformed[2], transformed[2]))));
+        return (front & insideCone) | (~front & insideSphere);
+    }
+
+    typename Vector::Type view[4][3];
+    typename Vector::Type sinAngle, tanAngle;
+};
+
+template<class Test, class Parameters> CORRADE_ENABLE_AVX512F void sphereIntoAvx512(const Parameters& parameters, const char* const centers, const std::ptrdiff_t centerStride, const char* const radii, const std::ptrdiff_t radiusStride, const std::size_t size, char* const dst, const std::size_t dstOffset) {
+    typedef SoaAvx512 Vector;
+    const std::size_t lanes = Vector::Lanes;
+    const std::size_t chunk = lanes < 8 ? 8 : lanes;
+    const SphereLayout layout = sphereLayout(centers, centerStride, radii, radiusStride);
+    const Test test{parameters};
+    typename Vector::Type values[4];
+    Float block[lanes];
+
+    std::size_t i = 0;
+    for(; i + chunk <= size; i += chunk) {
+        UnsignedInt bits = 0;
+        for(std::size_t k = 0; k != chunk; k += lanes) {
+            sphereLoadAvx512<Vector>(centers, centerStride, radii, radiusStride, layout, i + k, lanes, values, block);
+            bits |= test(values) << k;
+        }
+        writeBits(dst, dstOffset + i, bits, chunk);
+    }
+
+    for(; i < size; i += lanes) {
+        const std::size_t count = Math::min(size - i, lanes);
+        sphereLoadAvx512<Vector>(centers, centerStride, radii, radiusStride, layout, i, count, values, block);
+        const UnsignedInt bits = test(values);
+        for(std::size_t l = 0; l != count; ++l) {
+            const std::size_t bit = dstOffset + i + l;
+            if(bits & (1u << l))
+                dst[bit >> 3] |= char(1 << (bit & 0x07));
+            else
+                dst[bit >> 3] &= char(~(1 << (bit & 0x07)));
+        }
+    }
+}
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(sphereFrustumInto)>::type sphereFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return sphereIntoSse2<SphereFrustumSse2<SoaSse2>, Frustum<Float>>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(sphereFrustumInto)>::type sphereFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return sphereIntoAvxFma<SphereFrustumAvxFma<SoaAvxFma>, Frustum<Float>>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(sphereFrustumInto)>::type sphereFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return sphereIntoAvx512<SphereFrustumAvx512<SoaAvx512>, Frustum<Float>>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(sphereFrustumInto)>::type sphereFrustumIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return sphereIntoScalar<Frustum<Float>>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(sphereFrustumIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(sphereFrustumIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(sphereFrustumIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sphereFrustumInto)(const Frustum<Float>& parameters, const char* centers, std::ptrdiff_t centerStride, const char* radii, std::ptrdiff_t radiusStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    sphereFrustumIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(parameters, centers, centerStride, radii, radiusStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(sphereConeInto)>::type sphereConeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return sphereIntoSse2<SphereConeSse2<SoaSse2>, SphereConeParameters>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(sphereConeInto)>::type sphereConeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return sphereIntoAvxFma<SphereConeAvxFma<SoaAvxFma>, SphereConeParameters>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(sphereConeInto)>::type sphereConeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return sphereIntoAvx512<SphereConeAvx512<SoaAvx512>, SphereConeParameters>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(sphereConeInto)>::type sphereConeIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return sphereIntoScalar<SphereConeParameters>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(sphereConeIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(sphereConeIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(sphereConeIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sphereConeInto)(const SphereConeParameters& parameters, const char* centers, std::ptrdiff_t centerStride, const char* radii, std::ptrdiff_t radiusStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    sphereConeIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(parameters, centers, centerStride, radii, radiusStride, size, dst, dstOffset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(sphereConeViewInto)>::type sphereConeViewIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return sphereIntoSse2<SphereConeViewSse2<SoaSse2>, SphereConeViewParameters>;
+}
+#endif
+
+#if defined(CORRADE_ENABLE_AVX) && defined(CORRADE_ENABLE_AVX_FMA)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(AVX,AVX_FMA) typename std::decay<decltype(sphereConeViewInto)>::type sphereConeViewIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx|Cpu::AvxFma)) {
+    return sphereIntoAvxFma<SphereConeViewAvxFma<SoaAvxFma>, SphereConeViewParameters>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_AVX512F
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX512F typename std::decay<decltype(sphereConeViewInto)>::type sphereConeViewIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx512f)) {
+    return sphereIntoAvx512<SphereConeViewAvx512<SoaAvx512>, SphereConeViewParameters>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(sphereConeViewInto)>::type sphereConeViewIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return sphereIntoScalar<SphereConeViewParameters>;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(sphereConeViewIntoImplementation, Cpu::AvxFma)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(sphereConeViewIntoImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(sphereConeViewIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(sphereConeViewInto)(const SphereConeViewParameters& parameters, const char* centers, std::ptrdiff_t centerStride, const char* radii, std::ptrdiff_t radiusStride, std::size_t size, char* dst, std::size_t dstOffset))({
+    sphereConeViewIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(parameters, centers, centerStride, radii, radiusStride, size, dst, dstOffset);
+})
+
+}
+
+namespace {
+
+template<class T> void sphereIntoImplementation(void(*const function)(const T&, const char*, std::ptrdiff_t, const char*, std::ptrdiff_t, std::size_t, char*, std::size_t), const T& parameters, const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Containers::MutableStridedBitArrayView1D& dst) {
+    const char* const centers = static_cast<const char*>(sphereCenters.data());
+    const char* const radii = static_cast<const char*>(sphereRadii.data());
+    if(dst.isContiguous()) {
+        function(parameters, centers, sphereCenters.stride(), radii, sphereRadii.stride(), sphereCenters.size(), static_cast<char*>(dst.data()), dst.offset());
+        return;
+    }
+
+    char bits[64];
+    for(std::size_t i = 0; i < sphereCenters.size(); i += sizeof(bits)*8) {
+        const std::size_t chunkSize = Math::min(sphereCenters.size() - i, sizeof(bits)*8);
+        function(parameters, centers + std::ptrdiff_t(i)*sphereCenters.stride(), sphereCenters.stride(), radii + std::ptrdiff_t(i)*sphereRadii.stride(), sphereRadii.stride(), chunkSize, bits, 0);
+        for(std::size_t j = 0; j != chunkSize; ++j)
+            dst.set(i + j, bits[j >> 3] & (1 << (j & 0x07)));
+    }
+}
+
+}
+
+namespace Intersection {
+
+void sphereFrustumInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Frustum<Float>& frustum, const Containers::MutableStridedBitArrayView1D& dst) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereFrustumInto(): expected center and radius views to have the same size but got" << sphereCenters.size() << "and" << sphereRadii.size(), );
+    CORRADE_ASSERT(sphereCenters.size() == dst.size()[0],
+        "Math::Intersection::sphereFrustumInto(): wrong destination size, got" << dst.size()[0] << "but expected" << sphereCenters.size(), );
+    sphereIntoImplementation(Implementation::sphereFrustumInto, frustum, sphereCenters, sphereRadii, dst);
+}
+
+void sphereConeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Vector3<Float>& coneOrigin, const Vector3<Float>& coneNormal, const Rad<Float> coneAngle, const Containers::MutableStridedBitArrayView1D& dst) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereConeInto(): expected center and radius views to have the same size but got" << sphereCenters.size() << "and" << sphereRadii.size(), );
+    CORRADE_ASSERT(sphereCenters.size() == dst.size()[0],
+        "Math::Intersection::sphereConeInto(): wrong destination size, got" << dst.size()[0] << "but expected" << sphereCenters.size(), );
+    const Rad<Float> halfAngle = coneAngle*0.5f;
+    const Float sinAngle = Math::sin(halfAngle);
+    const Float tanAngle = Math::tan(halfAngle);
+    sphereIntoImplementation(Implementation::sphereConeInto, Implementation::SphereConeParameters{coneOrigin, coneNormal, sinAngle, sinAngle*coneNormal.dot(), 1.0f + tanAngle*tanAngle}, sphereCenters, sphereRadii, dst);
+}
+
+void sphereConeViewInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Matrix4<Float>& coneView, const Rad<Float> coneAngle, const Containers::MutableStridedBitArrayView1D& dst) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereConeViewInto(): expected center and radius views to have the same size but got" << sphereCenters.size() << "and" << sphereRadii.size(), );
+    CORRADE_ASSERT(sphereCenters.size() == dst.size()[0],
+        "Math::Intersection::sphereConeViewInto(): wrong destination size, got" << dst.size()[0] << "but expected" << sphereCenters.size(), );
+    CORRADE_DEBUG_ASSERT(coneView.isRigidTransformation(),
+        "Math::Intersection::sphereConeViewInto(): coneView does not represent a rigid transformation:" << Debug::newline << coneView, );
+    const Rad<Float> halfAngle = coneAngle*0.5f;
+    sphereIntoImplementation(Implementation::sphereConeViewInto, Implementation::SphereConeViewParameters{coneView, Math::sin(halfAngle), Math::tan(halfAngle)}, sphereCenters, sphereRadii, dst);
+}
+
+std::size_t sphereFrustumClustersInto(const Containers::StridedArrayView1D<const Vector3<Float>>& sphereCenters, const Containers::StridedArrayView1D<const Float>& sphereRadii, const Containers::StridedArrayView1D<const Frustum<Float>>& clusters, const Containers::StridedArrayView1D<UnsignedInt>& clusterOffsets, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    CORRADE_ASSERT(sphereCenters.size() == sphereRadii.size(),
+        "Math::Intersection::sphereFrustumClustersInto(): expected center and radius views to have the same size but got" << sphereCenters.size() << "and" << sphereRadii.size(), {});
+    CORRADE_ASSERT(clusterOffsets.size() == clusters.size() + 1,
+        "Math::Intersection::sphereFrustumClustersInto(): wrong cluster offset destination size, got" << clusterOffsets.size() << "but expected" << clusters.size() + 1, {});
+
+    const char* const centers = static_cast<const char*>(sphereCenters.data());
+    const char* const radii = static_cast<const char*>(sphereRadii.data());
+    const std::ptrdiff_t centerStride = sphereCenters.stride();
+    const std::ptrdiff_t radiusStride = sphereRadii.stride();
+    char bits[64];
+    std::size_t count = 0;
+    for(std::size_t c = 0; c != clusters.size(); ++c) {
+        clusterOffsets[c] = UnsignedInt(count);
+        for(std::size_t i = 0; i < sphereCenters.size(); i += sizeof(bits)*8) {
+            const std::size_t chunkSize = Math::min(sphereCenters.size() - i, sizeof(bits)*8);
+            Implementation::sphereFrustumInto(clusters[c], centers + std::ptrdiff_t(i)*centerStride, centerStride, radii + std::ptrdiff_t(i)*radiusStride, radiusStride, chunkSize, bits, 0);
+            for(std::size_t j = 0; j < chunkSize; j += 8) {
+                const UnsignedByte byte = UnsignedByte(bits[j >> 3]);
+                if(!byte) continue;
+                for(std::size_t k = 0, kMax = Math::min(chunkSize - j, std::size_t{8}); k != kMax; ++k) {
+                    if(!(byte & (1 << k))) continue;
+                    if(count < indices.size()) indices[count] = UnsignedInt(i + j + k);
+                    ++count;
+                }
+            }
+        }
+    }
+    clusterOffsets[clusters.size()] = UnsignedInt(count);
+
+    return count;
+}
+
+}
+
+namespace Implementation {
+
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonEncodeIntoUnsignedInt)(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonDecodeIntoUnsignedInt)(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonEncodeIntoUnsignedLong)(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonDecodeIntoUnsignedLong)(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride);
+
+namespace {
+
+template<UnsignedInt bits> inline UnsignedInt mortonQuantize(const Float value, const Float offset, const Float scale) {
+    const Float scaled = (value - offset)*scale;
+    if(!(scaled > 0.0f)) return 0;
+    if(scaled >= Float(1u << bits)) return (1u << bits) - 1;
+    return UnsignedInt(scaled);
+}
+
+void mortonEncodeIntoUnsignedIntScalar(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& point = *reinterpret_cast<const Vector3<Float>*>(points + std::ptrdiff_t(i)*pointStride);
+        const UnsignedInt x = mortonQuantize<10>(point.x(), offset.x(), scale.x());
+        const UnsignedInt y = mortonQuantize<10>(point.y(), offset.y(), scale.y());
+        const UnsignedInt z = mortonQuantize<10>(point.z(), offset.z(), scale.z());
+        *reinterpret_cast<UnsignedInt*>(codes + std::ptrdiff_t(i)*codeStride) = Implementation::mortonSpread3(x)|(Implementation::mortonSpread3(y) << 1)|(Implementation::mortonSpread3(z) << 2);
+    }
+}
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2)
+CORRADE_ENABLE(SSE2,BMI2) void mortonEncodeIntoUnsignedIntBmi2(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& point = *reinterpret_cast<const Vector3<Float>*>(points + std::ptrdiff_t(i)*pointStride);
+        const UnsignedInt x = mortonQuantize<10>(point.x(), offset.x(), scale.x());
+        const UnsignedInt y = mortonQuantize<10>(point.y(), offset.y(), scale.y());
+        const UnsignedInt z = mortonQuantize<10>(point.z(), offset.z(), scale.z());
+        *reinterpret_cast<UnsignedInt*>(codes + std::ptrdiff_t(i)*codeStride) = _pdep_u32(x, 0x09249249u)|_pdep_u32(y, 0x12492492u)|_pdep_u32(z, 0x24924924u);
+    }
+}
+#endif
+
+void mortonDecodeIntoUnsignedIntScalar(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedInt code = *reinterpret_cast<const UnsignedInt*>(codes + std::ptrdiff_t(i)*codeStride);
+        *reinterpret_cast<Vector3<UnsignedShort>*>(dst + std::ptrdiff_t(i)*dstStride) = {UnsignedShort(Implementation::mortonCompact3(code)), UnsignedShort(Implementation::mortonCompact3(code >> 1)), UnsignedShort(Implementation::mortonCompact3(code >> 2))};
+    }
+}
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2)
+CORRADE_ENABLE(SSE2,BMI2) void mortonDecodeIntoUnsignedIntBmi2(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedInt code = *reinterpret_cast<const UnsignedInt*>(codes + std::ptrdiff_t(i)*codeStride);
+        *reinterpret_cast<Vector3<UnsignedShort>*>(dst + std::ptrdiff_t(i)*dstStride) = {UnsignedShort(_pext_u32(code, 0x09249249u)), UnsignedShort(_pext_u32(code, 0x12492492u)), UnsignedShort(_pext_u32(code, 0x24924924u))};
+    }
+}
+#endif
+
+void mortonEncodeIntoUnsignedLongScalar(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& point = *reinterpret_cast<const Vector3<Float>*>(points + std::ptrdiff_t(i)*pointStride);
+        const UnsignedLong x = mortonQuantize<21>(point.x(), offset.x(), scale.x());
+        const UnsignedLong y = mortonQuantize<21>(point.y(), offset.y(), scale.y());
+        const UnsignedLong z = mortonQuantize<21>(point.z(), offset.z(), scale.z());
+        *reinterpret_cast<UnsignedLong*>(codes + std::ptrdiff_t(i)*codeStride) = Implementation::mortonSpread3(x)|(Implementation::mortonSpread3(y) << 1)|(Implementation::mortonSpread3(z) << 2);
+    }
+}
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_ENABLE(SSE2,BMI2) void mortonEncodeIntoUnsignedLongBmi2(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const Vector3<Float>& point = *reinterpret_cast<const Vector3<Float>*>(points + std::ptrdiff_t(i)*pointStride);
+        const UnsignedLong x = mortonQuantize<21>(point.x(), offset.x(), scale.x());
+        const UnsignedLong y = mortonQuantize<21>(point.y(), offset.y(), scale.y());
+        const UnsignedLong z = mortonQuantize<21>(point.z(), offset.z(), scale.z());
+        *reinterpret_cast<UnsignedLong*>(codes + std::ptrdiff_t(i)*codeStride) = _pdep_u64(x, 0x1249249249249249ull)|_pdep_u64(y, 0x2492492492492492ull)|_pdep_u64(z, 0x4924924924924924ull);
+    }
+}
+#endif
+
+void mortonDecodeIntoUnsignedLongScalar(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedLong code = *reinterpret_cast<const UnsignedLong*>(codes + std::ptrdiff_t(i)*codeStride);
+        *reinterpret_cast<Vector3<UnsignedInt>*>(dst + std::ptrdiff_t(i)*dstStride) = {UnsignedInt(Implementation::mortonCompact3(code)), UnsignedInt(Implementation::mortonCompact3(code >> 1)), UnsignedInt(Implementation::mortonCompact3(code >> 2))};
+    }
+}
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_ENABLE(SSE2,BMI2) void mortonDecodeIntoUnsignedLongBmi2(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride) {
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedLong code = *reinterpret_cast<const UnsignedLong*>(codes + std::ptrdiff_t(i)*codeStride);
+        *reinterpret_cast<Vector3<UnsignedInt>*>(dst + std::ptrdiff_t(i)*dstStride) = {UnsignedInt(_pext_u64(code, 0x1249249249249249ull)), UnsignedInt(_pext_u64(code, 0x2492492492492492ull)), UnsignedInt(_pext_u64(code, 0x4924924924924924ull))};
     }
 }
+#endif
+
+}
+
+namespace {
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(SSE2,BMI2) typename std::decay<decltype(mortonEncodeIntoUnsignedInt)>::type mortonEncodeIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2|Cpu::Bmi2)) {
+    return mortonEncodeIntoUnsignedIntBmi2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(mortonEncodeIntoUnsignedInt)>::type mortonEncodeIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return mortonEncodeIntoUnsignedIntScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(mortonEncodeIntoUnsignedIntImplementation, Cpu::Bmi2)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(mortonEncodeIntoUnsignedIntImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(mortonEncodeIntoUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonEncodeIntoUnsignedInt)(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride))({
+    mortonEncodeIntoUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(points, pointStride, size, offset, scale, codes, codeStride);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(SSE2,BMI2) typename std::decay<decltype(mortonDecodeIntoUnsignedInt)>::type mortonDecodeIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2|Cpu::Bmi2)) {
+    return mortonDecodeIntoUnsignedIntBmi2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(mortonDecodeIntoUnsignedInt)>::type mortonDecodeIntoUnsignedIntImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return mortonDecodeIntoUnsignedIntScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(mortonDecodeIntoUnsignedIntImplementation, Cpu::Bmi2)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(mortonDecodeIntoUnsignedIntImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(mortonDecodeIntoUnsignedIntImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonDecodeIntoUnsignedInt)(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride))({
+    mortonDecodeIntoUnsignedIntImplementation(CORRADE_CPU_SELECT(Cpu::Default))(codes, codeStride, size, dst, dstStride);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(SSE2,BMI2) typename std::decay<decltype(mortonEncodeIntoUnsignedLong)>::type mortonEncodeIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2|Cpu::Bmi2)) {
+    return mortonEncodeIntoUnsignedLongBmi2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(mortonEncodeIntoUnsignedLong)>::type mortonEncodeIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return mortonEncodeIntoUnsignedLongScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(mortonEncodeIntoUnsignedLongImplementation, Cpu::Bmi2)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(mortonEncodeIntoUnsignedLongImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(mortonEncodeIntoUnsignedLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonEncodeIntoUnsignedLong)(const char* points, std::ptrdiff_t pointStride, std::size_t size, const Vector3<Float>& offset, const Vector3<Float>& scale, char* codes, std::ptrdiff_t codeStride))({
+    mortonEncodeIntoUnsignedLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(points, pointStride, size, offset, scale, codes, codeStride);
+})
+
+namespace {
+
+#if defined(CORRADE_ENABLE_SSE2) && defined(CORRADE_ENABLE_BMI2) && !defined(CORRADE_TARGET_32BIT)
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE(SSE2,BMI2) typename std::decay<decltype(mortonDecodeIntoUnsignedLong)>::type mortonDecodeIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2|Cpu::Bmi2)) {
+    return mortonDecodeIntoUnsignedLongBmi2;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(mortonDecodeIntoUnsignedLong)>::type mortonDecodeIntoUnsignedLongImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return mortonDecodeIntoUnsignedLongScalar;
+}
+
+}
+
+#ifdef CORRADE_TARGET_X86
+CORRADE_UTILITY_CPU_DISPATCHER(mortonDecodeIntoUnsignedLongImplementation, Cpu::Bmi2)
+#else
+CORRADE_UTILITY_CPU_DISPATCHER(mortonDecodeIntoUnsignedLongImplementation)
+#endif
+CORRADE_UTILITY_CPU_DISPATCHED(mortonDecodeIntoUnsignedLongImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(mortonDecodeIntoUnsignedLong)(const char* codes, std::ptrdiff_t codeStride, std::size_t size, char* dst, std::ptrdiff_t dstStride))({
+    mortonDecodeIntoUnsignedLongImplementation(CORRADE_CPU_SELECT(Cpu::Default))(codes, codeStride, size, dst, dstStride);
+})
+
+}
+
+namespace {
+
+template<class T> void mortonEncodeIntoImplementation(void(*const function)(const char*, std::ptrdiff_t, std::size_t, const Vector3<Float>&, const Vector3<Float>&, char*, std::ptrdiff_t), const UnsignedInt bits, const Containers::StridedArrayView1D<const Vector3<Float>>& points, const Range3D<Float>& bounds, const Containers::StridedArrayView1D<T>& codes) {
+    CORRADE_ASSERT(points.size() == codes.size(),
+        "Math::mortonEncodeInto(): expected point and code views to have the same size but got" << points.size() << "and" << codes.size(), );
+    const Vector3<Float> size = bounds.size();
+    Vector3<Float> scale{NoInit};
+    for(std::size_t i = 0; i != 3; ++i)
+        scale[i] = size[i] > 0.0f ? Float(1u << bits)/size[i] : 0.0f;
+    function(static_cast<const char*>(points.data()), points.stride(), points.size(), bounds.min(), scale, static_cast<char*>(codes.data()), codes.stride());
+}
+
+}
+
+void mortonEncodeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& points, const Range3D<Float>& bounds, const Containers::StridedArrayView1D<UnsignedInt>& codes) {
+    mortonEncodeIntoImplementation(Implementation::mortonEncodeIntoUnsignedInt, 10, points, bounds, codes);
+}
+
+void mortonEncodeInto(const Containers::StridedArrayView1D<const Vector3<Float>>& points, const Range3D<Float>& bounds, const Containers::StridedArrayView1D<UnsignedLong>& codes) {
+    mortonEncodeIntoImplementation(Implementation::mortonEncodeIntoUnsignedLong, 21, points, bounds, codes);
+}
+
+void mortonDecodeInto(const Containers::StridedArrayView1D<const UnsignedInt>& codes, const Containers::StridedArrayView1D<Vector3<UnsignedShort>>& dst) {
+    CORRADE_ASSERT(codes.size() == dst.size(),
+        "Math::mortonDecodeInto(): expected code and destination views to have the same size but got" << codes.size() << "and" << dst.size(), );
+    Implementation::mortonDecodeIntoUnsignedInt(static_cast<const char*>(codes.data()), codes.stride(), codes.size(), static_cast<char*>(dst.data()), dst.stride());
+}
+
+void mortonDecodeInto(const Containers::StridedArrayView1D<const UnsignedLong>& codes, const Containers::StridedArrayView1D<Vector3<UnsignedInt>>& dst) {
+    CORRADE_ASSERT(codes.size() == dst.size(),
+        "Math::mortonDecodeInto(): expected code and destination views to have the same size but got" << codes.size() << "and" << dst.size(), );
+    Implementation::mortonDecodeIntoUnsignedLong(static_cast<const char*>(codes.data()), codes.stride(), codes.size(), static_cast<char*>(dst.data()), dst.stride());
+}
 
 }}
 #endif
@@ -4,7 +4,9 @@
 
     https://doc.magnum.graphics/magnum/namespaceMagnum_1_1MeshTools.html
 
-    Depends on CorradeArray.h and MagnumMathBatch.hpp.
+    Depends on CorradeStridedArrayView.h, the implementation depends on
+    CorradeArray.h, CorradeCpu.hpp, CorradeTriple.h and MagnumMathBatch.hpp,
+    including the MagnumMathBatch.hpp implementation part.
 
     This is a single-header library generated from the Magnum project. With the
     goal being easy integration, it's deliberately free of all comments to keep
@@ -21,16 +23,29 @@
         #define MAGNUM_MESHTOOLS_IMPLEMENTATION
         #include <MagnumMeshTools.hpp>
 
+    The MagnumMathBatch.hpp implementation has to be enabled with
+    `#define MAGNUM_MATH_BATCH_IMPLEMENTATION` in one of your files as well.
+
     If you need the deinlined symbols to be exported from a shared library,
-    `#define MAGNUM_MESHTOOLS_EXPORT` as appropriate.
+    `#define MAGNUM_MESHTOOLS_EXPORT` as appropriate. Runtime CPU dispatch for
+    the implementation is enabled by default, you can disable it with
+    `#define CORRADE_NO_CPU_RUNTIME_DISPATCH` before including the file. To
+    enable the IFUNC functionality for CPU runtime dispatch,
+    `#define CORRADE_CPU_USE_IFUNC`.
+
+    No function spawns threads. To build a radix sort histogram in parallel,
+    call `radixSortHistogramInto()` on disjoint key ranges from your own
+    threads, sum the results and pass them to the `radixSortIndicesInto()` or
+    `radixSortInPlace()` overload taking a histogram.
 
     v2020.06-3290-g454e9 (2025-04-11)
     -   Include guard for the implementation part to prevent double definitions
     v2020.06-3128-g47b22 (2025-01-07)
     -   Initial release
 
-    Generated from Corrade v2020.06-1890-g77f9f (2025-04-11) and
-        Magnum v2020.06-3290-g454e9 (2025-04-11), 768 / 283 LoC
+    Based on a file generated from Corrade v2020.06-1890-g77f9f (2025-04-11)
+        and Magnum v2020.06-3290-g454e9 (2025-04-11), with local additions
+        that aren't upstream, 2821 / 421 LoC
 */
 
 /*
@@ -62,6 +77,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 
 #ifndef MAGNUM_MESHTOOLS_EXPORT
 #define MAGNUM_MESHTOOLS_EXPORT
@@ -91,7 +107,9 @@ typedef double Double;
 #define MagnumMeshTools_hpp
 namespace Corrade { namespace Containers {
 
+template<class> class ArrayView;
 template<class, class> class Pair;
+template<class, class, class> class Triple;
 template<unsigned, class> class StridedArrayView;
 template<class T> using StridedArrayView1D = StridedArrayView<1, T>;
 template<class T> using StridedArrayView2D = StridedArrayView<2, T>;
@@ -103,12 +121,18 @@ using namespace Corrade;
 
 namespace Math {
     template<class> class Vector3;
+    template<class> class Matrix4;
     template<class> class Range3D;
 }
 
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector3<UnsignedShort> Vector3us;
+typedef Math::Vector3<Short> Vector3s;
+typedef Math::Matrix4<Float> Matrix4;
 typedef Math::Range3D<Float> Range3D;
 
+enum class MeshIndexType: UnsignedByte;
+
 }
 #endif
 #ifndef CorradeArray_h
@@ -124,6 +148,24 @@ template<class T> using Array3 = StaticArray<3, T>;
 template<class T> using Array4 = StaticArray<4, T>;
 
 }}
+#endif
+#ifndef Magnum_Mesh_h
+#define Magnum_Mesh_h
+
+namespace Magnum {
+
+enum class MeshIndexType: UnsignedByte {
+    UnsignedByte = 1,
+    UnsignedShort,
+    UnsignedInt
+};
+
+inline UnsignedInt meshIndexTypeSize(const MeshIndexType type) {
+    return 1 << (UnsignedInt(type) - 1);
+}
+
+}
+
 #endif
 #ifndef Magnum_MeshTools_BoundingVolume_h
 #define Magnum_MeshTools_BoundingVolume_h
@@ -136,6 +178,30 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Vector3, Float> boundingSphereBouncingB
 
 }}
 
+#endif
+#ifndef Magnum_MeshTools_CompressIndices_h
+#define Magnum_MeshTools_CompressIndices_h
+
+namespace Magnum { namespace MeshTools {
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort, Long offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort, Long offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort, Long offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView2D<const char>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort, Long offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView1D<const UnsignedInt>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView1D<const UnsignedShort>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView1D<const UnsignedByte>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView2D<const char>& indices, MeshIndexType atLeast = MeshIndexType::UnsignedShort);
+
+}}
+
 #endif
 #ifndef Magnum_MeshTools_GenerateIndices_h
 #define Magnum_MeshTools_GenerateIndices_h
@@ -144,8 +210,14 @@ namespace Magnum { namespace MeshTools {
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTrivialIndices(UnsignedInt vertexCount, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTrivialIndicesCompressed(UnsignedInt vertexCount, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineStripIndices(UnsignedInt vertexCount, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
@@ -156,16 +228,40 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineStripIndices(
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(UnsignedInt vertexCount, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineLoopIndices(UnsignedInt vertexCount, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
@@ -176,16 +272,40 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineLoopIndices(c
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(UnsignedInt vertexCount, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleStripIndices(UnsignedInt vertexCount, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
@@ -196,16 +316,40 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleStripIndi
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(UnsignedInt vertexCount, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleFanIndices(UnsignedInt vertexCount, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
@@ -216,16 +360,40 @@ MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleFanIndice
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(UnsignedInt vertexCount, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, UnsignedInt offset = 0);
 
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, UnsignedInt offset = 0);
+
+MAGNUM_MESHTOOLS_EXPORT void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, UnsignedInt offset = 0);
+
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedInt>& quads, UnsignedInt offset = 0);
 
 MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedShort>& quads, UnsignedInt offset = 0);
@@ -240,6 +408,114 @@ MAGNUM_MESHTOOLS_EXPORT void generateQuadIndicesInto(const Containers::StridedAr
 
 }}
 
+#endif
+#ifndef Magnum_MeshTools_OptimizeVertexCache_h
+#define Magnum_MeshTools_OptimizeVertexCache_h
+
+namespace Magnum { namespace MeshTools {
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount, Containers::Array<char>& scratch, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount, Containers::Array<char>& scratch, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount, Containers::Array<char>& scratch, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount, Containers::Array<char>& scratch, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize = 16);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount, UnsignedInt cacheSize = 16);
+
+}}
+
+#endif
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+
+namespace Magnum { namespace MeshTools {
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, UnsignedInt vertexCount);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, UnsignedInt vertexCount);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, UnsignedInt vertexCount);
+
+MAGNUM_MESHTOOLS_EXPORT void remapAttributesInPlace(const Containers::StridedArrayView1D<const UnsignedInt>& remap, Containers::ArrayView<const Containers::StridedArrayView2D<char>> attributes);
+
+MAGNUM_MESHTOOLS_EXPORT void remapAttributesInPlace(const Containers::StridedArrayView1D<const UnsignedInt>& remap, std::initializer_list<Containers::StridedArrayView2D<char>> attributes);
+
+}}
+
+#endif
+#ifndef Magnum_MeshTools_QuantizePositions_h
+#define Magnum_MeshTools_QuantizePositions_h
+
+namespace Magnum { namespace MeshTools {
+
+MAGNUM_MESHTOOLS_EXPORT Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3us>& output);
+
+MAGNUM_MESHTOOLS_EXPORT Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3s>& output);
+
+MAGNUM_MESHTOOLS_EXPORT Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Range3D& bounds, const Containers::StridedArrayView1D<Vector3us>& output);
+
+MAGNUM_MESHTOOLS_EXPORT Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Range3D& bounds, const Containers::StridedArrayView1D<Vector3s>& output);
+
+MAGNUM_MESHTOOLS_EXPORT void quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t chunkSize, const Containers::StridedArrayView1D<Vector3us>& output, const Containers::StridedArrayView1D<Matrix4>& dequantizations);
+
+MAGNUM_MESHTOOLS_EXPORT void quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, std::size_t chunkSize, const Containers::StridedArrayView1D<Vector3s>& output, const Containers::StridedArrayView1D<Matrix4>& dequantizations);
+
+}}
+
+#endif
+#ifndef Magnum_MeshTools_RadixSort_h
+#define Magnum_MeshTools_RadixSort_h
+
+namespace Magnum { namespace MeshTools {
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> radixSortIndices(const Containers::StridedArrayView1D<const UnsignedInt>& keys);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> radixSortIndices(const Containers::StridedArrayView1D<const UnsignedLong>& keys);
+
+MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> radixSortIndices(const Containers::StridedArrayView1D<const Float>& keys);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedLong>& keys, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortIndicesInto(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedInt>& keys, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedLong>& keys, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortInPlace(const Containers::StridedArrayView1D<Float>& keys, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortHistogramInto(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortHistogramInto(const Containers::StridedArrayView1D<const UnsignedLong>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortHistogramInto(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedLong>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortIndicesInto(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedInt>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedLong>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch);
+
+MAGNUM_MESHTOOLS_EXPORT void radixSortInPlace(const Containers::StridedArrayView1D<Float>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch);
+
+}}
+
 #endif
 #if defined(MAGNUM_MESHTOOLS_IMPLEMENTATION) && !defined(MagnumMeshTools_hpp_implementation)
 #define MagnumMeshTools_hpp_implementation
@@ -247,9 +523,21 @@ MAGNUM_MESHTOOLS_EXPORT void generateQuadIndicesInto(const Containers::StridedAr
 #include <cassert>
 #endif
 
+#ifndef CORRADE_NO_CPU_RUNTIME_DISPATCH
+#define CORRADE_BUILD_CPU_RUNTIME_DISPATCH
+#endif
+
+#include <cstring>
+
 #include "CorradeArray.h"
+#include "CorradeCpu.hpp"
+#include "CorradeTriple.h"
 #include "MagnumMathBatch.hpp"
 
+#if defined(CORRADE_ENABLE_SSE2) || defined(CORRADE_ENABLE_SSE41) || defined(CORRADE_ENABLE_AVX2)
+#include <immintrin.h>
+#endif
+
 #ifdef __BYTE_ORDER__
 #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 #define CORRADE_TARGET_BIG_ENDIAN
@@ -277,11 +565,59 @@ MAGNUM_MESHTOOLS_EXPORT void generateQuadIndicesInto(const Containers::StridedAr
 #define CORRADE_ASSERT_UNREACHABLE(message, returnValue) assert(!"unreachable code")
 #endif
 #endif
+#if defined(CORRADE_TARGET_GCC) && !defined(CORRADE_TARGET_CLANG) && __GNUC__ >= 10
+#define CORRADE_UNUSED [[maybe_unused]]
+#elif defined(CORRADE_TARGET_GCC) || defined(CORRADE_TARGET_CLANG_CL)
+#define CORRADE_UNUSED __attribute__((__unused__))
+#elif defined(CORRADE_TARGET_MSVC)
+#define CORRADE_UNUSED __pragma(warning(suppress:4100))
+#else
+#define CORRADE_UNUSED
+#endif
+
+#define CORRADE_PASSTHROUGH(...) __VA_ARGS__
+
+#define CORRADE_NOOP(...)
+#ifndef Corrade_Utility_Implementation_cpu_h
+#define Corrade_Utility_Implementation_cpu_h
+
+#if (defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && !defined(CORRADE_CPU_USE_IFUNC))
+    #define CORRADE_UTILITY_CPU_DISPATCHER(...) CORRADE_CPU_DISPATCHER(__VA_ARGS__)
+    #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...) CORRADE_CPU_DISPATCHER_BASE(__VA_ARGS__)
+    #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)                 \
+        CORRADE_CPU_DISPATCHED_POINTER(dispatcher, __VA_ARGS__) CORRADE_NOOP
+    #define CORRADE_UTILITY_CPU_MAYBE_UNUSED
+#else
+    #if defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && defined(CORRADE_CPU_USE_IFUNC)
+        #define CORRADE_UTILITY_CPU_DISPATCHER(...)                         \
+            namespace { CORRADE_CPU_DISPATCHER(__VA_ARGS__) }
+        #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...)                    \
+            namespace { CORRADE_CPU_DISPATCHER_BASE(__VA_ARGS__) }
+        #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)             \
+            CORRADE_CPU_DISPATCHED_IFUNC(dispatcher, __VA_ARGS__) CORRADE_NOOP
+        #define CORRADE_UTILITY_CPU_MAYBE_UNUSED
+    #elif !defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH)
+        #define CORRADE_UTILITY_CPU_DISPATCHER(...)
+        #define CORRADE_UTILITY_CPU_DISPATCHER_BASE(...)
+        #define CORRADE_UTILITY_CPU_DISPATCHED(dispatcher, ...)             \
+            __VA_ARGS__ CORRADE_PASSTHROUGH
+        #define CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_UNUSED
+    #else
+    #error mosra messed up!
+    #endif
+#endif
+
+#endif
+#if defined(CORRADE_BUILD_CPU_RUNTIME_DISPATCH) && !defined(CORRADE_CPU_USE_IFUNC)
+    #define CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(name) (*name)
+#else
+    #define CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(name) (name)
+#endif
 
 namespace Magnum { namespace MeshTools {
 
 Range3D boundingRange(const Containers::StridedArrayView1D<const Vector3>& points) {
-    return Math::minmax(points);
+    return Math::minmaxBatched(points);
 }
 
 Containers::Pair<Vector3, Float> boundingSphereBouncingBubble(const Containers::StridedArrayView1D<const Vector3>& points) {
@@ -321,447 +657,2164 @@ Containers::Pair<Vector3, Float> boundingSphereBouncingBubble(const Containers::
 }}
 namespace Magnum { namespace MeshTools {
 
-void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedInt>& output, /*mutable*/ UnsignedInt offset) {
-    for(std::size_t i = 0; i != output.size(); ++i)
-        output[i] = offset++;
-}
+namespace Implementation {
 
-Containers::Array<UnsignedInt> generateTrivialIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, vertexCount};
-    generateTrivialIndicesInto(output, offset);
-    return output;
-}
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateTrivialIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateLineStripIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateTriangleStripIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset);
+extern void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateTriangleFanIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset);
 
-void generateLineStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 2,
-        "MeshTools::generateLineStripIndicesInto(): expected either zero or at least two vertices, got" << vertexCount, );
+namespace {
 
-    const UnsignedInt iMax = Math::max(vertexCount, 1u) - 1;
-    CORRADE_ASSERT(output.size() == 2*iMax,
-        "MeshTools::generateLineStripIndicesInto(): bad output size, expected" << 2*iMax << "but got" << output.size(), );
+struct GenerateIndicesIota {
+    explicit GenerateIndicesIota(const void*, UnsignedInt offset): offset{offset} {}
 
-    for(std::size_t i = 0; i != iMax; ++i) {
-        output[i*2 + 0] = offset + i;
-        output[i*2 + 1] = offset + i + 1;
+    UnsignedInt operator[](std::size_t i) const {
+        return offset + UnsignedInt(i);
     }
-}
 
-namespace {
-
-template<class T> void generateLineStripIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 2,
-        "MeshTools::generateLineStripIndicesInto(): expected either zero or at least two indices, got" << indices.size(), );
+    UnsignedInt offset;
+};
 
-    const UnsignedInt iMax = Math::max(indices.size(), std::size_t{1}) - 1;
-    CORRADE_ASSERT(output.size() == 2*iMax,
-        "MeshTools::generateLineStripIndicesInto(): bad output size, expected" << 2*iMax << "but got" << output.size(), );
+template<class T> struct GenerateIndicesFrom {
+    explicit GenerateIndicesFrom(const void* indices, UnsignedInt offset): indices{static_cast<const T*>(indices)}, offset{offset} {}
 
-    for(std::size_t i = 0; i != iMax; ++i) {
-        output[i*2 + 0] = offset + indices[i];
-        output[i*2 + 1] = offset + indices[i + 1];
+    UnsignedInt operator[](std::size_t i) const {
+        return offset + indices[i];
     }
-}
 
+    const T* indices;
+    UnsignedInt offset;
+};
+
+template<class Kernel, class Source> void generateIndicesIntoOutput(const Source& source, std::size_t count, void* output, std::size_t outputTypeSize) {
+    if(outputTypeSize == 4)
+        Kernel::run(source, count, static_cast<UnsignedInt*>(output));
+    else if(outputTypeSize == 2)
+        Kernel::run(source, count, static_cast<UnsignedShort*>(output));
+    else
+        Kernel::run(source, count, static_cast<UnsignedByte*>(output));
 }
 
-void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateLineStripIndicesIntoImplementation(indices, output, offset);
+template<class Kernel> void generateIndicesInto(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset) {
+    if(indexTypeSize == 4)
+        generateIndicesIntoOutput<Kernel>(GenerateIndicesFrom<UnsignedInt>{indices, offset}, count, output, outputTypeSize);
+    else if(indexTypeSize == 2)
+        generateIndicesIntoOutput<Kernel>(GenerateIndicesFrom<UnsignedShort>{indices, offset}, count, output, outputTypeSize);
+    else if(indexTypeSize == 1)
+        generateIndicesIntoOutput<Kernel>(GenerateIndicesFrom<UnsignedByte>{indices, offset}, count, output, outputTypeSize);
+    else
+        generateIndicesIntoOutput<Kernel>(GenerateIndicesIota{indices, offset}, count, output, outputTypeSize);
 }
 
-void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateLineStripIndicesIntoImplementation(indices, output, offset);
+template<class Source, class T> void generateTrivialIndicesIntoScalar(const Source& source, std::size_t i, const std::size_t count, T* const output) {
+    for(; i != count; ++i)
+        output[i] = T(source[i]);
 }
 
-void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateLineStripIndicesIntoImplementation(indices, output, offset);
+template<class Source, class T> void generateLineStripIndicesIntoScalar(const Source& source, std::size_t i, const std::size_t count, T* const output) {
+    for(; i != count; ++i) {
+        output[i*2 + 0] = T(source[i]);
+        output[i*2 + 1] = T(source[i + 1]);
+    }
 }
 
-void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateLineStripIndicesInto(): second index view dimension is not contiguous", );
-    if(indices.size()[1] == 4)
-        return generateLineStripIndicesInto(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
-    else if(indices.size()[1] == 2)
-        return generateLineStripIndicesInto(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
-    else if(indices.size()[1] == 1)
-        return generateLineStripIndicesInto(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
-    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateLineStripIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+template<class Source, class T> void generateTriangleStripIndicesIntoScalar(const Source& source, std::size_t i, const std::size_t count, T* const output) {
+    for(; i != count; ++i) {
+        const std::size_t odd = i & 1;
+        output[i*3 + 0] = T(source[i + odd]);
+        output[i*3 + 1] = T(source[i + 1 - odd]);
+        output[i*3 + 2] = T(source[i + 2]);
+    }
 }
 
-Containers::Array<UnsignedInt> generateLineStripIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(vertexCount, 1u) - 1)};
-    generateLineStripIndicesInto(vertexCount, output, offset);
-    return output;
+template<class Source, class T> void generateTriangleFanIndicesIntoScalar(const Source& source, std::size_t i, const std::size_t count, T* const output) {
+    const T first = T(source[0]);
+    for(; i != count; ++i) {
+        output[i*3 + 0] = first;
+        output[i*3 + 1] = T(source[i + 1]);
+        output[i*3 + 2] = T(source[i + 2]);
+    }
 }
 
-Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)};
-    generateLineStripIndicesInto(indices, output, offset);
-    return output;
-}
+struct GenerateTrivialIndicesScalar {
+    template<class Source, class T> static void run(const Source& source, const std::size_t count, T* const output) {
+        generateTrivialIndicesIntoScalar(source, 0, count, output);
+    }
+};
 
-Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)};
-    generateLineStripIndicesInto(indices, output, offset);
-    return output;
-}
+struct GenerateLineStripIndicesScalar {
+    template<class Source, class T> static void run(const Source& source, const std::size_t count, T* const output) {
+        generateLineStripIndicesIntoScalar(source, 0, count, output);
+    }
+};
 
-Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)};
-    generateLineStripIndicesInto(indices, output, offset);
-    return output;
-}
+struct GenerateTriangleStripIndicesScalar {
+    template<class Source, class T> static void run(const Source& source, const std::size_t count, T* const output) {
+        generateTriangleStripIndicesIntoScalar(source, 0, count, output);
+    }
+};
 
-Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size()[0], std::size_t{1}) - 1)};
-    generateLineStripIndicesInto(indices, output, offset);
-    return output;
-}
+struct GenerateTriangleFanIndicesScalar {
+    template<class Source, class T> static void run(const Source& source, const std::size_t count, T* const output) {
+        generateTriangleFanIndicesIntoScalar(source, 0, count, output);
+    }
+};
 
-void generateLineLoopIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 2,
-        "MeshTools::generateLineLoopIndicesInto(): expected either zero or at least two vertices, got" << vertexCount, );
-    CORRADE_ASSERT(output.size() == 2*vertexCount,
-        "MeshTools::generateLineLoopIndicesInto(): bad output size, expected" << 2*vertexCount << "but got" << output.size(), );
+#ifdef CORRADE_ENABLE_SSE2
+template<class> struct GenerateIndicesSse2;
 
-    for(std::size_t i = 0, iMax = Math::max(vertexCount, 1u) - 1; i != iMax; ++i) {
-        output[i*2 + 0] = offset + i;
-        output[i*2 + 1] = offset + i + 1;
+template<> struct GenerateIndicesSse2<GenerateIndicesIota> {
+    CORRADE_ENABLE_SSE2 static __m128i load(const GenerateIndicesIota& source, const std::size_t i) {
+        return _mm_add_epi32(_mm_set1_epi32(Int(source.offset + UnsignedInt(i))), _mm_set_epi32(3, 2, 1, 0));
     }
-    if(vertexCount >= 2) {
-        output[2*vertexCount - 2] = offset + vertexCount - 1;
-        output[2*vertexCount - 1] = offset + 0;
+};
+
+template<> struct GenerateIndicesSse2<GenerateIndicesFrom<UnsignedInt>> {
+    CORRADE_ENABLE_SSE2 static __m128i load(const GenerateIndicesFrom<UnsignedInt>& source, const std::size_t i) {
+        return _mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source.indices + i)), _mm_set1_epi32(Int(source.offset)));
     }
-}
+};
 
-namespace {
+template<> struct GenerateIndicesSse2<GenerateIndicesFrom<UnsignedShort>> {
+    CORRADE_ENABLE_SSE2 static __m128i load(const GenerateIndicesFrom<UnsignedShort>& source, const std::size_t i) {
+        const __m128i in = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(source.indices + i));
+        return _mm_add_epi32(_mm_unpacklo_epi16(in, _mm_setzero_si128()), _mm_set1_epi32(Int(source.offset)));
+    }
+};
+
+template<> struct GenerateIndicesSse2<GenerateIndicesFrom<UnsignedByte>> {
+    CORRADE_ENABLE_SSE2 static __m128i load(const GenerateIndicesFrom<UnsignedByte>& source, const std::size_t i) {
+        Int bytes;
+        std::memcpy(&bytes, source.indices + i, 4);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i in = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(bytes), zero), zero);
+        return _mm_add_epi32(in, _mm_set1_epi32(Int(source.offset)));
+    }
+};
 
-template<class T> void generateLineLoopIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 2,
-        "MeshTools::generateLineLoopIndicesInto(): expected either zero or at least two indices, got" << indices.size(), );
-    CORRADE_ASSERT(output.size() == 2*indices.size(),
-        "MeshTools::generateLineLoopIndicesInto(): bad output size, expected" << 2*indices.size() << "but got" << output.size(), );
+template<class> struct GenerateIndicesStoreSse2;
 
-    for(std::size_t i = 0, iMax = Math::max(indices.size(), std::size_t{1}) - 1; i != iMax; ++i) {
-        output[i*2 + 0] = offset + indices[i];
-        output[i*2 + 1] = offset + indices[i + 1];
+template<> struct GenerateIndicesStoreSse2<UnsignedInt> {
+    CORRADE_ENABLE_SSE2 static void store(UnsignedInt* const output, const __m128i value) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), value);
     }
-    if(indices.size() >= 2) {
-        output[2*indices.size() - 2] = offset + indices[indices.size() - 1];
-        output[2*indices.size() - 1] = offset + indices[0];
+};
+
+template<> struct GenerateIndicesStoreSse2<UnsignedShort> {
+    CORRADE_ENABLE_SSE2 static void store(UnsignedShort* const output, const __m128i value) {
+        const __m128i truncated = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packs_epi32(truncated, truncated));
     }
-}
+};
+
+template<> struct GenerateIndicesStoreSse2<UnsignedByte> {
+    CORRADE_ENABLE_SSE2 static void store(UnsignedByte* const output, const __m128i value) {
+        const __m128i truncated = _mm_and_si128(value, _mm_set1_epi32(0xff));
+        const __m128i packed = _mm_packs_epi32(truncated, truncated);
+        const Int bytes = _mm_cvtsi128_si32(_mm_packus_epi16(packed, packed));
+        std::memcpy(output, &bytes, 4);
+    }
+};
+
+struct GenerateTrivialIndicesSse2 {
+    template<class Source, class T> CORRADE_ENABLE_SSE2 static void run(const Source& source, const std::size_t count, T* const output) {
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4)
+            GenerateIndicesStoreSse2<T>::store(output + i, GenerateIndicesSse2<Source>::load(source, i));
+        generateTrivialIndicesIntoScalar(source, i, count, output);
+    }
+};
+
+struct GenerateLineStripIndicesSse2 {
+    template<class Source, class T> CORRADE_ENABLE_SSE2 static void run(const Source& source, const std::size_t count, T* const output) {
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128i a = GenerateIndicesSse2<Source>::load(source, i);
+            const __m128i b = GenerateIndicesSse2<Source>::load(source, i + 1);
+            GenerateIndicesStoreSse2<T>::store(output + i*2, _mm_unpacklo_epi32(a, b));
+            GenerateIndicesStoreSse2<T>::store(output + i*2 + 4, _mm_unpackhi_epi32(a, b));
+        }
+        generateLineStripIndicesIntoScalar(source, i, count, output);
+    }
+};
+
+struct GenerateTriangleStripIndicesSse2 {
+    template<class Source, class T> CORRADE_ENABLE_SSE2 static void run(const Source& source, const std::size_t count, T* const output) {
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128i a = GenerateIndicesSse2<Source>::load(source, i);
+            const __m128i b = GenerateIndicesSse2<Source>::load(source, i + 2);
+            GenerateIndicesStoreSse2<T>::store(output + i*3, _mm_shuffle_epi32(a, _MM_SHUFFLE(2, 2, 1, 0)));
+            GenerateIndicesStoreSse2<T>::store(output + i*3 + 4, _mm_shuffle_epi32(a, _MM_SHUFFLE(3, 2, 3, 1)));
+            GenerateIndicesStoreSse2<T>::store(output + i*3 + 8, _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 2)));
+        }
+        generateTriangleStripIndicesIntoScalar(source, i, count, output);
+    }
+};
+
+struct GenerateTriangleFanIndicesSse2 {
+    template<class Source, class T> CORRADE_ENABLE_SSE2 static void run(const Source& source, const std::size_t count, T* const output) {
+        const __m128i first = _mm_set1_epi32(Int(source[0]));
+        std::size_t i = 0;
+        for(; i + 4 <= count; i += 4) {
+            const __m128i a = GenerateIndicesSse2<Source>::load(source, i + 1);
+            const __m128i b = GenerateIndicesSse2<Source>::load(source, i + 2);
+            const __m128i lo = _mm_unpacklo_epi32(first, a);
+            const __m128i hi = _mm_unpackhi_epi32(first, a);
+            GenerateIndicesStoreSse2<T>::store(output + i*3, _mm_shuffle_epi32(lo, _MM_SHUFFLE(0, 3, 1, 0)));
+            GenerateIndicesStoreSse2<T>::store(output + i*3 + 4, _mm_unpacklo_epi64(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 2, 1)), hi));
+            GenerateIndicesStoreSse2<T>::store(output + i*3 + 8, _mm_unpackhi_epi64(_mm_shuffle_epi32(hi, _MM_SHUFFLE(0, 3, 0, 0)), b));
+        }
+        generateTriangleFanIndicesIntoScalar(source, i, count, output);
+    }
+};
+#endif
 
-}
+#ifdef CORRADE_ENABLE_AVX2
+template<class> struct GenerateIndicesAvx2;
 
-void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateLineLoopIndicesIntoImplementation(indices, output, offset);
-}
+template<> struct GenerateIndicesAvx2<GenerateIndicesIota> {
+    CORRADE_ENABLE_AVX2 static __m256i load(const GenerateIndicesIota& source, const std::size_t i) {
+        return _mm256_add_epi32(_mm256_set1_epi32(Int(source.offset + UnsignedInt(i))), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+};
+
+template<> struct GenerateIndicesAvx2<GenerateIndicesFrom<UnsignedInt>> {
+    CORRADE_ENABLE_AVX2 static __m256i load(const GenerateIndicesFrom<UnsignedInt>& source, const std::size_t i) {
+        return _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source.indices + i)), _mm256_set1_epi32(Int(source.offset)));
+    }
+};
+
+template<> struct GenerateIndicesAvx2<GenerateIndicesFrom<UnsignedShort>> {
+    CORRADE_ENABLE_AVX2 static __m256i load(const GenerateIndicesFrom<UnsignedShort>& source, const std::size_t i) {
+        return _mm256_add_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source.indices + i))), _mm256_set1_epi32(Int(source.offset)));
+    }
+};
+
+template<> struct GenerateIndicesAvx2<GenerateIndicesFrom<UnsignedByte>> {
+    CORRADE_ENABLE_AVX2 static __m256i load(const GenerateIndicesFrom<UnsignedByte>& source, const std::size_t i) {
+        return _mm256_add_epi32(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(source.indices + i))), _mm256_set1_epi32(Int(source.offset)));
+    }
+};
+
+template<class> struct GenerateIndicesStoreAvx2;
+
+template<> struct GenerateIndicesStoreAvx2<UnsignedInt> {
+    CORRADE_ENABLE_AVX2 static void store(UnsignedInt* const output, const __m256i value) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), value);
+    }
+};
+
+template<> struct GenerateIndicesStoreAvx2<UnsignedShort> {
+    CORRADE_ENABLE_AVX2 static void store(UnsignedShort* const output, const __m256i value) {
+        const __m256i truncated = _mm256_and_si256(value, _mm256_set1_epi32(0xffff));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi32(_mm256_castsi256_si128(truncated), _mm256_extracti128_si256(truncated, 1)));
+    }
+};
+
+template<> struct GenerateIndicesStoreAvx2<UnsignedByte> {
+    CORRADE_ENABLE_AVX2 static void store(UnsignedByte* const output, const __m256i value) {
+        const __m256i truncated = _mm256_and_si256(value, _mm256_set1_epi32(0xff));
+        const __m128i packed = _mm_packus_epi32(_mm256_castsi256_si128(truncated), _mm256_extracti128_si256(truncated, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(packed, packed));
+    }
+};
+
+struct GenerateTrivialIndicesAvx2 {
+    template<class Source, class T> CORRADE_ENABLE_AVX2 static void run(const Source& source, const std::size_t count, T* const output) {
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8)
+            GenerateIndicesStoreAvx2<T>::store(output + i, GenerateIndicesAvx2<Source>::load(source, i));
+        generateTrivialIndicesIntoScalar(source, i, count, output);
+    }
+};
+
+struct GenerateLineStripIndicesAvx2 {
+    template<class Source, class T> CORRADE_ENABLE_AVX2 static void run(const Source& source, const std::size_t count, T* const output) {
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256i a = GenerateIndicesAvx2<Source>::load(source, i);
+            const __m256i b = GenerateIndicesAvx2<Source>::load(source, i + 1);
+            const __m256i lo = _mm256_unpacklo_epi32(a, b);
+            const __m256i hi = _mm256_unpackhi_epi32(a, b);
+            GenerateIndicesStoreAvx2<T>::store(output + i*2, _mm256_permute2x128_si256(lo, hi, 0x20));
+            GenerateIndicesStoreAvx2<T>::store(output + i*2 + 8, _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+        generateLineStripIndicesIntoScalar(source, i, count, output);
+    }
+};
+
+struct GenerateTriangleStripIndicesAvx2 {
+    template<class Source, class T> CORRADE_ENABLE_AVX2 static void run(const Source& source, const std::size_t count, T* const output) {
+        const __m256i permutation0 = _mm256_setr_epi32(0, 1, 2, 2, 1, 3, 2, 3);
+        const __m256i permutation1 = _mm256_setr_epi32(4, 4, 3, 5, 4, 5, 6, 6);
+        const __m256i permutation2 = _mm256_setr_epi32(3, 5, 4, 5, 6, 6, 5, 7);
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256i a = GenerateIndicesAvx2<Source>::load(source, i);
+            const __m256i b = GenerateIndicesAvx2<Source>::load(source, i + 2);
+            GenerateIndicesStoreAvx2<T>::store(output + i*3, _mm256_permutevar8x32_epi32(a, permutation0));
+            GenerateIndicesStoreAvx2<T>::store(output + i*3 + 8, _mm256_permutevar8x32_epi32(a, permutation1));
+            GenerateIndicesStoreAvx2<T>::store(output + i*3 + 16, _mm256_permutevar8x32_epi32(b, permutation2));
+        }
+        generateTriangleStripIndicesIntoScalar(source, i, count, output);
+    }
+};
+
+struct GenerateTriangleFanIndicesAvx2 {
+    template<class Source, class T> CORRADE_ENABLE_AVX2 static void run(const Source& source, const std::size_t count, T* const output) {
+        const __m256i first = _mm256_set1_epi32(Int(source[0]));
+        const __m256i permutation0 = _mm256_setr_epi32(0, 0, 1, 0, 1, 2, 0, 2);
+        const __m256i permutation1 = _mm256_setr_epi32(3, 0, 3, 4, 0, 4, 5, 0);
+        const __m256i permutation2 = _mm256_setr_epi32(4, 5, 0, 5, 6, 0, 6, 7);
+        std::size_t i = 0;
+        for(; i + 8 <= count; i += 8) {
+            const __m256i a = GenerateIndicesAvx2<Source>::load(source, i + 1);
+            const __m256i b = GenerateIndicesAvx2<Source>::load(source, i + 2);
+            GenerateIndicesStoreAvx2<T>::store(output + i*3, _mm256_blend_epi32(_mm256_permutevar8x32_epi32(a, permutation0), first, 0x49));
+            GenerateIndicesStoreAvx2<T>::store(output + i*3 + 8, _mm256_blend_epi32(_mm256_permutevar8x32_epi32(a, permutation1), first, 0x92));
+            GenerateIndicesStoreAvx2<T>::store(output + i*3 + 16, _mm256_blend_epi32(_mm256_permutevar8x32_epi32(b, permutation2), first, 0x24));
+        }
+        generateTriangleFanIndicesIntoScalar(source, i, count, output);
+    }
+};
+#endif
+
+}
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(generateTrivialIndicesInto)>::type generateTrivialIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return generateIndicesInto<GenerateTrivialIndicesAvx2>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(generateTrivialIndicesInto)>::type generateTrivialIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return generateIndicesInto<GenerateTrivialIndicesSse2>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(generateTrivialIndicesInto)>::type generateTrivialIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return generateIndicesInto<GenerateTrivialIndicesScalar>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(generateTrivialIndicesIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(generateTrivialIndicesIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateTrivialIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset))({
+    generateTrivialIndicesIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(indices, indexTypeSize, count, output, outputTypeSize, offset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(generateLineStripIndicesInto)>::type generateLineStripIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return generateIndicesInto<GenerateLineStripIndicesAvx2>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(generateLineStripIndicesInto)>::type generateLineStripIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return generateIndicesInto<GenerateLineStripIndicesSse2>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(generateLineStripIndicesInto)>::type generateLineStripIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return generateIndicesInto<GenerateLineStripIndicesScalar>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(generateLineStripIndicesIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(generateLineStripIndicesIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateLineStripIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset))({
+    generateLineStripIndicesIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(indices, indexTypeSize, count, output, outputTypeSize, offset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(generateTriangleStripIndicesInto)>::type generateTriangleStripIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return generateIndicesInto<GenerateTriangleStripIndicesAvx2>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(generateTriangleStripIndicesInto)>::type generateTriangleStripIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return generateIndicesInto<GenerateTriangleStripIndicesSse2>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(generateTriangleStripIndicesInto)>::type generateTriangleStripIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return generateIndicesInto<GenerateTriangleStripIndicesScalar>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(generateTriangleStripIndicesIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(generateTriangleStripIndicesIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateTriangleStripIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset))({
+    generateTriangleStripIndicesIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(indices, indexTypeSize, count, output, outputTypeSize, offset);
+})
+
+namespace {
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(generateTriangleFanIndicesInto)>::type generateTriangleFanIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return generateIndicesInto<GenerateTriangleFanIndicesAvx2>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE2 typename std::decay<decltype(generateTriangleFanIndicesInto)>::type generateTriangleFanIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Sse2)) {
+    return generateIndicesInto<GenerateTriangleFanIndicesSse2>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(generateTriangleFanIndicesInto)>::type generateTriangleFanIndicesIntoImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return generateIndicesInto<GenerateTriangleFanIndicesScalar>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(generateTriangleFanIndicesIntoImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(generateTriangleFanIndicesIntoImplementation, void CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(generateTriangleFanIndicesInto)(const void* indices, std::size_t indexTypeSize, std::size_t count, void* output, std::size_t outputTypeSize, UnsignedInt offset))({
+    generateTriangleFanIndicesIntoImplementation(CORRADE_CPU_SELECT(Cpu::Default))(indices, indexTypeSize, count, output, outputTypeSize, offset);
+})
+
+}
+
+}}
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+MeshIndexType compressedIndexType(const UnsignedLong max) {
+    return max > 65535 ? MeshIndexType::UnsignedInt :
+           max > 255 ? MeshIndexType::UnsignedShort : MeshIndexType::UnsignedByte;
+}
+
+MeshIndexType compressedIndexType(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    return compressedIndexType(vertexCount ? UnsignedLong(offset) + vertexCount - 1 : 0);
+}
+
+template<class T> MeshIndexType compressedIndexType(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt offset) {
+    return compressedIndexType(indices.isEmpty() ? 0 : UnsignedLong(offset) + Math::max(indices));
+}
+
+template<class T> void generateTrivialIndicesIntoImplementation(const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(sizeof(T) == 4 || output.isEmpty() || UnsignedLong(offset) + output.size() - 1 <= UnsignedLong(T(~T{})),
+        "MeshTools::generateTrivialIndicesInto(): can't fit" << output.size() << "vertices with offset" << offset << "into" << sizeof(T)*8 << "bit indices", );
+
+    if(output.isContiguous())
+        return Implementation::generateTrivialIndicesInto(nullptr, 0, output.size(), output.data(), sizeof(T), offset);
+
+    for(std::size_t i = 0; i != output.size(); ++i)
+        output[i] = T(offset + i);
+}
+
+}
+
+void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTrivialIndicesIntoImplementation(output, offset);
+}
+
+void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTrivialIndicesIntoImplementation(output, offset);
+}
+
+void generateTrivialIndicesInto(const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTrivialIndicesIntoImplementation(output, offset);
+}
+
+Containers::Array<UnsignedInt> generateTrivialIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, vertexCount};
+    generateTrivialIndicesInto(output, offset);
+    return output;
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTrivialIndicesCompressed(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(vertexCount, offset);
+    Containers::Array<char> output{NoInit, vertexCount*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateTrivialIndicesIntoImplementation(Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateTrivialIndicesIntoImplementation(Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateTrivialIndicesIntoImplementation(Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+namespace {
+
+template<class T> void generateLineStripIndicesIntoImplementation(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 2,
+        "MeshTools::generateLineStripIndicesInto(): expected either zero or at least two vertices, got" << vertexCount, );
+
+    const UnsignedInt iMax = Math::max(vertexCount, 1u) - 1;
+    CORRADE_ASSERT(output.size() == 2*iMax,
+        "MeshTools::generateLineStripIndicesInto(): bad output size, expected" << 2*iMax << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(T) == 4 || vertexCount == 0 || UnsignedLong(offset) + vertexCount - 1 <= UnsignedLong(T(~T{})),
+        "MeshTools::generateLineStripIndicesInto(): can't fit" << vertexCount << "vertices with offset" << offset << "into" << sizeof(T)*8 << "bit indices", );
+
+    if(output.isContiguous())
+        return Implementation::generateLineStripIndicesInto(nullptr, 0, iMax, output.data(), sizeof(T), offset);
+
+    for(std::size_t i = 0; i != iMax; ++i) {
+        output[i*2 + 0] = T(offset + i);
+        output[i*2 + 1] = T(offset + i + 1);
+    }
+}
+
+template<class T, class U> void generateLineStripIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 2,
+        "MeshTools::generateLineStripIndicesInto(): expected either zero or at least two indices, got" << indices.size(), );
+
+    const UnsignedInt iMax = Math::max(indices.size(), std::size_t{1}) - 1;
+    CORRADE_ASSERT(output.size() == 2*iMax,
+        "MeshTools::generateLineStripIndicesInto(): bad output size, expected" << 2*iMax << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(U) == 4 || (sizeof(T) <= sizeof(U) && offset == 0) || indices.isEmpty() || UnsignedLong(offset) + Math::max(indices) <= UnsignedLong(U(~U{})),
+        "MeshTools::generateLineStripIndicesInto(): can't fit" << UnsignedLong(Math::max(indices)) + 1 << "vertices with offset" << offset << "into" << sizeof(U)*8 << "bit indices", );
+
+    if(output.isContiguous() && indices.isContiguous())
+        return Implementation::generateLineStripIndicesInto(indices.data(), sizeof(T), iMax, output.data(), sizeof(U), offset);
+
+    for(std::size_t i = 0; i != iMax; ++i) {
+        output[i*2 + 0] = U(offset + indices[i]);
+        output[i*2 + 1] = U(offset + indices[i + 1]);
+    }
+}
+
+template<class U> void generateLineStripIndicesIntoImplementation(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateLineStripIndicesInto(): second index view dimension is not contiguous", );
+    CORRADE_ASSERT(sizeof(U) == 4 || indices.size()[1] <= sizeof(U),
+        "MeshTools::generateLineStripIndicesInto(): can't generate" << sizeof(U)*8 << "bit indices from index type size" << indices.size()[1], );
+    if(indices.size()[1] == 4)
+        return generateLineStripIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
+    else if(indices.size()[1] == 2)
+        return generateLineStripIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
+    else if(indices.size()[1] == 1)
+        return generateLineStripIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateLineStripIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressedImplementation(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(vertexCount, offset);
+    Containers::Array<char> output{NoInit, 2*(Math::max(vertexCount, 1u) - 1)*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateLineStripIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateLineStripIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateLineStripIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressedImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(indices, offset);
+    Containers::Array<char> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateLineStripIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateLineStripIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateLineStripIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+}
+
+void generateLineStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateLineStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateLineStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateLineStripIndicesIntoImplementation(indices, output, offset);
+}
+
+Containers::Array<UnsignedInt> generateLineStripIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(vertexCount, 1u) - 1)};
+    generateLineStripIndicesInto(vertexCount, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)};
+    generateLineStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)};
+    generateLineStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size(), std::size_t{1}) - 1)};
+    generateLineStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineStripIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*(Math::max(indices.size()[0], std::size_t{1}) - 1)};
+    generateLineStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    return generateLineStripIndicesCompressedImplementation(vertexCount, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    return generateLineStripIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    return generateLineStripIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    return generateLineStripIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineStripIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateLineStripIndicesCompressed(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return generateLineStripIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), offset);
+    else if(indices.size()[1] == 2)
+        return generateLineStripIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), offset);
+    else if(indices.size()[1] == 1)
+        return generateLineStripIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateLineStripIndicesCompressed(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+}
+
+namespace {
+
+template<class T> void generateLineLoopIndicesIntoImplementation(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 2,
+        "MeshTools::generateLineLoopIndicesInto(): expected either zero or at least two vertices, got" << vertexCount, );
+    CORRADE_ASSERT(output.size() == 2*vertexCount,
+        "MeshTools::generateLineLoopIndicesInto(): bad output size, expected" << 2*vertexCount << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(T) == 4 || vertexCount == 0 || UnsignedLong(offset) + vertexCount - 1 <= UnsignedLong(T(~T{})),
+        "MeshTools::generateLineLoopIndicesInto(): can't fit" << vertexCount << "vertices with offset" << offset << "into" << sizeof(T)*8 << "bit indices", );
+
+    const UnsignedInt iMax = Math::max(vertexCount, 1u) - 1;
+    if(output.isContiguous())
+        Implementation::generateLineStripIndicesInto(nullptr, 0, iMax, output.data(), sizeof(T), offset);
+    else for(std::size_t i = 0; i != iMax; ++i) {
+        output[i*2 + 0] = T(offset + i);
+        output[i*2 + 1] = T(offset + i + 1);
+    }
+    if(vertexCount >= 2) {
+        output[2*vertexCount - 2] = T(offset + vertexCount - 1);
+        output[2*vertexCount - 1] = T(offset + 0);
+    }
+}
+
+template<class T, class U> void generateLineLoopIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 2,
+        "MeshTools::generateLineLoopIndicesInto(): expected either zero or at least two indices, got" << indices.size(), );
+    CORRADE_ASSERT(output.size() == 2*indices.size(),
+        "MeshTools::generateLineLoopIndicesInto(): bad output size, expected" << 2*indices.size() << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(U) == 4 || (sizeof(T) <= sizeof(U) && offset == 0) || indices.isEmpty() || UnsignedLong(offset) + Math::max(indices) <= UnsignedLong(U(~U{})),
+        "MeshTools::generateLineLoopIndicesInto(): can't fit" << UnsignedLong(Math::max(indices)) + 1 << "vertices with offset" << offset << "into" << sizeof(U)*8 << "bit indices", );
+
+    const std::size_t iMax = Math::max(indices.size(), std::size_t{1}) - 1;
+    if(output.isContiguous() && indices.isContiguous())
+        Implementation::generateLineStripIndicesInto(indices.data(), sizeof(T), iMax, output.data(), sizeof(U), offset);
+    else for(std::size_t i = 0; i != iMax; ++i) {
+        output[i*2 + 0] = U(offset + indices[i]);
+        output[i*2 + 1] = U(offset + indices[i + 1]);
+    }
+    if(indices.size() >= 2) {
+        output[2*indices.size() - 2] = U(offset + indices[indices.size() - 1]);
+        output[2*indices.size() - 1] = U(offset + indices[0]);
+    }
+}
+
+template<class U> void generateLineLoopIndicesIntoImplementation(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateLineLoopIndicesInto(): second index view dimension is not contiguous", );
+    CORRADE_ASSERT(sizeof(U) == 4 || indices.size()[1] <= sizeof(U),
+        "MeshTools::generateLineLoopIndicesInto(): can't generate" << sizeof(U)*8 << "bit indices from index type size" << indices.size()[1], );
+    if(indices.size()[1] == 4)
+        return generateLineLoopIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
+    else if(indices.size()[1] == 2)
+        return generateLineLoopIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
+    else if(indices.size()[1] == 1)
+        return generateLineLoopIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateLineLoopIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressedImplementation(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(vertexCount, offset);
+    Containers::Array<char> output{NoInit, 2*vertexCount*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateLineLoopIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateLineLoopIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateLineLoopIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressedImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(indices, offset);
+    Containers::Array<char> output{NoInit, 2*indices.size()*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateLineLoopIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateLineLoopIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateLineLoopIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+}
+
+void generateLineLoopIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateLineLoopIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateLineLoopIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
 
 void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
     generateLineLoopIndicesIntoImplementation(indices, output, offset);
 }
 
-void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateLineLoopIndicesIntoImplementation(indices, output, offset);
+}
+
+Containers::Array<UnsignedInt> generateLineLoopIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*vertexCount};
+    generateLineLoopIndicesInto(vertexCount, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()};
+    generateLineLoopIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()};
+    generateLineLoopIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()};
+    generateLineLoopIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()[0]};
+    generateLineLoopIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    return generateLineLoopIndicesCompressedImplementation(vertexCount, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    return generateLineLoopIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    return generateLineLoopIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    return generateLineLoopIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateLineLoopIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateLineLoopIndicesCompressed(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return generateLineLoopIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), offset);
+    else if(indices.size()[1] == 2)
+        return generateLineLoopIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), offset);
+    else if(indices.size()[1] == 1)
+        return generateLineLoopIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateLineLoopIndicesCompressed(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+}
+
+namespace {
+
+template<class T> void generateTriangleStripIndicesIntoImplementation(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 3,
+        "MeshTools::generateTriangleStripIndicesInto(): expected either zero or at least three vertices, got" << vertexCount, );
+
+    const UnsignedInt iMax = Math::max(vertexCount, 2u) - 2;
+    CORRADE_ASSERT(output.size() == 3*iMax,
+        "MeshTools::generateTriangleStripIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(T) == 4 || vertexCount == 0 || UnsignedLong(offset) + vertexCount - 1 <= UnsignedLong(T(~T{})),
+        "MeshTools::generateTriangleStripIndicesInto(): can't fit" << vertexCount << "vertices with offset" << offset << "into" << sizeof(T)*8 << "bit indices", );
+
+    if(output.isContiguous())
+        return Implementation::generateTriangleStripIndicesInto(nullptr, 0, iMax, output.data(), sizeof(T), offset);
+
+    for(std::size_t i = 0; i != iMax; ++i) {
+        const std::size_t odd = i & 1;
+        output[i*3 + 0] = T(offset + i + odd);
+        output[i*3 + 1] = T(offset + i + 1 - odd);
+        output[i*3 + 2] = T(offset + i + 2);
+    }
+}
+
+template<class T, class U> void generateTriangleStripIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 3,
+        "MeshTools::generateTriangleStripIndicesInto(): expected either zero or at least three indices, got" << indices.size(), );
+
+    const UnsignedInt iMax = Math::max(indices.size(), std::size_t{2}) - 2;
+    CORRADE_ASSERT(output.size() == 3*iMax,
+        "MeshTools::generateTriangleStripIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(U) == 4 || (sizeof(T) <= sizeof(U) && offset == 0) || indices.isEmpty() || UnsignedLong(offset) + Math::max(indices) <= UnsignedLong(U(~U{})),
+        "MeshTools::generateTriangleStripIndicesInto(): can't fit" << UnsignedLong(Math::max(indices)) + 1 << "vertices with offset" << offset << "into" << sizeof(U)*8 << "bit indices", );
+
+    if(output.isContiguous() && indices.isContiguous())
+        return Implementation::generateTriangleStripIndicesInto(indices.data(), sizeof(T), iMax, output.data(), sizeof(U), offset);
+
+    for(std::size_t i = 0; i != iMax; ++i) {
+        const std::size_t odd = i & 1;
+        output[i*3 + 0] = U(offset + indices[i + odd]);
+        output[i*3 + 1] = U(offset + indices[i + 1 - odd]);
+        output[i*3 + 2] = U(offset + indices[i + 2]);
+    }
+}
+
+template<class U> void generateTriangleStripIndicesIntoImplementation(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTriangleStripIndicesInto(): second index view dimension is not contiguous", );
+    CORRADE_ASSERT(sizeof(U) == 4 || indices.size()[1] <= sizeof(U),
+        "MeshTools::generateTriangleStripIndicesInto(): can't generate" << sizeof(U)*8 << "bit indices from index type size" << indices.size()[1], );
+    if(indices.size()[1] == 4)
+        return generateTriangleStripIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
+    else if(indices.size()[1] == 2)
+        return generateTriangleStripIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
+    else if(indices.size()[1] == 1)
+        return generateTriangleStripIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateTriangleStripIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressedImplementation(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(vertexCount, offset);
+    Containers::Array<char> output{NoInit, 3*(Math::max(vertexCount, 2u) - 2)*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateTriangleStripIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateTriangleStripIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateTriangleStripIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressedImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(indices, offset);
+    Containers::Array<char> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateTriangleStripIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateTriangleStripIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateTriangleStripIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+}
+
+void generateTriangleStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+}
+
+Containers::Array<UnsignedInt> generateTriangleStripIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(vertexCount, 2u) - 2)};
+    generateTriangleStripIndicesInto(vertexCount, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
+    generateTriangleStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
+    generateTriangleStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
+    generateTriangleStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size()[0], std::size_t{2}) - 2)};
+    generateTriangleStripIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    return generateTriangleStripIndicesCompressedImplementation(vertexCount, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    return generateTriangleStripIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    return generateTriangleStripIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    return generateTriangleStripIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleStripIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTriangleStripIndicesCompressed(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return generateTriangleStripIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), offset);
+    else if(indices.size()[1] == 2)
+        return generateTriangleStripIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), offset);
+    else if(indices.size()[1] == 1)
+        return generateTriangleStripIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateTriangleStripIndicesCompressed(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+}
+
+namespace {
+
+template<class T> void generateTriangleFanIndicesIntoImplementation(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 3,
+        "MeshTools::generateTriangleFanIndicesInto(): expected either zero or at least three vertices, got" << vertexCount, );
+
+    const UnsignedInt iMax = Math::max(vertexCount, 2u) - 2;
+    CORRADE_ASSERT(output.size() == 3*iMax,
+        "MeshTools::generateTriangleFanIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(T) == 4 || vertexCount == 0 || UnsignedLong(offset) + vertexCount - 1 <= UnsignedLong(T(~T{})),
+        "MeshTools::generateTriangleFanIndicesInto(): can't fit" << vertexCount << "vertices with offset" << offset << "into" << sizeof(T)*8 << "bit indices", );
+
+    if(output.isContiguous())
+        return Implementation::generateTriangleFanIndicesInto(nullptr, 0, iMax, output.data(), sizeof(T), offset);
+
+    for(std::size_t i = 0; i != iMax; ++i) {
+        output[i*3 + 0] = T(offset + 0);
+        output[i*3 + 1] = T(offset + i + 1);
+        output[i*3 + 2] = T(offset + i + 2);
+    }
+}
+
+template<class T, class U> void generateTriangleFanIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 3,
+        "MeshTools::generateTriangleFanIndicesInto(): expected either zero or at least three indices, got" << indices.size(), );
+
+    const UnsignedInt iMax = Math::max(indices.size(), std::size_t{2}) - 2;
+    CORRADE_ASSERT(output.size() == 3*iMax,
+        "MeshTools::generateTriangleFanIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+    CORRADE_ASSERT(sizeof(U) == 4 || (sizeof(T) <= sizeof(U) && offset == 0) || indices.isEmpty() || UnsignedLong(offset) + Math::max(indices) <= UnsignedLong(U(~U{})),
+        "MeshTools::generateTriangleFanIndicesInto(): can't fit" << UnsignedLong(Math::max(indices)) + 1 << "vertices with offset" << offset << "into" << sizeof(U)*8 << "bit indices", );
+
+    if(output.isContiguous() && indices.isContiguous())
+        return Implementation::generateTriangleFanIndicesInto(indices.data(), sizeof(T), iMax, output.data(), sizeof(U), offset);
+
+    for(std::size_t i = 0; i != iMax; ++i) {
+        output[i*3 + 0] = U(offset + indices[0]);
+        output[i*3 + 1] = U(offset + indices[i + 1]);
+        output[i*3 + 2] = U(offset + indices[i + 2]);
+    }
+}
+
+template<class U> void generateTriangleFanIndicesIntoImplementation(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<U>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTriangleFanIndicesInto(): second index view dimension is not contiguous", );
+    CORRADE_ASSERT(sizeof(U) == 4 || indices.size()[1] <= sizeof(U),
+        "MeshTools::generateTriangleFanIndicesInto(): can't generate" << sizeof(U)*8 << "bit indices from index type size" << indices.size()[1], );
+    if(indices.size()[1] == 4)
+        return generateTriangleFanIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
+    else if(indices.size()[1] == 2)
+        return generateTriangleFanIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
+    else if(indices.size()[1] == 1)
+        return generateTriangleFanIndicesIntoImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateTriangleFanIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressedImplementation(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(vertexCount, offset);
+    Containers::Array<char> output{NoInit, 3*(Math::max(vertexCount, 2u) - 2)*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateTriangleFanIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateTriangleFanIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateTriangleFanIndicesIntoImplementation(vertexCount, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressedImplementation(const Containers::StridedArrayView1D<const T>& indices, const UnsignedInt offset) {
+    const MeshIndexType type = compressedIndexType(indices, offset);
+    Containers::Array<char> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)*meshIndexTypeSize(type)};
+    if(type == MeshIndexType::UnsignedInt)
+        generateTriangleFanIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedInt>(output)), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        generateTriangleFanIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedShort>(output)), offset);
+    else
+        generateTriangleFanIndicesIntoImplementation(indices, Containers::stridedArrayView(Containers::arrayCast<UnsignedByte>(output)), offset);
+    return {Utility::move(output), type};
+}
+
+}
+
+void generateTriangleFanIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(vertexCount, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+}
+
+Containers::Array<UnsignedInt> generateTriangleFanIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(vertexCount, 2u) - 2)};
+    generateTriangleFanIndicesInto(vertexCount, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
+    generateTriangleFanIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
+    generateTriangleFanIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
+    generateTriangleFanIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size()[0], std::size_t{2}) - 2)};
+    generateTriangleFanIndicesInto(indices, output, offset);
+    return output;
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const UnsignedInt vertexCount, const UnsignedInt offset) {
+    return generateTriangleFanIndicesCompressedImplementation(vertexCount, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
+    return generateTriangleFanIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
+    return generateTriangleFanIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
+    return generateTriangleFanIndicesCompressedImplementation(indices, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> generateTriangleFanIndicesCompressed(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTriangleFanIndicesCompressed(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return generateTriangleFanIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), offset);
+    else if(indices.size()[1] == 2)
+        return generateTriangleFanIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), offset);
+    else if(indices.size()[1] == 1)
+        return generateTriangleFanIndicesCompressedImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateTriangleFanIndicesCompressed(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+}
+
+namespace {
+
+template<class T> inline void generateQuadIndicesIntoImplementation(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const T>& quads, const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
+    CORRADE_ASSERT(quads.size() % 4 == 0,
+        "MeshTools::generateQuadIndicesInto(): quad index count" << quads.size() << "not divisible by 4", );
+    CORRADE_ASSERT(quads.size()*6/4 == output.size(),
+        "MeshTools::generateQuadIndicesInto(): bad output size, expected" << quads.size()*6/4 << "but got" << output.size(), );
+
+    for(std::size_t i = 0, max = quads.size()/4; i != max; ++i) {
+        auto get = [&](UnsignedInt j) -> const Vector3& {
+            UnsignedInt index = quads[4*i + j];
+            CORRADE_ASSERT(index < positions.size(),
+                "MeshTools::generateQuadIndicesInto(): index" << index << "out of range for" << positions.size() << "elements", positions[0]);
+            return positions[index];
+        };
+        const Vector3& a = get(0);
+        const Vector3& b = get(1);
+        const Vector3& c = get(2);
+        const Vector3& d = get(3);
+
+        constexpr UnsignedInt SplitAbcAcd[] { 0, 1, 2, 0, 2, 3 };
+        constexpr UnsignedInt SplitDabDbc[] { 3, 0, 1, 3, 1, 2 };
+        const UnsignedInt* split;
+        const bool abcAcdOppositeDirection = Math::dot(Math::cross(c - b, a - b), Math::cross(d - c, a - c)) < 0.0f;
+        const bool dabDbcOppositeDirection = Math::dot(Math::cross(d - b, a - b), Math::cross(c - b, d - b)) < 0.0f;
+
+        if(abcAcdOppositeDirection != dabDbcOppositeDirection)
+            split = abcAcdOppositeDirection ? SplitDabDbc : SplitAbcAcd;
+
+        else split = (b - d).dot() < (c - a).dot() ? SplitDabDbc : SplitAbcAcd;
+
+        for(std::size_t j = 0; j != 6; ++j)
+            output[6*i + j] = offset + quads[4*i + split[j]];
+    }
+}
+
+}
+
+Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedInt>& quads, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> out{NoInit, quads.size()*6/4};
+    generateQuadIndicesIntoImplementation(positions, quads, Containers::stridedArrayView(out), offset);
+    return out;
+}
+
+Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedShort>& quads, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> out{ValueInit, quads.size()*6/4};
+    generateQuadIndicesIntoImplementation(positions, quads,
+        Containers::StridedArrayView1D<UnsignedShort>{
+            Containers::arrayCast<UnsignedShort>(out),
+            reinterpret_cast<UnsignedShort*>(out.data())
+                #ifdef CORRADE_TARGET_BIG_ENDIAN
+                + 1
+                #endif
+            , out.size(), 4},
+        offset);
+    return out;
+}
+
+Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedByte>& quads, const UnsignedInt offset) {
+    Containers::Array<UnsignedInt> out{ValueInit, quads.size()*6/4};
+    generateQuadIndicesIntoImplementation(positions, quads,
+        Containers::StridedArrayView1D<UnsignedByte>{
+            Containers::arrayCast<UnsignedByte>(out),
+            reinterpret_cast<UnsignedByte*>(out.data())
+                #ifdef CORRADE_TARGET_BIG_ENDIAN
+                + 3
+                #endif
+            , out.size(), 4},
+        offset);
+    return out;
+}
+
+void generateQuadIndicesInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedInt>& quads, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
+    return generateQuadIndicesIntoImplementation(positions, quads, output, offset);
+}
+
+void generateQuadIndicesInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedShort>& quads, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
+    return generateQuadIndicesIntoImplementation(positions, quads, output, offset);
+}
+
+void generateQuadIndicesInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedByte>& quads, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
+    return generateQuadIndicesIntoImplementation(positions, quads, output, offset);
+}
+
+}}
+namespace Magnum { namespace MeshTools {
+
+namespace Implementation {
+
+extern Containers::Pair<UnsignedInt, UnsignedInt> CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(compressIndicesMinMax)(const void* indices, std::size_t indexTypeSize, std::size_t size);
+
+namespace {
+
+template<class Kernel> Containers::Pair<UnsignedInt, UnsignedInt> indexMinMax(const void* indices, std::size_t indexTypeSize, std::size_t size) {
+    if(indexTypeSize == 4)
+        return Kernel::run(static_cast<const UnsignedInt*>(indices), size);
+    else if(indexTypeSize == 2)
+        return Kernel::run(static_cast<const UnsignedShort*>(indices), size);
+    else
+        return Kernel::run(static_cast<const UnsignedByte*>(indices), size);
+}
+
+template<class T> Containers::Pair<UnsignedInt, UnsignedInt> indexMinMaxScalar(const T* const indices, const std::size_t size) {
+    T min = T(~T{});
+    T max = T{};
+    for(std::size_t i = 0; i != size; ++i) {
+        min = Math::min(min, indices[i]);
+        max = Math::max(max, indices[i]);
+    }
+    return {min, max};
+}
+
+struct IndexMinMaxScalar {
+    template<class T> static Containers::Pair<UnsignedInt, UnsignedInt> run(const T* const indices, const std::size_t size) {
+        return indexMinMaxScalar(indices, size);
+    }
+};
+
+template<class T, class Vector> Containers::Pair<UnsignedInt, UnsignedInt> indexMinMaxReduce(const Vector& min, const Vector& max) {
+    T mins[sizeof(Vector)/sizeof(T)];
+    T maxs[sizeof(Vector)/sizeof(T)];
+    std::memcpy(mins, &min, sizeof(Vector));
+    std::memcpy(maxs, &max, sizeof(Vector));
+    T minValue = mins[0];
+    T maxValue = maxs[0];
+    for(std::size_t i = 1; i != sizeof(Vector)/sizeof(T); ++i) {
+        minValue = Math::min(minValue, mins[i]);
+        maxValue = Math::max(maxValue, maxs[i]);
+    }
+    return {minValue, maxValue};
+}
+
+#ifdef CORRADE_ENABLE_SSE41
+template<class> struct IndexMinMaxSse41;
+
+template<> struct IndexMinMaxSse41<UnsignedInt> {
+    CORRADE_ENABLE_SSE41 static __m128i min(const __m128i a, const __m128i b) { return _mm_min_epu32(a, b); }
+    CORRADE_ENABLE_SSE41 static __m128i max(const __m128i a, const __m128i b) { return _mm_max_epu32(a, b); }
+};
+
+template<> struct IndexMinMaxSse41<UnsignedShort> {
+    CORRADE_ENABLE_SSE41 static __m128i min(const __m128i a, const __m128i b) { return _mm_min_epu16(a, b); }
+    CORRADE_ENABLE_SSE41 static __m128i max(const __m128i a, const __m128i b) { return _mm_max_epu16(a, b); }
+};
+
+template<> struct IndexMinMaxSse41<UnsignedByte> {
+    CORRADE_ENABLE_SSE41 static __m128i min(const __m128i a, const __m128i b) { return _mm_min_epu8(a, b); }
+    CORRADE_ENABLE_SSE41 static __m128i max(const __m128i a, const __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+struct IndexMinMaxSse41Kernel {
+    template<class T> CORRADE_ENABLE_SSE41 static Containers::Pair<UnsignedInt, UnsignedInt> run(const T* const indices, const std::size_t size) {
+        constexpr std::size_t Lanes = 16/sizeof(T);
+        if(size < Lanes) return IndexMinMaxScalar::run(indices, size);
+
+        __m128i min0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + size - Lanes));
+        __m128i max0 = min0;
+        __m128i min1 = min0;
+        __m128i max1 = min0;
+        std::size_t i = 0;
+        for(; i + 2*Lanes <= size; i += 2*Lanes) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+            const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i + Lanes));
+            min0 = IndexMinMaxSse41<T>::min(min0, a);
+            max0 = IndexMinMaxSse41<T>::max(max0, a);
+            min1 = IndexMinMaxSse41<T>::min(min1, b);
+            max1 = IndexMinMaxSse41<T>::max(max1, b);
+        }
+        if(i + Lanes <= size) {
+            const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+            min0 = IndexMinMaxSse41<T>::min(min0, a);
+            max0 = IndexMinMaxSse41<T>::max(max0, a);
+        }
+
+        return indexMinMaxReduce<T>(IndexMinMaxSse41<T>::min(min0, min1), IndexMinMaxSse41<T>::max(max0, max1));
+    }
+};
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+template<class> struct IndexMinMaxAvx2;
+
+template<> struct IndexMinMaxAvx2<UnsignedInt> {
+    CORRADE_ENABLE_AVX2 static __m256i min(const __m256i a, const __m256i b) { return _mm256_min_epu32(a, b); }
+    CORRADE_ENABLE_AVX2 static __m256i max(const __m256i a, const __m256i b) { return _mm256_max_epu32(a, b); }
+};
+
+template<> struct IndexMinMaxAvx2<UnsignedShort> {
+    CORRADE_ENABLE_AVX2 static __m256i min(const __m256i a, const __m256i b) { return _mm256_min_epu16(a, b); }
+    CORRADE_ENABLE_AVX2 static __m256i max(const __m256i a, const __m256i b) { return _mm256_max_epu16(a, b); }
+};
+
+template<> struct IndexMinMaxAvx2<UnsignedByte> {
+    CORRADE_ENABLE_AVX2 static __m256i min(const __m256i a, const __m256i b) { return _mm256_min_epu8(a, b); }
+    CORRADE_ENABLE_AVX2 static __m256i max(const __m256i a, const __m256i b) { return _mm256_max_epu8(a, b); }
+};
+
+struct IndexMinMaxAvx2Kernel {
+    template<class T> CORRADE_ENABLE_AVX2 static Containers::Pair<UnsignedInt, UnsignedInt> run(const T* const indices, const std::size_t size) {
+        constexpr std::size_t Lanes = 32/sizeof(T);
+        if(size < Lanes) return IndexMinMaxScalar::run(indices, size);
+
+        __m256i min0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + size - Lanes));
+        __m256i max0 = min0;
+        __m256i min1 = min0;
+        __m256i max1 = min0;
+        std::size_t i = 0;
+        for(; i + 2*Lanes <= size; i += 2*Lanes) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i + Lanes));
+            min0 = IndexMinMaxAvx2<T>::min(min0, a);
+            max0 = IndexMinMaxAvx2<T>::max(max0, a);
+            min1 = IndexMinMaxAvx2<T>::min(min1, b);
+            max1 = IndexMinMaxAvx2<T>::max(max1, b);
+        }
+        if(i + Lanes <= size) {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            min0 = IndexMinMaxAvx2<T>::min(min0, a);
+            max0 = IndexMinMaxAvx2<T>::max(max0, a);
+        }
+
+        return indexMinMaxReduce<T>(IndexMinMaxAvx2<T>::min(min0, min1), IndexMinMaxAvx2<T>::max(max0, max1));
+    }
+};
+#endif
+
+#ifdef CORRADE_ENABLE_AVX2
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_AVX2 typename std::decay<decltype(compressIndicesMinMax)>::type compressIndicesMinMaxImplementation(CORRADE_CPU_DECLARE(Cpu::Avx2)) {
+    return indexMinMax<IndexMinMaxAvx2Kernel>;
+}
+#endif
+
+#ifdef CORRADE_ENABLE_SSE41
+CORRADE_UTILITY_CPU_MAYBE_UNUSED CORRADE_ENABLE_SSE41 typename std::decay<decltype(compressIndicesMinMax)>::type compressIndicesMinMaxImplementation(CORRADE_CPU_DECLARE(Cpu::Sse41)) {
+    return indexMinMax<IndexMinMaxSse41Kernel>;
+}
+#endif
+
+CORRADE_UTILITY_CPU_MAYBE_UNUSED typename std::decay<decltype(compressIndicesMinMax)>::type compressIndicesMinMaxImplementation(CORRADE_CPU_DECLARE(Cpu::Scalar)) {
+    return indexMinMax<IndexMinMaxScalar>;
+}
+
+}
+
+CORRADE_UTILITY_CPU_DISPATCHER(compressIndicesMinMaxImplementation)
+CORRADE_UTILITY_CPU_DISPATCHED(compressIndicesMinMaxImplementation, Containers::Pair<UnsignedInt, UnsignedInt> CORRADE_UTILITY_CPU_DISPATCHED_DECLARATION(compressIndicesMinMax)(const void* indices, std::size_t indexTypeSize, std::size_t size))({
+    return compressIndicesMinMaxImplementation(CORRADE_CPU_SELECT(Cpu::Default))(indices, indexTypeSize, size);
+})
+
+}
+
+namespace {
+
+template<class T> Containers::Pair<UnsignedInt, UnsignedInt> indexRange(const Containers::StridedArrayView1D<const T>& indices) {
+    if(indices.isEmpty()) return {};
+    if(indices.isContiguous())
+        return Implementation::compressIndicesMinMax(indices.data(), sizeof(T), indices.size());
+
+    const Containers::Pair<T, T> minmax = Math::minmaxBatched(indices);
+    return {minmax.first(), minmax.second()};
+}
+
+template<class T, class U> void compressIndicesInto(const Containers::StridedArrayView1D<const T>& indices, const Containers::ArrayView<U>& output, const Long offset) {
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        output[i] = U(indices[i] - offset);
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::Pair<UnsignedInt, UnsignedInt>& range, const MeshIndexType atLeast, const Long offset) {
+    CORRADE_ASSERT(indices.isEmpty() || (Long(range.first()) - offset >= 0 && Long(range.second()) - offset <= Long(0xffffffffu)),
+        "MeshTools::compressIndices(): can't offset index range" << range.first() << "to" << range.second() << "by" << offset, {});
+
+    const MeshIndexType fits = compressedIndexType(indices.isEmpty() ? 0 : UnsignedLong(Long(range.second()) - offset));
+    const MeshIndexType type = UnsignedByte(fits) > UnsignedByte(atLeast) ? fits : atLeast;
+    Containers::Array<char> output{NoInit, indices.size()*meshIndexTypeSize(type)};
+
+    if(indices.isContiguous())
+        Implementation::generateTrivialIndicesInto(indices.data(), sizeof(T), indices.size(), output.data(), meshIndexTypeSize(type), UnsignedInt(-offset));
+    else if(type == MeshIndexType::UnsignedInt)
+        compressIndicesInto(indices, Containers::arrayCast<UnsignedInt>(output), offset);
+    else if(type == MeshIndexType::UnsignedShort)
+        compressIndicesInto(indices, Containers::arrayCast<UnsignedShort>(output), offset);
+    else
+        compressIndicesInto(indices, Containers::arrayCast<UnsignedByte>(output), offset);
+
+    return {Utility::move(output), type};
+}
+
+template<class T> Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndicesImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast, const Long offset) {
+    return compressIndicesImplementation(indices, indexRange(indices), atLeast, offset);
+}
+
+template<class T> Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertexImplementation(const Containers::StridedArrayView1D<const T>& indices, const MeshIndexType atLeast) {
+    const Containers::Pair<UnsignedInt, UnsignedInt> range = indexRange(indices);
+    Containers::Pair<Containers::Array<char>, MeshIndexType> out = compressIndicesImplementation(indices, range, atLeast, range.first());
+    return {Utility::move(out.first()), out.second(), range.first()};
+}
+
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const MeshIndexType atLeast, const Long offset) {
+    return compressIndicesImplementation(indices, atLeast, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const MeshIndexType atLeast, const Long offset) {
+    return compressIndicesImplementation(indices, atLeast, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const MeshIndexType atLeast, const Long offset) {
+    return compressIndicesImplementation(indices, atLeast, offset);
+}
+
+Containers::Pair<Containers::Array<char>, MeshIndexType> compressIndices(const Containers::StridedArrayView2D<const char>& indices, const MeshIndexType atLeast, const Long offset) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::compressIndices(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return compressIndicesImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), atLeast, offset);
+    else if(indices.size()[1] == 2)
+        return compressIndicesImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), atLeast, offset);
+    else if(indices.size()[1] == 1)
+        return compressIndicesImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), atLeast, offset);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::compressIndices(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+}
+
+Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const MeshIndexType atLeast) {
+    return compressIndicesBaseVertexImplementation(indices, atLeast);
+}
+
+Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const MeshIndexType atLeast) {
+    return compressIndicesBaseVertexImplementation(indices, atLeast);
+}
+
+Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const MeshIndexType atLeast) {
+    return compressIndicesBaseVertexImplementation(indices, atLeast);
+}
+
+Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressIndicesBaseVertex(const Containers::StridedArrayView2D<const char>& indices, const MeshIndexType atLeast) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::compressIndicesBaseVertex(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return compressIndicesBaseVertexImplementation(Containers::arrayCast<1, const UnsignedInt>(indices), atLeast);
+    else if(indices.size()[1] == 2)
+        return compressIndicesBaseVertexImplementation(Containers::arrayCast<1, const UnsignedShort>(indices), atLeast);
+    else if(indices.size()[1] == 1)
+        return compressIndicesBaseVertexImplementation(Containers::arrayCast<1, const UnsignedByte>(indices), atLeast);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::compressIndicesBaseVertex(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
+}
+
+}}
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class View> UnsignedInt vertexCacheMisses(const View& indices, const std::size_t size, UnsignedInt* const cacheTime, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    std::memset(cacheTime, 0, vertexCount*sizeof(UnsignedInt));
+    UnsignedInt time = cacheSize + 1;
+    UnsignedInt misses = 0;
+    for(std::size_t i = 0; i != size; ++i) {
+        const UnsignedInt v = indices[i];
+        if(time - cacheTime[v] > cacheSize) {
+            cacheTime[v] = time++;
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+template<class T> Containers::Pair<Float, Float> optimizeVertexCacheInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount, Containers::Array<char>& scratch, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.size() % 3 == 0,
+        "MeshTools::optimizeVertexCacheInPlace(): expected index count divisible by 3, got" << indices.size(), {});
+
+    const std::size_t indexCount = indices.size();
+    const std::size_t triangleCount = indexCount/3;
+    if(!triangleCount) return {};
+
+    const std::size_t scratchSize = (3*std::size_t(vertexCount) + 1 + 3*indexCount)*sizeof(UnsignedInt) + triangleCount;
+    if(scratch.size() < scratchSize)
+        scratch = Containers::Array<char>{NoInit, scratchSize};
+    UnsignedInt* const cacheTime = reinterpret_cast<UnsignedInt*>(scratch.data());
+    UnsignedInt* const liveTriangles = cacheTime + vertexCount;
+    UnsignedInt* const adjacencyOffsets = liveTriangles + vertexCount;
+    UnsignedInt* const adjacency = adjacencyOffsets + vertexCount + 1;
+    UnsignedInt* const deadEnd = adjacency + indexCount;
+    UnsignedInt* const output = deadEnd + indexCount;
+    bool* const emitted = reinterpret_cast<bool*>(output + indexCount);
+
+    std::memset(liveTriangles, 0, vertexCount*sizeof(UnsignedInt));
+    for(std::size_t i = 0; i != indexCount; ++i) {
+        CORRADE_ASSERT(indices[i] < vertexCount,
+            "MeshTools::optimizeVertexCacheInPlace(): index" << UnsignedInt(indices[i]) << "out of range for" << vertexCount << "vertices", {});
+        ++liveTriangles[indices[i]];
+    }
+
+    adjacencyOffsets[0] = 0;
+    for(UnsignedInt v = 0; v != vertexCount; ++v) {
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+        cacheTime[v] = adjacencyOffsets[v];
+    }
+    for(std::size_t i = 0; i != indexCount; ++i)
+        adjacency[cacheTime[indices[i]]++] = UnsignedInt(i/3);
+
+    const UnsignedInt missesBefore = vertexCacheMisses(indices, indexCount, cacheTime, vertexCount, cacheSize);
+
+    std::memset(cacheTime, 0, vertexCount*sizeof(UnsignedInt));
+    std::memset(emitted, 0, triangleCount);
+    UnsignedInt time = cacheSize + 1;
+    UnsignedInt cursor = 0;
+    std::size_t stackSize = 0;
+    std::size_t outputSize = 0;
+    UnsignedInt fanning = indices[0];
+    while(fanning != ~UnsignedInt{}) {
+        const std::size_t candidatesBegin = stackSize;
+        for(UnsignedInt j = adjacencyOffsets[fanning], jMax = adjacencyOffsets[fanning + 1]; j != jMax; ++j) {
+            const UnsignedInt triangle = adjacency[j];
+            if(emitted[triangle]) continue;
+            emitted[triangle] = true;
+
+            for(std::size_t k = 0; k != 3; ++k) {
+                const UnsignedInt v = indices[triangle*3 + k];
+                output[outputSize++] = v;
+                deadEnd[stackSize++] = v;
+                --liveTriangles[v];
+                if(time - cacheTime[v] > cacheSize)
+                    cacheTime[v] = time++;
+            }
+        }
+
+        fanning = ~UnsignedInt{};
+        Long bestPriority = -1;
+        for(std::size_t i = candidatesBegin; i != stackSize; ++i) {
+            const UnsignedInt v = deadEnd[i];
+            if(!liveTriangles[v]) continue;
+
+            const UnsignedInt age = time - cacheTime[v];
+            const Long priority = UnsignedLong(age) + 2*UnsignedLong(liveTriangles[v]) <= cacheSize ? age : 0;
+            if(priority > bestPriority) {
+                bestPriority = priority;
+                fanning = v;
+            }
+        }
+
+        if(fanning == ~UnsignedInt{}) {
+            while(stackSize) {
+                const UnsignedInt v = deadEnd[--stackSize];
+                if(liveTriangles[v]) {
+                    fanning = v;
+                    break;
+                }
+            }
+        }
+
+        if(fanning == ~UnsignedInt{}) {
+            for(; cursor != vertexCount; ++cursor) if(liveTriangles[cursor]) {
+                fanning = cursor;
+                break;
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i != indexCount; ++i)
+        indices[i] = T(output[i]);
+
+    const UnsignedInt missesAfter = vertexCacheMisses(output, indexCount, cacheTime, vertexCount, cacheSize);
+    return {Float(missesBefore)/triangleCount, Float(missesAfter)/triangleCount};
 }
 
-void generateLineLoopIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateLineLoopIndicesInto(): second index view dimension is not contiguous", );
-    if(indices.size()[1] == 4)
-        return generateLineLoopIndicesInto(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
-    else if(indices.size()[1] == 2)
-        return generateLineLoopIndicesInto(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
-    else if(indices.size()[1] == 1)
-        return generateLineLoopIndicesInto(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
-    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateLineLoopIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
 }
 
-Containers::Array<UnsignedInt> generateLineLoopIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*vertexCount};
-    generateLineLoopIndicesInto(vertexCount, output, offset);
-    return output;
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount, Containers::Array<char>& scratch, const UnsignedInt cacheSize) {
+    return optimizeVertexCacheInPlaceImplementation(indices, vertexCount, scratch, cacheSize);
 }
 
-Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()};
-    generateLineLoopIndicesInto(indices, output, offset);
-    return output;
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount, Containers::Array<char>& scratch, const UnsignedInt cacheSize) {
+    return optimizeVertexCacheInPlaceImplementation(indices, vertexCount, scratch, cacheSize);
 }
 
-Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()};
-    generateLineLoopIndicesInto(indices, output, offset);
-    return output;
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount, Containers::Array<char>& scratch, const UnsignedInt cacheSize) {
+    return optimizeVertexCacheInPlaceImplementation(indices, vertexCount, scratch, cacheSize);
 }
 
-Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()};
-    generateLineLoopIndicesInto(indices, output, offset);
-    return output;
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount, Containers::Array<char>& scratch, const UnsignedInt cacheSize) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexCacheInPlace(): second index view dimension is not contiguous", {});
+    if(indices.size()[1] == 4)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), vertexCount, scratch, cacheSize);
+    else if(indices.size()[1] == 2)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), vertexCount, scratch, cacheSize);
+    else if(indices.size()[1] == 1)
+        return optimizeVertexCacheInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), vertexCount, scratch, cacheSize);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::optimizeVertexCacheInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
 }
 
-Containers::Array<UnsignedInt> generateLineLoopIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 2*indices.size()[0]};
-    generateLineLoopIndicesInto(indices, output, offset);
-    return output;
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    Containers::Array<char> scratch;
+    return optimizeVertexCacheInPlaceImplementation(indices, vertexCount, scratch, cacheSize);
 }
 
-void generateTriangleStripIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 3,
-        "MeshTools::generateTriangleStripIndicesInto(): expected either zero or at least three vertices, got" << vertexCount, );
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    Containers::Array<char> scratch;
+    return optimizeVertexCacheInPlaceImplementation(indices, vertexCount, scratch, cacheSize);
+}
 
-    const UnsignedInt iMax = Math::max(vertexCount, 2u) - 2;
-    CORRADE_ASSERT(output.size() == 3*iMax,
-        "MeshTools::generateTriangleStripIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    Containers::Array<char> scratch;
+    return optimizeVertexCacheInPlaceImplementation(indices, vertexCount, scratch, cacheSize);
+}
 
-    for(std::size_t i = 0; i != iMax; ++i) {
-        output[i*3 + 0] = offset + (i % 2 ? i + 1 : i);
-        output[i*3 + 1] = offset + (i % 2 ? i : i + 1);
-        output[i*3 + 2] = offset + i + 2;
-    }
+Containers::Pair<Float, Float> optimizeVertexCacheInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount, const UnsignedInt cacheSize) {
+    Containers::Array<char> scratch;
+    return optimizeVertexCacheInPlace(indices, vertexCount, scratch, cacheSize);
 }
 
+}}
+namespace Magnum { namespace MeshTools {
+
 namespace {
 
-template<class T> void generateTriangleStripIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 3,
-        "MeshTools::generateTriangleStripIndicesInto(): expected either zero or at least three indices, got" << indices.size(), );
+template<class T> Containers::Array<UnsignedInt> optimizeVertexFetchInPlaceImplementation(const Containers::StridedArrayView1D<T>& indices, const UnsignedInt vertexCount) {
+    Containers::Array<UnsignedInt> remap{DirectInit, vertexCount, ~UnsignedInt{}};
+    UnsignedInt next = 0;
+    for(std::size_t i = 0, iMax = indices.size(); i != iMax; ++i) {
+        const UnsignedInt v = indices[i];
+        CORRADE_ASSERT(v < vertexCount,
+            "MeshTools::optimizeVertexFetchInPlace(): index" << v << "out of range for" << vertexCount << "vertices", {});
+        if(remap[v] == ~UnsignedInt{}) remap[v] = next++;
+        indices[i] = T(remap[v]);
+    }
 
-    const UnsignedInt iMax = Math::max(indices.size(), std::size_t{2}) - 2;
-    CORRADE_ASSERT(output.size() == 3*iMax,
-        "MeshTools::generateTriangleStripIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+    for(UnsignedInt& i: remap)
+        if(i == ~UnsignedInt{}) i = next++;
 
-    for(std::size_t i = 0; i != iMax; ++i) {
-        output[i*3 + 0] = offset + indices[i % 2 ? i + 1 : i];
-        output[i*3 + 1] = offset + indices[i % 2 ? i : i + 1];
-        output[i*3 + 2] = offset + indices[i + 2];
-    }
+    return remap;
 }
 
 }
 
-void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexCount);
 }
 
-void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedShort>& indices, const UnsignedInt vertexCount) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexCount);
 }
 
-void generateTriangleStripIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateTriangleStripIndicesIntoImplementation(indices, output, offset);
+Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView1D<UnsignedByte>& indices, const UnsignedInt vertexCount) {
+    return optimizeVertexFetchInPlaceImplementation(indices, vertexCount);
 }
 
-void generateTriangleStripIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTriangleStripIndicesInto(): second index view dimension is not contiguous", );
+Containers::Array<UnsignedInt> optimizeVertexFetchInPlace(const Containers::StridedArrayView2D<char>& indices, const UnsignedInt vertexCount) {
+    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::optimizeVertexFetchInPlace(): second index view dimension is not contiguous", {});
     if(indices.size()[1] == 4)
-        return generateTriangleStripIndicesInto(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedInt>(indices), vertexCount);
     else if(indices.size()[1] == 2)
-        return generateTriangleStripIndicesInto(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedShort>(indices), vertexCount);
     else if(indices.size()[1] == 1)
-        return generateTriangleStripIndicesInto(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
-    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateTriangleStripIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+        return optimizeVertexFetchInPlaceImplementation(Containers::arrayCast<1, UnsignedByte>(indices), vertexCount);
+    else CORRADE_ASSERT_UNREACHABLE("MeshTools::optimizeVertexFetchInPlace(): expected index type size 1, 2 or 4 but got" << indices.size()[1], {});
 }
 
-Containers::Array<UnsignedInt> generateTriangleStripIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(vertexCount, 2u) - 2u)};
-    generateTriangleStripIndicesInto(vertexCount, output, offset);
-    return output;
+void remapAttributesInPlace(const Containers::StridedArrayView1D<const UnsignedInt>& remap, const Containers::ArrayView<const Containers::StridedArrayView2D<char>> attributes) {
+    const std::size_t vertexCount = remap.size();
+    std::size_t carrySize = 0;
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        CORRADE_ASSERT(attributes[i].size()[0] == vertexCount,
+            "MeshTools::remapAttributesInPlace(): expected attribute" << i << "to have" << vertexCount << "items but got" << attributes[i].size()[0], );
+        CORRADE_ASSERT(attributes[i].isContiguous<1>(),
+            "MeshTools::remapAttributesInPlace(): second dimension of attribute" << i << "is not contiguous", );
+        carrySize += attributes[i].size()[1];
+    }
+
+    Containers::Array<bool> placed{ValueInit, vertexCount};
+    Containers::Array<char> carry{NoInit, carrySize};
+    for(std::size_t start = 0; start != vertexCount; ++start) {
+        if(placed[start]) continue;
+
+        char* out = carry.data();
+        for(const Containers::StridedArrayView2D<char>& attribute: attributes) {
+            std::memcpy(out, attribute[start].data(), attribute.size()[1]);
+            out += attribute.size()[1];
+        }
+
+        std::size_t from = start;
+        do {
+            const std::size_t to = remap[from];
+            CORRADE_ASSERT(to < vertexCount && !placed[to],
+                "MeshTools::remapAttributesInPlace(): remap is not a permutation of" << vertexCount << "vertices", );
+            placed[to] = true;
+
+            char* c = carry.data();
+            for(const Containers::StridedArrayView2D<char>& attribute: attributes) {
+                char* const data = static_cast<char*>(attribute[to].data());
+                for(std::size_t b = 0, bMax = attribute.size()[1]; b != bMax; ++b) {
+                    const char t = data[b];
+                    data[b] = c[b];
+                    c[b] = t;
+                }
+                c += attribute.size()[1];
+            }
+
+            from = to;
+        } while(from != start);
+    }
 }
 
-Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
-    generateTriangleStripIndicesInto(indices, output, offset);
-    return output;
+void remapAttributesInPlace(const Containers::StridedArrayView1D<const UnsignedInt>& remap, const std::initializer_list<Containers::StridedArrayView2D<char>> attributes) {
+    remapAttributesInPlace(remap, Containers::arrayView(attributes));
 }
 
-Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
-    generateTriangleStripIndicesInto(indices, output, offset);
-    return output;
+}}
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+template<class T> Matrix4 quantizePositionsIntoImplementation(const Containers::StridedArrayView1D<const Vector3>& positions, const Range3D& bounds, const Containers::StridedArrayView1D<Math::Vector3<T>>& output) {
+    const bool isSigned = std::is_signed<T>::value;
+    const Vector3 origin = isSigned ? bounds.center() : bounds.min();
+    Vector3 scale = isSigned ? bounds.size()*0.5f : bounds.size();
+    for(std::size_t i = 0; i != 3; ++i)
+        if(!(scale[i] > 0.0f)) scale[i] = 1.0f;
+    const Vector3 invScale = 1.0f/scale;
+    const Float lowerLimit = isSigned ? -1.0f : 0.0f;
+
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        output[i] = Math::pack<Math::Vector3<T>>(Math::clamp((positions[i] - origin)*invScale, lowerLimit, 1.0f));
+
+    return Matrix4::translation(origin)*Matrix4::scaling(scale);
 }
 
-Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
-    generateTriangleStripIndicesInto(indices, output, offset);
-    return output;
+template<class T> void quantizePositionsIntoImplementation(const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t chunkSize, const Containers::StridedArrayView1D<Math::Vector3<T>>& output, const Containers::StridedArrayView1D<Matrix4>& dequantizations) {
+    CORRADE_ASSERT(chunkSize,
+        "MeshTools::quantizePositionsInto(): expected non-zero chunk size", );
+    CORRADE_ASSERT(output.size() == positions.size(),
+        "MeshTools::quantizePositionsInto(): bad output size, expected" << positions.size() << "but got" << output.size(), );
+    const std::size_t chunkCount = (positions.size() + chunkSize - 1)/chunkSize;
+    CORRADE_ASSERT(dequantizations.size() == chunkCount,
+        "MeshTools::quantizePositionsInto(): bad dequantization output size, expected" << chunkCount << "but got" << dequantizations.size(), );
+
+    for(std::size_t i = 0; i != chunkCount; ++i) {
+        const std::size_t offset = i*chunkSize;
+        const std::size_t count = Math::min(positions.size() - offset, chunkSize);
+        const Containers::StridedArrayView1D<const Vector3> chunk = positions.sliceSize(offset, count);
+        dequantizations[i] = quantizePositionsIntoImplementation(chunk, boundingRange(chunk), output.sliceSize(offset, count));
+    }
 }
 
-Containers::Array<UnsignedInt> generateTriangleStripIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size()[0], std::size_t{2}) - 2)};
-    generateTriangleStripIndicesInto(indices, output, offset);
-    return output;
 }
 
-void generateTriangleFanIndicesInto(const UnsignedInt vertexCount, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(vertexCount == 0 || vertexCount >= 3,
-        "MeshTools::generateTriangleFanIndicesInto(): expected either zero or at least three vertices, got" << vertexCount, );
+Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3us>& output) {
+    CORRADE_ASSERT(output.size() == positions.size(),
+        "MeshTools::quantizePositionsInto(): bad output size, expected" << positions.size() << "but got" << output.size(), {});
+    return quantizePositionsIntoImplementation(positions, boundingRange(positions), output);
+}
 
-    const UnsignedInt iMax = Math::max(vertexCount, 2u) - 2;
-    CORRADE_ASSERT(output.size() == 3*iMax,
-        "MeshTools::generateTriangleFanIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<Vector3s>& output) {
+    CORRADE_ASSERT(output.size() == positions.size(),
+        "MeshTools::quantizePositionsInto(): bad output size, expected" << positions.size() << "but got" << output.size(), {});
+    return quantizePositionsIntoImplementation(positions, boundingRange(positions), output);
+}
 
-    for(std::size_t i = 0; i != iMax; ++i) {
-        output[i*3 + 0] = offset + 0;
-        output[i*3 + 1] = offset + i + 1;
-        output[i*3 + 2] = offset + i + 2;
-    }
+Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Range3D& bounds, const Containers::StridedArrayView1D<Vector3us>& output) {
+    CORRADE_ASSERT(output.size() == positions.size(),
+        "MeshTools::quantizePositionsInto(): bad output size, expected" << positions.size() << "but got" << output.size(), {});
+    return quantizePositionsIntoImplementation(positions, bounds, output);
+}
+
+Matrix4 quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Range3D& bounds, const Containers::StridedArrayView1D<Vector3s>& output) {
+    CORRADE_ASSERT(output.size() == positions.size(),
+        "MeshTools::quantizePositionsInto(): bad output size, expected" << positions.size() << "but got" << output.size(), {});
+    return quantizePositionsIntoImplementation(positions, bounds, output);
+}
+
+void quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t chunkSize, const Containers::StridedArrayView1D<Vector3us>& output, const Containers::StridedArrayView1D<Matrix4>& dequantizations) {
+    quantizePositionsIntoImplementation(positions, chunkSize, output, dequantizations);
+}
+
+void quantizePositionsInto(const Containers::StridedArrayView1D<const Vector3>& positions, const std::size_t chunkSize, const Containers::StridedArrayView1D<Vector3s>& output, const Containers::StridedArrayView1D<Matrix4>& dequantizations) {
+    quantizePositionsIntoImplementation(positions, chunkSize, output, dequantizations);
 }
 
+}}
+namespace Magnum { namespace MeshTools {
+
 namespace {
 
-template<class T> void generateTriangleFanIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.size() == 0 || indices.size() >= 3,
-        "MeshTools::generateTriangleFanIndicesInto(): expected either zero or at least three indices, got" << indices.size(), );
+struct RadixSortIdentity {
+    enum: bool { IsIdentity = true };
 
-    const UnsignedInt iMax = Math::max(indices.size(), std::size_t{2}) - 2;
-    CORRADE_ASSERT(output.size() == 3*iMax,
-        "MeshTools::generateTriangleFanIndicesInto(): bad output size, expected" << 3*iMax << "but got" << output.size(), );
+    template<class T> static T to(const T key) { return key; }
+    template<class T> static T from(const T key) { return key; }
+};
 
-    for(std::size_t i = 0; i != iMax; ++i) {
-        output[i*3 + 0] = offset + indices[0];
-        output[i*3 + 1] = offset + indices[i + 1];
-        output[i*3 + 2] = offset + indices[i + 2];
+struct RadixSortFloat {
+    enum: bool { IsIdentity = false };
+
+    static UnsignedInt to(const UnsignedInt key) {
+        return key ^ ((0u - (key >> 31))|0x80000000u);
+    }
+    static UnsignedInt from(const UnsignedInt key) {
+        return key ^ (((key >> 31) - 1u)|0x80000000u);
+    }
+};
+
+template<class Transform, class T> void radixSortCountInto(const Containers::StridedArrayView1D<const T>& keys, T* const out, UnsignedInt(*const histograms)[256]) {
+    for(std::size_t digit = 0; digit != sizeof(T); ++digit)
+        for(std::size_t i = 0; i != 256; ++i)
+            histograms[digit][i] = 0;
+
+    for(std::size_t i = 0; i != keys.size(); ++i) {
+        const T key = Transform::to(keys[i]);
+        if(out) out[i] = key;
+        for(std::size_t digit = 0; digit != sizeof(T); ++digit)
+            ++histograms[digit][(key >> digit*8) & 0xff];
     }
 }
 
+template<class T> std::size_t radixSortHistogramCount(const UnsignedInt(*const histograms)[256]) {
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != 256; ++i)
+        count += histograms[0][i];
+    return count;
 }
 
-void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+template<class Transform, class T> void radixSortKeysInto(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, T* const out, UnsignedInt(*const histograms)[256]) {
+    if(!histogram.data()) {
+        radixSortCountInto<Transform, T>(keys, out, histograms);
+        return;
+    }
+
+    for(std::size_t digit = 0; digit != sizeof(T); ++digit)
+        for(std::size_t i = 0; i != 256; ++i)
+            histograms[digit][i] = histogram[digit][i];
+    for(std::size_t i = 0; i != keys.size(); ++i)
+        out[i] = Transform::to(keys[i]);
 }
 
-void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+template<class Transform, class T> void radixSortHistogramIntoImplementation(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram) {
+    CORRADE_ASSERT(histogram.size()[0] == sizeof(T) && histogram.size()[1] == 256,
+        "MeshTools::radixSortHistogramInto(): expected a" << sizeof(T) << "x 256 histogram but got" << histogram.size()[0] << "x" << histogram.size()[1], );
+
+    UnsignedInt histograms[sizeof(T)][256];
+    radixSortCountInto<Transform, T>(keys, nullptr, histograms);
+    for(std::size_t digit = 0; digit != sizeof(T); ++digit)
+        for(std::size_t i = 0; i != 256; ++i)
+            histogram[digit][i] = histograms[digit][i];
 }
 
-void generateTriangleFanIndicesInto(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    generateTriangleFanIndicesIntoImplementation(indices, output, offset);
+template<class T> bool radixSortPasses(T* keys, T* keysScratch, UnsignedInt* values, UnsignedInt* valuesScratch, const std::size_t size, UnsignedInt(*const histograms)[256]) {
+    bool swapped = false;
+    for(std::size_t digit = 0; digit != sizeof(T); ++digit) {
+        UnsignedInt* const histogram = histograms[digit];
+        const std::size_t shift = digit*8;
+        if(histogram[(keys[0] >> shift) & 0xff] == size) continue;
+
+        UnsignedInt offset = 0;
+        for(std::size_t i = 0; i != 256; ++i) {
+            const UnsignedInt count = histogram[i];
+            histogram[i] = offset;
+            offset += count;
+        }
+
+        for(std::size_t i = 0; i != size; ++i) {
+            const T key = keys[i];
+            const UnsignedInt position = histogram[(key >> shift) & 0xff]++;
+            keysScratch[position] = key;
+            valuesScratch[position] = values[i];
+        }
+
+        T* const keysTmp = keys;
+        keys = keysScratch;
+        keysScratch = keysTmp;
+        UnsignedInt* const valuesTmp = values;
+        values = valuesScratch;
+        valuesScratch = valuesTmp;
+        swapped = !swapped;
+    }
+
+    return swapped;
 }
 
-void generateTriangleFanIndicesInto(const Containers::StridedArrayView2D<const char>& indices, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(indices.isContiguous<1>(), "MeshTools::generateTriangleFanIndicesInto(): second index view dimension is not contiguous", );
-    if(indices.size()[1] == 4)
-        return generateTriangleFanIndicesInto(Containers::arrayCast<1, const UnsignedInt>(indices), output, offset);
-    else if(indices.size()[1] == 2)
-        return generateTriangleFanIndicesInto(Containers::arrayCast<1, const UnsignedShort>(indices), output, offset);
-    else if(indices.size()[1] == 1)
-        return generateTriangleFanIndicesInto(Containers::arrayCast<1, const UnsignedByte>(indices), output, offset);
-    else CORRADE_ASSERT_UNREACHABLE("MeshTools::generateTriangleFanIndicesInto(): expected index type size 1, 2 or 4 but got" << indices.size()[1], );
+template<class Transform, class T> void radixSortIndicesIntoImplementation(const Containers::StridedArrayView1D<const T>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    CORRADE_ASSERT(indices.size() == keys.size(),
+        "MeshTools::radixSortIndicesInto(): bad output size, expected" << keys.size() << "but got" << indices.size(), );
+    CORRADE_ASSERT(!histogram.data() || (histogram.size()[0] == sizeof(T) && histogram.size()[1] == 256),
+        "MeshTools::radixSortIndicesInto(): expected a" << sizeof(T) << "x 256 histogram but got" << histogram.size()[0] << "x" << histogram.size()[1], );
+    const std::size_t size = keys.size();
+    if(!size) return;
+    CORRADE_ASSERT(size <= 0xffffffffu,
+        "MeshTools::radixSortIndicesInto(): expected at most 4294967295 keys but got" << size, );
+
+    const bool contiguous = indices.isContiguous();
+    Containers::Array<char> scratch{NoInit, size*(2*sizeof(T) + (contiguous ? 1 : 2)*sizeof(UnsignedInt))};
+    T* const keysA = reinterpret_cast<T*>(scratch.data());
+    T* const keysB = keysA + size;
+    UnsignedInt* const valuesB = reinterpret_cast<UnsignedInt*>(keysB + size);
+    UnsignedInt* const valuesA = contiguous ? static_cast<UnsignedInt*>(indices.data()) : valuesB + size;
+
+    UnsignedInt histograms[sizeof(T)][256];
+    radixSortKeysInto<Transform, T>(keys, histogram, keysA, histograms);
+    CORRADE_ASSERT(radixSortHistogramCount<T>(histograms) == size,
+        "MeshTools::radixSortIndicesInto(): expected a histogram of" << size << "keys but got" << radixSortHistogramCount<T>(histograms), );
+    for(std::size_t i = 0; i != size; ++i)
+        valuesA[i] = UnsignedInt(i);
+
+    const UnsignedInt* const values = radixSortPasses(keysA, keysB, valuesA, valuesB, size, histograms) ? valuesB : valuesA;
+    if(values == indices.data()) return;
+    for(std::size_t i = 0; i != size; ++i)
+        indices[i] = values[i];
 }
 
-Containers::Array<UnsignedInt> generateTriangleFanIndices(const UnsignedInt vertexCount, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(vertexCount, 2u) - 2)};
-    generateTriangleFanIndicesInto(vertexCount, output, offset);
-    return output;
+template<class Transform, class T> void radixSortInPlaceImplementation(const Containers::StridedArrayView1D<T>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    CORRADE_ASSERT(payload.size() == keys.size(),
+        "MeshTools::radixSortInPlace(): expected key and payload views to have the same size but got" << keys.size() << "and" << payload.size(), );
+    CORRADE_ASSERT(!histogram.data() || (histogram.size()[0] == sizeof(T) && histogram.size()[1] == 256),
+        "MeshTools::radixSortInPlace(): expected a" << sizeof(T) << "x 256 histogram but got" << histogram.size()[0] << "x" << histogram.size()[1], );
+    const std::size_t size = keys.size();
+    if(!size) return;
+    CORRADE_ASSERT(size <= 0xffffffffu,
+        "MeshTools::radixSortInPlace(): expected at most 4294967295 keys but got" << size, );
+
+    const bool contiguous = keys.isContiguous() && payload.isContiguous();
+    const std::size_t scratchSize = size*(sizeof(T) + sizeof(UnsignedInt))*(contiguous ? 1 : 2);
+    if(scratch.size() < scratchSize)
+        scratch = Containers::Array<char>{NoInit, scratchSize};
+    T* const keysB = reinterpret_cast<T*>(scratch.data());
+    T* const keysA = contiguous ? static_cast<T*>(keys.data()) : keysB + size;
+    UnsignedInt* const valuesB = reinterpret_cast<UnsignedInt*>(keysB + (contiguous ? 1 : 2)*size);
+    UnsignedInt* const valuesA = contiguous ? static_cast<UnsignedInt*>(payload.data()) : valuesB + size;
+
+    UnsignedInt histograms[sizeof(T)][256];
+    radixSortKeysInto<Transform, T>(keys, histogram, keysA, histograms);
+    CORRADE_ASSERT(radixSortHistogramCount<T>(histograms) == size,
+        "MeshTools::radixSortInPlace(): expected a histogram of" << size << "keys but got" << radixSortHistogramCount<T>(histograms), );
+    if(!contiguous) for(std::size_t i = 0; i != size; ++i)
+        valuesA[i] = payload[i];
+
+    const bool swapped = radixSortPasses(keysA, keysB, valuesA, valuesB, size, histograms);
+    const T* const sortedKeys = swapped ? keysB : keysA;
+    const UnsignedInt* const sortedValues = swapped ? valuesB : valuesA;
+    if(contiguous && !swapped) {
+        if(!Transform::IsIdentity) for(std::size_t i = 0; i != size; ++i)
+            keysA[i] = Transform::from(keysA[i]);
+        return;
+    }
+    for(std::size_t i = 0; i != size; ++i) {
+        keys[i] = Transform::from(sortedKeys[i]);
+        payload[i] = sortedValues[i];
+    }
 }
 
-Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedInt>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
-    generateTriangleFanIndicesInto(indices, output, offset);
-    return output;
 }
 
-Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedShort>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
-    generateTriangleFanIndicesInto(indices, output, offset);
-    return output;
+Containers::Array<UnsignedInt> radixSortIndices(const Containers::StridedArrayView1D<const UnsignedInt>& keys) {
+    Containers::Array<UnsignedInt> out{NoInit, keys.size()};
+    radixSortIndicesIntoImplementation<RadixSortIdentity>(keys, nullptr, out);
+    return out;
 }
 
-Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView1D<const UnsignedByte>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size(), std::size_t{2}) - 2)};
-    generateTriangleFanIndicesInto(indices, output, offset);
-    return output;
+Containers::Array<UnsignedInt> radixSortIndices(const Containers::StridedArrayView1D<const UnsignedLong>& keys) {
+    Containers::Array<UnsignedInt> out{NoInit, keys.size()};
+    radixSortIndicesIntoImplementation<RadixSortIdentity>(keys, nullptr, out);
+    return out;
 }
 
-Containers::Array<UnsignedInt> generateTriangleFanIndices(const Containers::StridedArrayView2D<const char>& indices, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> output{NoInit, 3*(Math::max(indices.size()[0], std::size_t{2}) - 2)};
-    generateTriangleFanIndicesInto(indices, output, offset);
-    return output;
+Containers::Array<UnsignedInt> radixSortIndices(const Containers::StridedArrayView1D<const Float>& keys) {
+    Containers::Array<UnsignedInt> out{NoInit, keys.size()};
+    radixSortIndicesIntoImplementation<RadixSortFloat>(Containers::arrayCast<const UnsignedInt>(keys), nullptr, out);
+    return out;
 }
 
-namespace {
+void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    radixSortIndicesIntoImplementation<RadixSortIdentity>(keys, nullptr, indices);
+}
 
-template<class T> inline void generateQuadIndicesIntoImplementation(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const T>& quads, const Containers::StridedArrayView1D<T>& output, const UnsignedInt offset) {
-    CORRADE_ASSERT(quads.size() % 4 == 0,
-        "MeshTools::generateQuadIndicesInto(): quad index count" << quads.size() << "not divisible by 4", );
-    CORRADE_ASSERT(quads.size()*6/4 == output.size(),
-        "MeshTools::generateQuadIndicesInto(): bad output size, expected" << quads.size()*6/4 << "but got" << output.size(), );
+void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedLong>& keys, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    radixSortIndicesIntoImplementation<RadixSortIdentity>(keys, nullptr, indices);
+}
 
-    for(std::size_t i = 0, max = quads.size()/4; i != max; ++i) {
-        auto get = [&](UnsignedInt j) -> const Vector3& {
-            UnsignedInt index = quads[4*i + j];
-            CORRADE_ASSERT(index < positions.size(),
-                "MeshTools::generateQuadIndicesInto(): index" << index << "out of range for" << positions.size() << "elements", positions[0]);
-            return positions[index];
-        };
-        const Vector3& a = get(0);
-        const Vector3& b = get(1);
-        const Vector3& c = get(2);
-        const Vector3& d = get(3);
+void radixSortIndicesInto(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    radixSortIndicesIntoImplementation<RadixSortFloat>(Containers::arrayCast<const UnsignedInt>(keys), nullptr, indices);
+}
 
-        constexpr UnsignedInt SplitAbcAcd[] { 0, 1, 2, 0, 2, 3 };
-        constexpr UnsignedInt SplitDabDbc[] { 3, 0, 1, 3, 1, 2 };
-        const UnsignedInt* split;
-        const bool abcAcdOppositeDirection = Math::dot(Math::cross(c - b, a - b), Math::cross(d - c, a - c)) < 0.0f;
-        const bool dabDbcOppositeDirection = Math::dot(Math::cross(d - b, a - b), Math::cross(c - b, d - b)) < 0.0f;
+void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedInt>& keys, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    radixSortInPlaceImplementation<RadixSortIdentity>(keys, nullptr, payload, scratch);
+}
 
-        if(abcAcdOppositeDirection != dabDbcOppositeDirection)
-            split = abcAcdOppositeDirection ? SplitDabDbc : SplitAbcAcd;
+void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedLong>& keys, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    radixSortInPlaceImplementation<RadixSortIdentity>(keys, nullptr, payload, scratch);
+}
 
-        else split = (b - d).dot() < (c - a).dot() ? SplitDabDbc : SplitAbcAcd;
+void radixSortInPlace(const Containers::StridedArrayView1D<Float>& keys, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    radixSortInPlaceImplementation<RadixSortFloat>(Containers::arrayCast<UnsignedInt>(keys), nullptr, payload, scratch);
+}
 
-        for(std::size_t j = 0; j != 6; ++j)
-            output[6*i + j] = offset + quads[4*i + split[j]];
-    }
+void radixSortHistogramInto(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram) {
+    radixSortHistogramIntoImplementation<RadixSortIdentity>(keys, histogram);
 }
 
+void radixSortHistogramInto(const Containers::StridedArrayView1D<const UnsignedLong>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram) {
+    radixSortHistogramIntoImplementation<RadixSortIdentity>(keys, histogram);
 }
 
-Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedInt>& quads, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> out{NoInit, quads.size()*6/4};
-    generateQuadIndicesIntoImplementation(positions, quads, Containers::stridedArrayView(out), offset);
-    return out;
+void radixSortHistogramInto(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView2D<UnsignedInt>& histogram) {
+    radixSortHistogramIntoImplementation<RadixSortFloat>(Containers::arrayCast<const UnsignedInt>(keys), histogram);
 }
 
-Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedShort>& quads, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> out{ValueInit, quads.size()*6/4};
-    generateQuadIndicesIntoImplementation(positions, quads,
-        Containers::StridedArrayView1D<UnsignedShort>{
-            Containers::arrayCast<UnsignedShort>(out),
-            reinterpret_cast<UnsignedShort*>(out.data())
-                #ifdef CORRADE_TARGET_BIG_ENDIAN
-                + 1
-                #endif
-            , out.size(), 4},
-        offset);
-    return out;
+void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedInt>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    radixSortIndicesIntoImplementation<RadixSortIdentity>(keys, histogram, indices);
 }
 
-Containers::Array<UnsignedInt> generateQuadIndices(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedByte>& quads, const UnsignedInt offset) {
-    Containers::Array<UnsignedInt> out{ValueInit, quads.size()*6/4};
-    generateQuadIndicesIntoImplementation(positions, quads,
-        Containers::StridedArrayView1D<UnsignedByte>{
-            Containers::arrayCast<UnsignedByte>(out),
-            reinterpret_cast<UnsignedByte*>(out.data())
-                #ifdef CORRADE_TARGET_BIG_ENDIAN
-                + 3
-                #endif
-            , out.size(), 4},
-        offset);
-    return out;
+void radixSortIndicesInto(const Containers::StridedArrayView1D<const UnsignedLong>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    radixSortIndicesIntoImplementation<RadixSortIdentity>(keys, histogram, indices);
 }
 
-void generateQuadIndicesInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedInt>& quads, const Containers::StridedArrayView1D<UnsignedInt>& output, const UnsignedInt offset) {
-    return generateQuadIndicesIntoImplementation(positions, quads, output, offset);
+void radixSortIndicesInto(const Containers::StridedArrayView1D<const Float>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& indices) {
+    radixSortIndicesIntoImplementation<RadixSortFloat>(Containers::arrayCast<const UnsignedInt>(keys), histogram, indices);
 }
 
-void generateQuadIndicesInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedShort>& quads, const Containers::StridedArrayView1D<UnsignedShort>& output, const UnsignedInt offset) {
-    return generateQuadIndicesIntoImplementation(positions, quads, output, offset);
+void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedInt>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    radixSortInPlaceImplementation<RadixSortIdentity>(keys, histogram, payload, scratch);
 }
 
-void generateQuadIndicesInto(const Containers::StridedArrayView1D<const Vector3>& positions, const Containers::StridedArrayView1D<const UnsignedByte>& quads, const Containers::StridedArrayView1D<UnsignedByte>& output, const UnsignedInt offset) {
-    return generateQuadIndicesIntoImplementation(positions, quads, output, offset);
+void radixSortInPlace(const Containers::StridedArrayView1D<UnsignedLong>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    radixSortInPlaceImplementation<RadixSortIdentity>(keys, histogram, payload, scratch);
+}
+
+void radixSortInPlace(const Containers::StridedArrayView1D<Float>& keys, const Containers::StridedArrayView2D<const UnsignedInt>& histogram, const Containers::StridedArrayView1D<UnsignedInt>& payload, Containers::Array<char>& scratch) {
+    radixSortInPlaceImplementation<RadixSortFloat>(Containers::arrayCast<UnsignedInt>(keys), histogram, payload, scratch);
 }
 
 }}
@@ -0,0 +1,145 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#define CORRADE_CPU_IMPLEMENTATION
+#define CORRADE_BITARRAY_IMPLEMENTATION
+#include "../CorradeBitArray.hpp"
+/* Including second time to verify the implementation (or other) symbols don't
+   get accidentally defined twice. See comment in the input file for details
+   how this can happen in practice. */
+#include "../CorradeBitArray.hpp"
+
+using namespace Corrade;
+
+/*
+    Does this look funny? That's DEFINITELY NOT how testing should look, right?
+    True dat. Unlike the other headers, CorradeBitArray.hpp is a local addition
+    that isn't upstream, so the upstream BitArray tests don't cover its
+    CPU-dispatched bitAndInto(), bitOrInto(), bitXorInto(), count() and
+    findFirstSet() kernels. The checks below compare their results to a
+    bit-by-bit calculation, with offsets and sizes that exercise the
+    vectorized parts as well as unaligned heads and tails.
+*/
+
+namespace {
+
+bool bitAnd(bool a, bool b) { return a && b; }
+bool bitOr(bool a, bool b) { return a || b; }
+bool bitXor(bool a, bool b) { return a != b; }
+
+int checkBitwise(void(*function)(const Containers::BitArrayView&, const Containers::BitArrayView&, const Containers::MutableBitArrayView&), bool(*expected)(bool, bool), const char* a, std::size_t aOffset, const char* b, std::size_t bOffset, std::size_t dstOffset, std::size_t size) {
+    char dst[320];
+    for(std::size_t i = 0; i != sizeof(dst); ++i)
+        dst[i] = char(0x5a);
+    const Containers::BitArrayView aView{a, aOffset, size};
+    const Containers::BitArrayView bView{b, bOffset, size};
+    function(aView, bView, Containers::MutableBitArrayView{dst, dstOffset, size});
+
+    /* Bits outside of the destination range have to stay untouched */
+    const Containers::BitArrayView all{dst, 0, sizeof(dst)*8};
+    int failed = 0;
+    for(std::size_t i = 0; i != all.size(); ++i) {
+        const bool value = i >= dstOffset && i < dstOffset + size ?
+            expected(aView[i - dstOffset], bView[i - dstOffset]) : (0x5a >> (i & 0x07)) & 1;
+        if(all[i] != value) ++failed;
+    }
+    return failed ? 1 : 0;
+}
+
+int checkCount(const char* data, std::size_t offset, std::size_t size) {
+    const Containers::BitArrayView view{data, offset, size};
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != size; ++i)
+        if(view[i]) ++expected;
+    return view.count() == expected ? 0 : 1;
+}
+
+int checkFindFirstSet(std::size_t set, std::size_t offset, std::size_t size) {
+    char data[320]{};
+    data[set >> 3] = char(1 << (set & 0x07));
+    const std::size_t expected = set >= offset && set < offset + size ? set - offset : size;
+    return Containers::BitArrayView{data, offset, size}.findFirstSet() == expected ? 0 : 1;
+}
+
+}
+
+int main() {
+    int data[]{7, 0, 5};
+
+    Containers::MutableStridedBitArrayView1D bits = Containers::stridedArrayView(data).sliceBit(1);
+    bits.set(1);
+    bits.reset(0);
+
+    char packed[1]{};
+    Containers::MutableBitArrayView view{packed, 3, 5};
+    view.set(4, bits[1]);
+
+    Containers::BitArray a{DirectInit, 100, true};
+    Containers::BitArray b{100};
+    b.slice(37, 90).setAll();
+    b.reset(50);
+    Containers::BitArray c{NoInit, 100};
+    Containers::bitXorInto(a, b, c);
+
+    /* Pseudo-random input for the bitwise and count kernels, the sizes are
+       large enough to go through the unrolled AVX2 loop and leave tails that
+       aren't a multiple of the vector width */
+    char x[320], y[320];
+    unsigned state = 0x12345678u;
+    for(std::size_t i = 0; i != sizeof(x); ++i) {
+        state = state*1103515245u + 12345u;
+        x[i] = char(state >> 16);
+        state = state*1103515245u + 12345u;
+        y[i] = char(state >> 16);
+    }
+
+    int failed = 0;
+    const std::size_t sizes[]{1, 13, 8*16 + 3, 8*(4*32) + 13, 8*(4*32 + 5*16) + 7, 8*319};
+    for(std::size_t size: sizes) {
+        for(std::size_t offset: {0, 3, 7}) {
+            failed += checkBitwise(Containers::bitAndInto, bitAnd, x, offset, y, offset, offset, size);
+            failed += checkBitwise(Containers::bitOrInto, bitOr, x, offset, y, offset, offset, size);
+            failed += checkBitwise(Containers::bitXorInto, bitXor, x, offset, y, offset, offset, size);
+            failed += checkCount(x, offset, size);
+        }
+        /* Differing offsets go through the bit-by-bit fallback */
+        failed += checkBitwise(Containers::bitAndInto, bitAnd, x, 1, y, 6, 3, size);
+        failed += checkBitwise(Containers::bitOrInto, bitOr, x, 5, y, 0, 2, size);
+        failed += checkBitwise(Containers::bitXorInto, bitXor, x, 0, y, 7, 4, size);
+    }
+
+    /* A single set bit at the start, in the first byte before the view
+       offset, after a run of zeros long enough for the vectorized search, in
+       the last byte and right past the view end */
+    for(std::size_t offset: {0, 2, 7}) {
+        for(std::size_t set: {std::size_t{0}, std::size_t{1}, std::size_t{9}, std::size_t{8*17 + 2}, std::size_t{8*150 + 1}, std::size_t{8*300 + 5}, std::size_t{8*319 + 6}}) {
+            failed += checkFindFirstSet(set, offset, 8*300 + 5 - offset);
+            failed += checkFindFirstSet(set, offset, 8*319 + 1 - offset);
+        }
+    }
+
+    return (data[0] - 5) + (data[1] - 2) + (static_cast<unsigned char>(packed[0]) - (1 << 7)) + (int(b.count()) - 52) + (int(c.slice(37, 100).findFirstSet()) - 13) + failed;
+}
@@ -43,6 +43,12 @@ using namespace Magnum;
 int main() {
     Vector4i a{3, 42, 57, -1};
 
+    /* The mortonEncode() and mortonDecode() calls test code from
+       MAGNUM_MATH_IMPLEMENTATION as well, including the BMI2 variant if
+       enabled */
+    const UnsignedInt morton = Math::mortonEncode(Vector3us{1, 2, 3});
+
     /* The log2() call tests code from MAGNUM_MATH_IMPLEMENTATION */
-    return a[1] - 40 - Math::log2(4);
+    return a[1] - 40 - Math::log2(4) +
+        (morton == 0x35 && Math::mortonDecode<Vector3us>(morton) == Vector3us{1, 2, 3} ? 0 : 1);
 }
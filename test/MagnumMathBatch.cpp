@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#define CORRADE_CPU_IMPLEMENTATION
 #define MAGNUM_MATH_BATCH_IMPLEMENTATION
 #include "../MagnumMathBatch.hpp"
 /* Including second time to verify the implementation (or other) symbols don't
@@ -47,5 +48,282 @@ int main() {
     Math::castInto(Containers::stridedArrayView(in),
                    Containers::stridedArrayView(out));
 
-    return Math::max(Containers::stridedArrayView(out)) - 32;
+    /* The packInto() / unpackInto() tests the CPU-dispatched code */
+    const Float unpacked[]{0.0f, 0.25f, 0.5f, 0.75f, 1.0f, 0.125f, 0.625f,
+                           0.875f, 0.5f};
+    UnsignedByte packed[9];
+    Float unpackedAgain[9];
+    Math::packInto(Containers::stridedArrayView(unpacked),
+                   Containers::stridedArrayView(packed));
+    Math::unpackInto(Containers::stridedArrayView(packed),
+                     Containers::stridedArrayView(unpackedAgain));
+
+    /* The packInto() with out-of-range input and a row size that's not a
+       multiple of the vector width tests that the scalar fallback and the
+       row remainder saturate the same way as the vectorized part */
+    const Float outOfRange[]{2.0f, -3.0f, 0.25f, 1.0e10f, -1.0e10f,
+                             -1.0e10f, 1.0e10f, 0.25f, -3.0f, 2.0f};
+    Byte packedOutOfRange[10];
+    Math::packInto(Containers::StridedArrayView2D<const Float>{outOfRange, {2, 5}},
+                   Containers::StridedArrayView2D<Byte>{packedOutOfRange, {2, 5}});
+
+    /* The minmaxBatched() tests the CPU-dispatched code with NaN handling,
+       the inline minmax() has to give the same result */
+    const Vector3 points[]{{1.0f, Constants::nan(), 3.0f},
+                           {-1.0f, 2.0f, 5.0f},
+                           {0.5f, 0.0f, -4.0f}};
+    const Containers::Pair<Vector3, Vector3> bounds = Math::minmaxBatched(points);
+    const Containers::Pair<Vector3, Vector3> boundsInline = Math::minmax(points);
+
+    /* The isNanInto() tests the CPU-dispatched code writing into a bit view */
+    const Float values[]{1.0f, Constants::nan(), 3.0f, Constants::inf(),
+                         Constants::nan()};
+    char nanBits[1]{};
+    Math::isNanInto(Containers::stridedArrayView(values),
+                    Containers::MutableBitArrayView{nanBits, 1, 5});
+
+    /* The isNanAny() / isInfAny() tests the CPU-dispatched any-check, the
+       inline isNan() / isInf() has to give the same result */
+    const bool anyNan = Math::isNanAny(values);
+    const bool anyInf = Math::isInfAny(Containers::stridedArrayView(values).prefix(3));
+
+    /* The transformPointsInPlace() tests the CPU-dispatched SoA kernels */
+    Vector3 positions[5]{{1.0f, 2.0f, 3.0f}, {}, {}, {}, {0.0f, 0.0f, -1.0f}};
+    Math::transformPointsInPlace(Matrix4::translation({1.0f, 0.0f, 0.0f}),
+                                 Containers::stridedArrayView(positions));
+
+    /* The slerpShortestPathInto() tests the CPU-dispatched SoA kernels */
+    const Quaternion from[]{Quaternion{}, Quaternion{}};
+    const Quaternion to[]{Quaternion::rotation(Deg(90.0f), Vector3::zAxis()),
+                          -Quaternion::rotation(Deg(90.0f), Vector3::zAxis())};
+    Quaternion interpolated[2];
+    Math::slerpShortestPathInto(from, to, 0.5f, interpolated);
+
+    /* The sampleTrack() tests the inline keyframe lookup */
+    const Float keys[]{0.0f, 1.0f, 3.0f};
+    const Float keyValues[]{0.0f, 2.0f, 6.0f};
+    std::size_t hint = 0;
+    const Float sampled = Math::sampleTrack<Float, Float>(keys, keyValues, Math::lerp, 2.5f, hint);
+
+    /* The sampleTrack() with two equal keys tests that the zero-length
+       segment doesn't produce a NaN, with integer keys that the factor isn't
+       calculated with an integer division */
+    const Float stepKeys[]{0.0f, 1.0f, 1.0f};
+    const Float stepped = Math::sampleTrack<Float, Float>(stepKeys, keyValues, Math::lerp, 1.0f);
+    const Int intKeys[]{0, 10, 20};
+    const Float sampledInt = Math::sampleTrack<Int, Float>(intKeys, keyValues, Math::lerp, 5);
+
+    /* The fromSrgbInto() / toSrgbInto() tests the lookup table and the
+       CPU-dispatched approximation, with alpha passed through */
+    const UnsignedByte srgb[]{0, 10, 200, 128, 255, 1, 66, 3};
+    Float linear[8];
+    UnsignedByte srgbAgain[8];
+    Math::fromSrgbInto(Containers::StridedArrayView2D<const UnsignedByte>{srgb, {2, 4}},
+                       Containers::StridedArrayView2D<Float>{linear, {2, 4}});
+    Math::toSrgbInto(Containers::StridedArrayView2D<const Float>{linear, {2, 4}},
+                     Containers::StridedArrayView2D<UnsignedByte>{srgbAgain, {2, 4}});
+
+    /* The rangeFrustumInto() tests the CPU-dispatched SoA kernels */
+    const Range3D boxes[]{{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}},
+                          {{5.0f, 5.0f, 5.0f}, {6.0f, 6.0f, 6.0f}},
+                          {{0.5f, -3.0f, 0.0f}, {2.0f, 3.0f, 0.5f}}};
+    char visible[1]{};
+    Math::Intersection::rangeFrustumInto(boxes,
+        Frustum{{1.0f, 0.0f, 0.0f, 2.0f}, {-1.0f, 0.0f, 0.0f, 2.0f},
+                {0.0f, 1.0f, 0.0f, 2.0f}, {0.0f, -1.0f, 0.0f, 2.0f},
+                {0.0f, 0.0f, 1.0f, 2.0f}, {0.0f, 0.0f, -1.0f, 2.0f}},
+        Containers::MutableBitArrayView{visible, 0, 3});
+
+    /* The multiplyHierarchyInto() tests the CPU-dispatched SoA kernels
+       together with the serial fallback for a parent in the same group, the
+       invertedRigidInto() undoes the whole chain */
+    const Matrix4 local[]{Matrix4::translation(Vector3::xAxis()),
+                          Matrix4::rotationZ(Deg(90.0f)),
+                          Matrix4::translation(Vector3::yAxis()),
+                          Matrix4::scaling(Vector3{2.0f}),
+                          Matrix4::translation(Vector3::zAxis())};
+    const Int parents[]{-1, 0, 1, -1, 2};
+    Matrix4 world[5];
+    Matrix4 inverse[5];
+    Math::multiplyHierarchyInto(local, parents, world);
+    Math::invertedRigidInto(Containers::arrayView(world).prefix(3), Containers::arrayView(inverse).prefix(3));
+    Math::multiplyInto(Containers::arrayView(inverse).prefix(3), Containers::arrayView(world).prefix(3), Containers::arrayView(inverse).prefix(3));
+
+    /* The skinLinearInto() / skinDualQuaternionInto() tests the
+       CPU-dispatched kernels together with the scalar remainder */
+    const Matrix4 jointMatrices[]{Matrix4{}, Matrix4::translation(Vector3::xAxis()*2.0f)};
+    const DualQuaternion jointTransformations[]{DualQuaternion{}, DualQuaternion::translation(Vector3::xAxis()*2.0f)};
+    const UnsignedInt jointIds[]{0, 1, 1, 0, 1, 1};
+    const Float weights[]{0.5f, 0.5f, 0.25f, 0.75f, 0.5f, 0.5f};
+    const Vector3 skinPositions[]{{0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}};
+    Vector3 skinnedLinear[3];
+    Vector3 skinnedDualQuaternion[3];
+    Math::skinLinearInto(jointMatrices, Containers::StridedArrayView2D<const UnsignedInt>{jointIds, {3, 2}}, Containers::StridedArrayView2D<const Float>{weights, {3, 2}}, skinPositions, skinnedLinear);
+    Math::skinDualQuaternionInto(jointTransformations, Containers::StridedArrayView2D<const UnsignedInt>{jointIds, {3, 2}}, Containers::StridedArrayView2D<const Float>{weights, {3, 2}}, skinPositions, skinnedDualQuaternion);
+
+    /* The skinLinearInto() with weights not summing to one and a vertex count
+       that isn't a multiple of any lane count tests that the vectorized part
+       and the scalar remainder calculate the same affine blend, without a
+       division by the blended w. The values are exactly representable so
+       FMA and non-FMA paths give the same result. */
+    const Matrix4 unnormalizedJoints[]{Matrix4::translation({1.0f, 2.0f, 3.0f}), Matrix4::scaling(Vector3{2.0f})};
+    const UnsignedInt unnormalizedJointIds[]{0, 1, 1, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0, 1};
+    const Float unnormalizedWeights[]{0.5f, 0.25f, 0.5f, 0.0f, 0.5f, 0.5f, 0.25f, 0.25f, 1.0f, 0.5f, 0.75f, 0.5f, 0.5f, 0.0f};
+    const Vector3 unnormalizedPositions[]{{1.0f, 1.0f, 1.0f}, {2.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 1.0f},
+        {0.0f, 4.0f, -2.0f}, {3.0f, 3.0f, 3.0f}, {-1.0f, 0.0f, 2.0f}, {1.0f, 1.0f, 1.0f}};
+    Vector3 skinnedUnnormalized[7];
+    Math::skinLinearInto(unnormalizedJoints, Containers::StridedArrayView2D<const UnsignedInt>{unnormalizedJointIds, {7, 2}}, Containers::StridedArrayView2D<const Float>{unnormalizedWeights, {7, 2}}, unnormalizedPositions, skinnedUnnormalized);
+    int skinnedUnnormalizedMismatches = 0;
+    for(std::size_t i = 0; i != 7; ++i) {
+        const Matrix4 blended = unnormalizedJoints[unnormalizedJointIds[i*2 + 0]]*unnormalizedWeights[i*2 + 0] +
+                                unnormalizedJoints[unnormalizedJointIds[i*2 + 1]]*unnormalizedWeights[i*2 + 1];
+        if(skinnedUnnormalized[i] != (blended*Vector4{unnormalizedPositions[i], 1.0f}).xyz())
+            ++skinnedUnnormalizedMismatches;
+    }
+
+    /* The packOctahedralInto() / pack1010102Into() / packRgb9e5Into() tests
+       the CPU-dispatched packers with the scalar remainder */
+    const Vector3 octahedralNormals[]{Vector3::zAxis(-1.0f), Vector3::xAxis(), Vector3::yAxis(-1.0f)};
+    Vector2s octahedral[3];
+    Vector3 octahedralUnpacked[3];
+    Math::packOctahedralInto(octahedralNormals, octahedral);
+    Math::unpackOctahedralInto(octahedral, octahedralUnpacked);
+    const Vector4 packedColor[]{{1.0f, 0.0f, 0.5f, 1.0f}};
+    UnsignedInt packed1010102[1];
+    Math::pack1010102Into(packedColor, packed1010102);
+    const Vector3 hdrColor[]{{1.0f, 0.0f, 0.0f}};
+    UnsignedInt packedRgb9e5[1];
+    Math::packRgb9e5Into(hdrColor, packedRgb9e5);
+
+    /* The sum() / meanVariance() tests the CPU-dispatched compensated
+       accumulation together with the scalar remainder */
+    const Vector3 samples[]{{1.0f, 2.0f, 3.0f}, {3.0f, 2.0f, 5.0f},
+                            {1.0f, 2.0f, 3.0f}, {3.0f, 2.0f, 5.0f},
+                            {1.0f, 2.0f, 3.0f}, {3.0f, 2.0f, 5.0f}};
+    const Vector3 sampleSum = Math::sum(samples);
+    const Containers::Pair<Vector3, Vector3> sampleMeanVariance = Math::meanVariance(samples);
+
+    /* The rayRangeInto() tests the CPU-dispatched slab test together with the
+       padded remainder */
+    const Vector3 rayOrigins[]{{0.0f, 0.0f, -5.0f}, {3.0f, 0.0f, -5.0f}, {0.5f, 0.5f, 5.0f}};
+    const Vector3 inverseRayDirections[]{{Constants::inf(), Constants::inf(), 1.0f},
+                                         {Constants::inf(), Constants::inf(), 1.0f},
+                                         {Constants::inf(), Constants::inf(), -1.0f}};
+    Float tNear[3];
+    Float tFar[3];
+    char rayHits[1]{};
+    Math::Intersection::rayRangeInto(rayOrigins, inverseRayDirections,
+        Range3D{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}, tNear, tFar,
+        Containers::MutableBitArrayView{rayHits, 0, 3});
+
+    /* The many-rays-against-one-range rayRangeInto() overload tests that the
+       range bounds stay alive for the whole vectorized part and remainder */
+    Vector3 boxRayOrigins[9];
+    Vector3 boxInverseRayDirections[9];
+    for(std::size_t i = 0; i != 9; ++i) {
+        boxRayOrigins[i] = {Float(i) + 0.5f, 3.5f, 0.0f};
+        boxInverseRayDirections[i] = {Constants::inf(), Constants::inf(), 1.0f};
+    }
+    const Range3D box{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    Float boxTNear[9];
+    Float boxTFar[9];
+    char boxRayHits[2]{};
+    Math::Intersection::rayRangeInto(boxRayOrigins, boxInverseRayDirections,
+        box, boxTNear, boxTFar, Containers::MutableBitArrayView{boxRayHits, 0, 9});
+
+    /* The sphereFrustumClustersInto() tests the CPU-dispatched sphere culling
+       together with the per-cluster index compaction */
+    const Vector3 lightCenters[]{{0.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f}, {1.2f, 0.0f, 0.0f}};
+    const Float lightRadii[]{0.5f, 0.5f, 0.5f};
+    const Frustum lightClusters[]{
+        Frustum::fromMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, -1.0f, 1.0f)),
+        Frustum::fromMatrix(Matrix4::orthographicProjection({2.0f, 2.0f}, -1.0f, 1.0f)*Matrix4::translation({-3.0f, 0.0f, 0.0f}))};
+    UnsignedInt lightOffsets[3];
+    UnsignedInt lightIndices[4];
+    const std::size_t lightCount = Math::Intersection::sphereFrustumClustersInto(lightCenters, lightRadii, lightClusters, lightOffsets, lightIndices);
+
+    /* The sphereFrustumClustersInto() with a sphere count that's not a
+       multiple of 8 tests that the unused bits of the last byte are ignored */
+    const Vector3 farLightCenters[]{{5.0f, 0.0f, 0.0f}, {6.0f, 0.0f, 0.0f},
+                                    {7.0f, 0.0f, 0.0f}, {8.0f, 0.0f, 0.0f},
+                                    {9.0f, 0.0f, 0.0f}, {3.0f, 0.0f, 0.0f}};
+    const Float farLightRadii[]{0.5f, 0.5f, 0.5f, 0.5f, 0.5f, 0.5f};
+    UnsignedInt farLightOffsets[3];
+    UnsignedInt farLightIndices[8];
+    const std::size_t farLightCount = Math::Intersection::sphereFrustumClustersInto(farLightCenters, farLightRadii, lightClusters, farLightOffsets, farLightIndices);
+
+    /* The sphereFrustumInto() with a non-normalized frustum tests that the
+       CPU-dispatched kernels and the remainder give the same result as the
+       scalar sphereFrustum() */
+    const Frustum perspective = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(60.0f), 1.0f, 0.5f, 10.0f));
+    Vector3 sphereCenters[19];
+    Float sphereRadii[19];
+    for(std::size_t i = 0; i != 19; ++i) {
+        sphereCenters[i] = {Float(i)*0.75f - 7.0f, 0.5f, -5.0f};
+        sphereRadii[i] = Float(i % 4)*0.75f;
+    }
+    char sphereVisible[3]{};
+    Math::Intersection::sphereFrustumInto(sphereCenters, sphereRadii, perspective,
+        Containers::MutableBitArrayView{sphereVisible, 0, 19});
+    std::size_t sphereMismatches = 0;
+    for(std::size_t i = 0; i != 19; ++i)
+        if(bool(sphereVisible[i >> 3] & (1 << (i & 0x07))) != Math::Intersection::sphereFrustum(sphereCenters[i], sphereRadii[i], perspective))
+            ++sphereMismatches;
+
+    /* The mortonEncodeInto() and mortonDecodeInto() tests the CPU-dispatched
+       BMI2 or magic-bits kernels together with the quantization */
+    const Vector3 mortonPoints[]{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, -1.0f, -1.0f}};
+    UnsignedInt mortonCodes[3];
+    Vector3us mortonDecoded[3];
+    Math::mortonEncodeInto(mortonPoints, Range3D{{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}}, mortonCodes);
+    Math::mortonDecodeInto(mortonCodes, mortonDecoded);
+
+    return (Math::max(Containers::stridedArrayView(out)) - 32) +
+           (packed[2] - 128) +
+           (unpackedAgain[4] == 1.0f ? 0 : 1) +
+           (packedOutOfRange[0] == 127 && packedOutOfRange[1] == -127 &&
+            packedOutOfRange[2] == 32 && packedOutOfRange[3] == 127 &&
+            packedOutOfRange[4] == -127 && packedOutOfRange[5] == -127 &&
+            packedOutOfRange[8] == -127 && packedOutOfRange[9] == 127 ? 0 : 1) +
+           (bounds.first() == Vector3{-1.0f, 0.0f, -4.0f} &&
+            bounds.second() == Vector3{1.0f, 2.0f, 5.0f} ? 0 : 1) +
+           (boundsInline.first() == bounds.first() &&
+            boundsInline.second() == bounds.second() ? 0 : 1) +
+           (Math::minBatched(in) == -17 && Math::maxBatched(in) == 32 ? 0 : 1) +
+           (nanBits[0] - 0x24) +
+           (anyNan && anyNan == Math::isNan(values) ? 0 : 1) +
+           (!anyInf && anyInf == Math::isInf(Containers::stridedArrayView(values).prefix(3)) ? 0 : 1) +
+           (positions[0] == Vector3{2.0f, 2.0f, 3.0f} &&
+            positions[4] == Vector3{1.0f, 0.0f, -1.0f} ? 0 : 1) +
+           (interpolated[0] == Quaternion::rotation(Deg(45.0f), Vector3::zAxis()) &&
+            interpolated[1] == -interpolated[0] ? 0 : 1) +
+           (sampled == 5.0f && hint == 1 && stepped == 6.0f && sampledInt == 1.0f ? 0 : 1) +
+           (linear[4] == 1.0f && srgbAgain[2] == 200 && srgbAgain[7] == 3 ? 0 : 1) +
+           (visible[0] - 0x05) +
+           (world[4].translation() == Vector3{0.0f, 0.0f, 1.0f} &&
+            world[3] == local[3] && inverse[2] == Matrix4{} ? 0 : 1) +
+           (skinnedLinear[0] == Vector3{1.0f, 1.0f, 0.0f} &&
+            skinnedLinear[1] == Vector3{0.5f, 0.0f, 1.0f} &&
+            skinnedDualQuaternion[2] == Vector3{3.0f, 0.0f, 0.0f} ? 0 : 1) +
+           (skinnedUnnormalized[0] == Vector3{1.5f, 2.0f, 2.5f} &&
+            skinnedUnnormalized[6] == Vector3{1.0f, 1.5f, 2.0f} ? 0 : 1) + skinnedUnnormalizedMismatches +
+           (octahedralUnpacked[0] == Vector3::zAxis(-1.0f) &&
+            octahedralUnpacked[2] == Vector3::yAxis(-1.0f) &&
+            packed1010102[0] == 0xe00003ffu &&
+            packedRgb9e5[0] == 0x80000100u ? 0 : 1) +
+           (sampleSum == Vector3{12.0f, 12.0f, 24.0f} &&
+            sampleMeanVariance.first() == Vector3{2.0f, 2.0f, 4.0f} &&
+            sampleMeanVariance.second() == Vector3{1.0f, 0.0f, 1.0f} ? 0 : 1) +
+           (rayHits[0] - 0x05) +
+           (tNear[0] == 4.0f && tFar[0] == 6.0f && tNear[2] == 4.0f ? 0 : 1) +
+           (boxRayHits[0] == 0x0e && boxRayHits[1] == 0 &&
+            boxTNear[2] == 3.0f && boxTFar[2] == 6.0f ? 0 : 1) +
+           (lightCount == 3 && lightOffsets[1] == 2 && lightOffsets[2] == 3 &&
+            lightIndices[1] == 2 && lightIndices[2] == 1 ? 0 : 1) +
+           (farLightCount == 1 && farLightOffsets[1] == 0 &&
+            farLightIndices[0] == 5 ? 0 : 1) +
+           (sphereMismatches == 0 ? 0 : 1) +
+           (mortonCodes[0] == 0 && mortonCodes[1] == 0x3fffffffu &&
+            mortonCodes[2] == 0x08000000u &&
+            mortonDecoded[2] == Vector3us{512, 0, 0} ? 0 : 1);
 }
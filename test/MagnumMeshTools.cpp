@@ -24,6 +24,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#define CORRADE_CPU_IMPLEMENTATION
+#define MAGNUM_MATH_BATCH_IMPLEMENTATION
 #define MAGNUM_MESHTOOLS_IMPLEMENTATION
 #include "../MagnumMeshTools.hpp"
 /* Including second time to verify the implementation (or other) symbols don't
@@ -41,6 +43,113 @@ using namespace Magnum;
 */
 
 int main() {
+    /* The quantizePositionsInto() tests the bounds calculation together with
+       the clamping and packing relative to them */
+    const Vector3 positions[]{{-1.0f, 2.0f, 0.0f}, {3.0f, 2.0f, 1.0f}, {1.0f, 6.0f, 0.5f}};
+    Vector3us quantized[3];
+    const Matrix4 dequantization = MeshTools::quantizePositionsInto(positions, quantized);
+
+    /* The boundingRange() with a strided view of 37 points tests the
+       vectorized part of the CPU-dispatched minmaxBatched() including
+       skipping of NaNs, and the scalar remainder */
+    Vector3 points[74]{};
+    for(std::size_t i = 0; i != 37; ++i)
+        points[i*2] = Vector3{Float(i % 5), Float(i % 7), Float(i % 3)};
+    points[0] = {Constants::nan(), 1.0f, 0.0f};
+    points[6] = {-2.0f, 3.0f, Constants::nan()};
+    points[30] = {4.5f, -5.0f, 1.0f};
+    points[50] = {0.5f, 0.0f, -7.0f};
+    points[72] = {1.0f, 9.0f, 0.0f};
+    const Range3D bounds = MeshTools::boundingRange(Containers::stridedArrayView(points).every(2));
+
+    /* The radixSortIndices() and radixSortInPlace() tests the float key
+       transformation together with skipping of passes with a single bucket */
+    const Float depths[]{2.5f, -1.0f, 0.0f, -3.5f};
+    const Containers::Array<UnsignedInt> depthOrder = MeshTools::radixSortIndices(depths);
+    UnsignedInt keys[]{0x300, 0x100, 0x200};
+    UnsignedInt payload[]{0, 1, 2};
+    Containers::Array<char> scratch;
+    MeshTools::radixSortInPlace(keys, payload, scratch);
+
+    /* The radixSortInPlace() with strided 64-bit keys and an odd count tests
+       that the scratch buffers stay aligned for the key type */
+    UnsignedLong longKeys[]{0x300000000ull, 0, 0x100000005ull, 0, 0x200000001ull};
+    UnsignedInt longPayload[]{0, 1, 2};
+    MeshTools::radixSortInPlace(Containers::stridedArrayView(longKeys).every(2), longPayload, scratch);
+
+    /* The radixSortHistogramInto() on two halves of the keys, summed and
+       passed to radixSortIndicesInto() tests the caller-driven parallel
+       histogram, which has to give the same order as radixSortIndices() */
+    UnsignedInt depthHistogram[4*256];
+    UnsignedInt depthHistogramSecondHalf[4*256];
+    MeshTools::radixSortHistogramInto(Containers::arrayView(depths).prefix(2), Containers::StridedArrayView2D<UnsignedInt>{depthHistogram, {4, 256}});
+    MeshTools::radixSortHistogramInto(Containers::arrayView(depths).exceptPrefix(2), Containers::StridedArrayView2D<UnsignedInt>{depthHistogramSecondHalf, {4, 256}});
+    for(std::size_t i = 0; i != 4*256; ++i)
+        depthHistogram[i] += depthHistogramSecondHalf[i];
+    UnsignedInt depthOrderMerged[4];
+    MeshTools::radixSortIndicesInto(depths, Containers::StridedArrayView2D<const UnsignedInt>{depthHistogram, {4, 256}}, depthOrderMerged);
+
+    /* The generateTriangleStripIndicesInto() tests the CPU-dispatched
+       contiguous path including the widening of 8-bit indices and the winding
+       of odd triangles in both the vectorized part and the remainder */
+    const UnsignedByte strip[]{10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22};
+    UnsignedInt stripIndices[33];
+    MeshTools::generateTriangleStripIndicesInto(strip, stripIndices, 100);
+
+    /* The generateTriangleFanIndicesCompressed() tests the narrowing of the
+       contiguous path to the smallest type that fits */
+    const Containers::Pair<Containers::Array<char>, MeshIndexType> fan = MeshTools::generateTriangleFanIndicesCompressed(strip);
+
+    /* The compressIndicesBaseVertex() tests the CPU-dispatched range scan
+       together with the narrowing after subtracting the minimal index */
+    const UnsignedInt wide[]{70000, 70300, 70002, 70001, 70003, 70004, 70005, 70006,
+                             70007, 70008, 70009, 70010, 70011, 70012, 70013, 70014, 70015};
+    const Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressed = MeshTools::compressIndicesBaseVertex(wide);
+
+    /* The compressIndicesBaseVertex() with a strided view tests the range
+       scan going through the CPU-dispatched minmaxBatched() */
+    const Containers::Triple<Containers::Array<char>, MeshIndexType, UnsignedInt> compressedStrided = MeshTools::compressIndicesBaseVertex(Containers::stridedArrayView(wide).every(2));
+
+    /* The optimizeVertexCacheInPlace() tests the adjacency build and the
+       fanning order over a shuffled strip of quads with a tiny cache */
+    UnsignedShort grid[]{0, 1, 5, 3, 8, 7, 1, 6, 5, 2, 7, 6, 3, 4, 8, 1, 2, 6, 2, 3, 7, 4, 9, 8};
+    const Containers::Pair<Float, Float> acmr = MeshTools::optimizeVertexCacheInPlace(grid, 10, 4);
+
+    /* The optimizeVertexFetchInPlace() and remapAttributesInPlace() tests
+       the first-use order including an unused vertex, and following of the
+       permutation cycles across multiple attributes at once */
+    UnsignedByte fetch[]{3, 1, 3, 4, 0, 1};
+    Float weights[]{0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+    UnsignedShort joints[]{10, 11, 12, 13, 14};
+    const Containers::Array<UnsignedInt> remap = MeshTools::optimizeVertexFetchInPlace(fetch, 5);
+    MeshTools::remapAttributesInPlace(remap, {
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(weights)),
+        Containers::arrayCast<2, char>(Containers::stridedArrayView(joints))});
+
     /* This tests code from MAGNUM_MESHTOOLS_IMPLEMENTATION */
-    return MeshTools::generateTriangleFanIndices(10)[6];
+    return MeshTools::generateTriangleFanIndices(10)[6] +
+           (quantized[2] == Vector3us{32768, 65535, 32768} &&
+            dequantization.transformPoint(Vector3{1.0f}) == Vector3{3.0f, 6.0f, 1.0f} ? 0 : 1) +
+           (bounds.min() == Vector3{-2.0f, -5.0f, -7.0f} &&
+            bounds.max() == Vector3{4.5f, 9.0f, 2.0f} ? 0 : 1) +
+           (depthOrder[0] == 3 && depthOrder[1] == 1 && depthOrder[3] == 0 &&
+            depthOrderMerged[0] == 3 && depthOrderMerged[1] == 1 &&
+            depthOrderMerged[2] == 2 && depthOrderMerged[3] == 0 &&
+            keys[0] == 0x100 && payload[0] == 1 && payload[2] == 0 ? 0 : 1) +
+           (longKeys[0] == 0x100000005ull && longKeys[4] == 0x300000000ull &&
+            longPayload[0] == 1 && longPayload[1] == 2 ? 0 : 1) +
+           (stripIndices[3] == 112 && stripIndices[4] == 111 && stripIndices[5] == 113 &&
+            stripIndices[30] == 120 && stripIndices[31] == 121 && stripIndices[32] == 122 ? 0 : 1) +
+           (fan.second() == MeshIndexType::UnsignedByte && fan.first().size() == 33 &&
+            fan.first()[30] == 10 && fan.first()[32] == 22 ? 0 : 1) +
+           (compressed.second() == MeshIndexType::UnsignedShort && compressed.third() == 70000 &&
+            reinterpret_cast<const UnsignedShort*>(compressed.first().data())[1] == 300 &&
+            reinterpret_cast<const UnsignedShort*>(compressed.first().data())[16] == 15 ? 0 : 1) +
+           (compressedStrided.second() == MeshIndexType::UnsignedShort && compressedStrided.third() == 70000 &&
+            compressedStrided.first().size() == 9*2 &&
+            reinterpret_cast<const UnsignedShort*>(compressedStrided.first().data())[8] == 15 ? 0 : 1) +
+           (acmr.first() == 2.75f && acmr.second() == 1.25f &&
+            grid[3] == 1 && grid[4] == 6 && grid[5] == 5 && grid[23] == 8 ? 0 : 1) +
+           (remap[3] == 0 && remap[2] == 4 && fetch[2] == 0 && fetch[4] == 3 &&
+            weights[0] == 3.0f && weights[3] == 0.0f && joints[2] == 14 && joints[4] == 12 ? 0 : 1);
 }